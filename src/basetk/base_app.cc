@@ -10,6 +10,12 @@
  * <table>
  * <tr><th>Date         <th>Version  <th>Author     <th>Description
  * <tr><td>2022/5/28    <td>1.0      <td>Zing Fong  <td>Initialize
+ * <tr><td>2026/10/18   <td>1.1      <td>Zing Fong  <td>实现了BaseApp::run
+ * <tr><td>2026/10/18   <td>1.2      <td>Zing Fong  <td>增加了[BASE] trace_file时间线输出
+ * <tr><td>2026/10/18   <td>1.3      <td>Zing Fong  <td>增加了无内存申请阶段的检查
+ * <tr><td>2026/10/18   <td>1.4      <td>Zing Fong  <td>配置表改为预解析的哈希表, 修正了读取时丢失参数的错误
+ * <tr><td>2026/10/18   <td>1.5      <td>Zing Fong  <td>流式松组合支持配置文件热更新
+ * <tr><td>2026/10/18   <td>1.6      <td>Zing Fong  <td>分时段解算的结果按窗口顺序流式写出
  * </table>
  **********************************************************************************
  */
@@ -19,11 +25,25 @@
 
 // c/c++系统文件
 #include <fstream>
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
 
 // 其他库的 .h 文件
+#include <cctype>
+#include <chrono>
 #include <cstdlib>
 
 // 本项目内 .h 文件
+#include "base_config_watcher.h"
+#include "base_profiler.h"
+#include "base_time_slicer.h"
+#include "../gnsstk/gnss_app.h"
+#include "../sinstk/sins_app.h"
+#include "../sinstk/sins_simulator.h"
 
 /**@brief       判断一个char类型变量是否为' '字符
  * @param[in]   c    要判断的字符
@@ -105,56 +125,45 @@ void Config::Trim(std::string &str)
 }
 
 /**@brief           读取一行, 并对一行进行分析
+ * @details         #之后为注释, 以;开头的行也为注释。块名所在行只更新section。
  * @param[in]       line        待分析的字符串
- * @param[out]      section     配置参数大类section
+ * @param[in,out]   section     配置参数大类section, 遇到块名时更新
  * @param[out]      key         配置参数名key
  * @param[out]      value       参数值value
  * @return          返回结果:\n
- * - true           该行不为空, 已分析完毕\n
- * - false          该行为空\n
+ * - true           该行为参数行, 已分析完毕\n
+ * - false          该行为空行、注释或块名\n
  * @author      Zing Fong
  * @date        2022/5/29
  */
 bool Config::AnalyseLine(const std::string &line, std::string &section,
                          std::string &key, std::string &value)
 {
-    if(line.empty())
+    std::string new_line = line;
+    size_t pos;
+    if((pos = new_line.find('#')) != std::string::npos)
+        new_line.erase(pos);
+    if((pos = new_line.find('\r')) != std::string::npos)
+        new_line.erase(pos);
+    Trim(new_line);
+    if(new_line.empty() || isCommentChar(new_line[0]))
         return false;
-    int start_pos = 0, end_pos = line.size() - 1, pos, s_startpos, s_endpos;
-    if((pos = line.find("#")) != -1)
+    if(new_line[0] == '[')
     {
-        if(0 == pos)
+        if((pos = new_line.find(']')) != std::string::npos)
         {
-            return false;
+            section = new_line.substr(1, pos - 1);
+            Trim(section);
         }
-        end_pos = pos - 1;
-    }
-    if(((s_startpos = line.find("[")) != -1) &&
-       ((s_endpos = line.find("]"))) != -1)
-    {
-        section = line.substr(s_startpos + 1, s_endpos - 1);
-        return true;
+        return false;
     }
-    std::string new_line = line.substr(start_pos, start_pos + 1 - end_pos);
-    if((pos = new_line.find('=')) == -1)
+    if((pos = new_line.find('=')) == std::string::npos)
         return false;
     key = new_line.substr(0, pos);
-    value = new_line.substr(pos + 1, end_pos + 1 - (pos + 1));
+    value = new_line.substr(pos + 1);
     Trim(key);
-    if(key.empty())
-    {
-        return false;
-    }
     Trim(value);
-    if((pos = value.find("\r")) > 0)
-    {
-        value.replace(pos, 1, "");
-    }
-    if((pos = value.find("\n")) > 0)
-    {
-        value.replace(pos, 1, "");
-    }
-    return true;
+    return !key.empty();
 }
 
 /**@brief       创建默认配置文件
@@ -171,6 +180,7 @@ bool Config::CreateDefaultConfig()
 }
 
 /**@brief       读取配置文件并保存配置参数
+ * @details     同一参数出现多次时以最后一次为准, 同一块可以分多处出现
  * @param[in]   filename     待读取的配置文件名
  * @note        如果当前文件夹下没找到配置文件, 则会创建一个默认的
  * @author      Zing Fong
@@ -178,7 +188,8 @@ bool Config::CreateDefaultConfig()
  */
 bool Config::ReadConfig(const std::string &filename)
 {
-    settings_.clear();
+    values_.clear();
+    slots_.clear();
     std::ifstream infile(filename.c_str());//构造默认调用open,所以可以不调用open
     if(!infile)
     {
@@ -191,24 +202,10 @@ bool Config::ReadConfig(const std::string &filename)
         infile.open("config.ini");
     }
     std::string line, key, value, section;
-    std::map<std::string, std::string> k_v;
-    std::map<std::string, std::map<std::string, std::string> >::iterator it;
     while(getline(infile, line))
     {
         if(AnalyseLine(line, section, key, value))
-        {
-            it = settings_.find(section);
-            if(it != settings_.end())
-            {
-                k_v[key] = value;
-                it->second = k_v;
-            }
-            else
-            {
-                k_v.clear();
-                settings_.insert(std::make_pair(section, k_v));
-            }
-        }
+            Set(section, key, value);
         key.clear();
         value.clear();
     }
@@ -216,6 +213,118 @@ bool Config::ReadConfig(const std::string &filename)
     return true;
 }
 
+/**@brief       块.参数项的哈希值(FNV-1a), 与对拼接后的字符串计算的结果相同
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+uint64_t Config::Hash(std::string_view section, std::string_view item)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    auto add = [&hash](const char &c)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ULL;
+    };
+    for(const auto &c: section)
+        add(c);
+    add('.');
+    for(const auto &c: item)
+        add(c);
+    return hash;
+}
+
+/**@brief       查找参数所在的槽
+ * @return      参数所在的槽; 参数不存在时返回探测到的第一个空槽; 哈希表为空时返回-1
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int Config::FindSlot(std::string_view section, std::string_view item,
+                     const uint64_t &hash) const
+{
+    if(slots_.empty())
+        return -1;
+    auto mask = static_cast<uint64_t>(slots_.size() - 1);
+    for(auto slot = static_cast<int>(hash & mask);;
+        slot = static_cast<int>((slot + 1) & mask))
+    {
+        int index = slots_[slot];
+        if(index < 0)
+            return slot;
+        const std::string &key = values_[index].key;
+        if(key.size() == section.size() + 1 + item.size() &&
+           key.compare(0, section.size(), section) == 0 &&
+           key[section.size()] == '.' &&
+           key.compare(section.size() + 1, item.size(), item) == 0)
+            return slot;
+    }
+}
+
+/**@brief       扩容并重新插入所有参数
+ * @param[in]   slot_num    槽数, 须为2的幂
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void Config::Rehash(const int &slot_num)
+{
+    slots_.assign(slot_num, -1);
+    for(int i = 0; i < static_cast<int>(values_.size()); ++i)
+    {
+        std::string_view key = values_[i].key;
+        size_t pos = key.find('.');
+        auto section = key.substr(0, pos), item = key.substr(pos + 1);
+        slots_[FindSlot(section, item, Hash(section, item))] = i;
+    }
+}
+
+/**@brief       设置参数, 并解析为各类型
+ * @param[in]   section     块
+ * @param[in]   item        参数项
+ * @param[in]   text        参数值
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void Config::Set(std::string_view section, std::string_view item,
+                 std::string_view text)
+{
+    if(2*(values_.size() + 1) > slots_.size())  // 装载因子不超过0.5
+        Rehash(slots_.empty() ? 16 : static_cast<int>(2*slots_.size()));
+    uint64_t hash = Hash(section, item);
+    int slot = FindSlot(section, item, hash);
+    if(slots_[slot] < 0)
+    {
+        slots_[slot] = static_cast<int>(values_.size());
+        values_.emplace_back();
+        auto &value = values_.back();
+        value.key.reserve(section.size() + 1 + item.size());
+        value.key.append(section).append(1, '.').append(item);
+    }
+    auto &value = values_[slots_[slot]];
+    value.text = text;
+    value.int_value = atoi(value.text.c_str());
+    value.double_value = atof(value.text.c_str());
+    std::string lower = value.text;
+    for(auto &c: lower)
+        c = static_cast<char>(tolower(static_cast<unsigned char>(c)));
+    value.bool_value = lower == "1" || lower == "true" || lower == "yes" ||
+                       lower == "on";
+}
+
+/**@brief       查找参数
+ * @param[in]   section     块
+ * @param[in]   item        参数项
+ * @return      参数, 不存在时返回nullptr
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+const ConfigValue *Config::Find(std::string_view section,
+                                std::string_view item) const
+{
+    int slot = FindSlot(section, item, Hash(section, item));
+    if(slot < 0 || slots_[slot] < 0)
+        return nullptr;
+    return &values_[slots_[slot]];
+}
+
 /**@brief          读取类型为string的参数
  * @param[in]      section              要查找的块
  * @param[in]      item                 要查找的参数项
@@ -226,29 +335,11 @@ bool Config::ReadConfig(const std::string &filename)
  * @author      Zing Fong
  * @date        2022/5/29
  */
-std::string Config::ReadString(const char *section, const char *item,
-                               const char *default_value) const
+std::string Config::ReadString(std::string_view section, std::string_view item,
+                               std::string_view default_value) const
 {
-    std::string tmp_s(section);
-    std::string tmp_i(item);
-    std::string def(default_value);
-    std::map<std::string, std::string> k_v;
-    std::map<std::string, std::string>::iterator it_item;
-    std::map<std::string, std::map<std::string, std::string> >::const_iterator it;
-    it = settings_.find(tmp_s);
-    if(it == settings_.end())
-    {
-        //printf("111");
-        return def;
-    }
-    k_v = it->second;
-    it_item = k_v.find(tmp_i);
-    if(it_item == k_v.end())
-    {
-        //printf("222");
-        return def;
-    }
-    return it_item->second;
+    const ConfigValue *value = Find(section, item);
+    return std::string(value == nullptr ? default_value : value->text);
 }
 
 /**@brief          读取类型为int的参数
@@ -261,26 +352,11 @@ std::string Config::ReadString(const char *section, const char *item,
  * @author      Zing Fong
  * @date        2022/5/29
  */
-int Config::ReadInt(const char *section, const char *item,
+int Config::ReadInt(std::string_view section, std::string_view item,
                     const int &default_value) const
 {
-    std::string tmp_s(section);
-    std::string tmp_i(item);
-    std::map<std::string, std::string> k_v;
-    std::map<std::string, std::string>::iterator it_item;
-    std::map<std::string, std::map<std::string, std::string> >::const_iterator it;
-    it = settings_.find(tmp_s);
-    if(it == settings_.end())
-    {
-        return default_value;
-    }
-    k_v = it->second;
-    it_item = k_v.find(tmp_i);
-    if(it_item == k_v.end())
-    {
-        return default_value;
-    }
-    return atoi(it_item->second.c_str());
+    const ConfigValue *value = Find(section, item);
+    return value == nullptr ? default_value : value->int_value;
 }
 
 /**@brief          读取类型为float的参数
@@ -293,24 +369,197 @@ int Config::ReadInt(const char *section, const char *item,
  * @author      Zing Fong
  * @date        2022/5/29
  */
-float Config::ReadFloat(const char *section, const char *item,
+float Config::ReadFloat(std::string_view section, std::string_view item,
                         const float &default_value) const
 {
-    std::string tmp_s(section);
-    std::string tmp_i(item);
-    std::map<std::string, std::string> k_v;
-    std::map<std::string, std::string>::iterator it_item;
-    std::map<std::string, std::map<std::string, std::string> >::const_iterator it;
-    it = settings_.find(tmp_s);
-    if(it == settings_.end())
+    const ConfigValue *value = Find(section, item);
+    return value == nullptr ? default_value :
+           static_cast<float>(value->double_value);
+}
+
+/**@brief          读取类型为double的参数
+ * @param[in]      section              要查找的块
+ * @param[in]      item                 要查找的参数项
+ * @param[in]      default_value        该参数项的预设默认值
+ * @return         配置文件中有该参数时返回读取到的值, 否则返回预设默认值
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+double Config::ReadDouble(std::string_view section, std::string_view item,
+                          const double &default_value) const
+{
+    const ConfigValue *value = Find(section, item);
+    return value == nullptr ? default_value : value->double_value;
+}
+
+/**@brief          读取参数, 供Resolve使用
+ * @param[in]      section      要查找的块
+ * @param[in]      item         要查找的参数项
+ * @param[out]     value        参数值, 参数不存在时不变
+ * @return         0为正常, -1为参数不存在
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int Config::Get(std::string_view section, std::string_view item,
+                std::string &value) const
+{
+    const ConfigValue *config_value = Find(section, item);
+    if(config_value == nullptr)
+        return -1;
+    value = config_value->text;
+    return 0;
+}
+
+int Config::Get(std::string_view section, std::string_view item,
+                int &value) const
+{
+    const ConfigValue *config_value = Find(section, item);
+    if(config_value == nullptr)
+        return -1;
+    value = config_value->int_value;
+    return 0;
+}
+
+int Config::Get(std::string_view section, std::string_view item,
+                float &value) const
+{
+    const ConfigValue *config_value = Find(section, item);
+    if(config_value == nullptr)
+        return -1;
+    value = static_cast<float>(config_value->double_value);
+    return 0;
+}
+
+int Config::Get(std::string_view section, std::string_view item,
+                double &value) const
+{
+    const ConfigValue *config_value = Find(section, item);
+    if(config_value == nullptr)
+        return -1;
+    value = config_value->double_value;
+    return 0;
+}
+
+int Config::Get(std::string_view section, std::string_view item,
+                bool &value) const
+{
+    const ConfigValue *config_value = Find(section, item);
+    if(config_value == nullptr)
+        return -1;
+    value = config_value->bool_value;
+    return 0;
+}
+
+/**@brief       启动函数, 读取配置表, 按解算模式创建数据源、解算和输出各阶段, 逐历元流式处理
+ * @details     结束时输出处理速度(历元/秒)和内存占用峰值, 作为各项优化的基准。\n
+ *              [BASE] window_length大于0时, 松组合按时间窗口分段并行解算。
+ *              [BASE] trace_file不为空且编译时开启了LOOSECOUPLED_PROFILE时, 退出时写出各线程的阶段时间线。
+ *              编译时开启了LOOSECOUPLED_ALLOC_TRACK时, [BASE] alloc_free_stages中的阶段在预热后申请内存则返回出错。
+ *              [BASE] config_watch为true时, 流式松组合运行中监视配置文件, [LC]中的噪声参数修改后在下一历元生效。
+ * @return      0为正常, 其他为出错
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int BaseApp::run()
+{
+    if(!config_.ReadConfig("config.ini"))
+        return 1;
+    std::string mode = config_.ReadString("BASE", "mode", "loose coupled");
+    std::string trace_file = config_.ReadString("BASE", "trace_file", "");
+    if(!trace_file.empty())
+        Profiler::EnableTrace(trace_file);
+    LC_PROFILE_THREAD_NAME("main");
+#ifdef LC_ALLOC_TRACK
+    // 稳态下不应申请内存的阶段, 以逗号分隔
+    std::string alloc_free_stages = config_.ReadString("BASE", "alloc_free_stages", "");
+    for(size_t begin = 0; begin < alloc_free_stages.size();)
     {
-        return default_value;
+        size_t end = alloc_free_stages.find(',', begin);
+        if(end == std::string::npos)
+            end = alloc_free_stages.size();
+        if(end > begin && Profiler::SetAllocFree(
+                alloc_free_stages.substr(begin, end - begin)) != 0)
+            return 1;
+        begin = end + 1;
     }
-    k_v = it->second;
-    it_item = k_v.find(tmp_i);
-    if(it_item == k_v.end())
+    Profiler::SetAllocWarmup(config_.ReadInt("BASE", "alloc_warmup_epochs", 1000));
+#endif
+    
+    auto start = std::chrono::steady_clock::now();
+    long epoch_num = -1;
+    if(mode == "spp" || mode == "rtk")
     {
-        return default_value;
+        GnssApp gnss_app{};
+        gnss_app.Init(config_, mode);
+        epoch_num = gnss_app.Run();
     }
-    return atof(it_item->second.c_str());
+    else if(mode == "sins" || mode == "loose coupled")
+    {
+        SinsApp sins_app{};
+        sins_app.Init(config_, mode == "loose coupled");
+        if(sins_app.get_coupled() &&
+           config_.ReadFloat("BASE", "window_length", 0.0f) > 0)
+        {
+            // 分时段并行后处理, 结果按窗口顺序写出
+            TimeSlicer time_slicer{};
+            time_slicer.Init(config_);
+            epoch_num = sins_app.RunSliced(time_slicer);
+            if(epoch_num >= 0)
+                time_slicer.PrintReport();
+        }
+        else
+        {
+            // 实时运行时可以修改配置文件调整噪声参数, 不需要重启和重新对准
+            bool config_watch = false;
+            config_.Get("BASE", "config_watch", config_watch);
+            ConfigWatcher config_watcher{};
+            if(config_watch && config_watcher.Start("config.ini", config_) == 0)
+                sins_app.set_config_watcher(&config_watcher);
+            epoch_num = sins_app.Run();
+        }
+    }
+    else if(mode == "sim")
+    {
+        SinsSimulator simulator{};
+        if(simulator.Init(config_) == 0)
+            epoch_num = simulator.Run();
+    }
+    else
+        printf("Unknown mode: %s\n", mode.c_str());
+    if(epoch_num < 0)
+        return 1;
+    
+    double seconds = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+    printf("mode: %s, epochs: %ld, time: %.3f s, %.1f epochs/s, peak RSS: %.1f MB\n",
+           mode.c_str(), epoch_num, seconds,
+           seconds > 0 ? epoch_num/seconds : 0.0, GetPeakRss());
+    long violation_num = Profiler::GetAllocViolationNum();
+    if(violation_num > 0)
+    {
+        printf("FAILED: %ld allocations in allocation-free stages after warm-up\n",
+               violation_num);
+        return 1;
+    }
+    return 0;
+}
+
+/**@brief       进程内存占用峰值
+ * @return      峰值(MB), 无法获取时返回0
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+double BaseApp::GetPeakRss()
+{
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters{};
+    if(GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return counters.PeakWorkingSetSize/1048576.0;
+    return 0.0;
+#else
+    struct rusage usage{};
+    if(getrusage(RUSAGE_SELF, &usage) == 0)
+        return usage.ru_maxrss/1024.0;  // Linux下单位为KB
+    return 0.0;
+#endif
 }
@@ -10,6 +10,17 @@
  * <table>
  * <tr><th>Date        <th>Version  <th>Author      <th>Description
  * <tr><td>2022/5/28   <td>1.0      <td>Zing Fong   <td>Initialize
+ * <tr><td>2026/10/18  <td>1.1      <td>Zing Fong   <td>实现了BaseApp::run, 补充了配置文件示例
+ * <tr><td>2026/10/18  <td>1.2      <td>Zing Fong   <td>增加了[BASE] trace_file
+ * <tr><td>2026/10/18  <td>1.3      <td>Zing Fong   <td>增加了[BASE] alloc_free_stages, alloc_warmup_epochs
+ * <tr><td>2026/10/18  <td>1.4      <td>Zing Fong   <td>配置表改为预解析的哈希表
+ * <tr><td>2026/10/18  <td>1.5      <td>Zing Fong   <td>增加了[BASE] config_watch
+ * <tr><td>2026/10/18  <td>1.6      <td>Zing Fong   <td>增加了[SINS] precision
+ * <tr><td>2026/10/18  <td>1.7      <td>Zing Fong   <td>增加了[LC] state_dim
+ * <tr><td>2026/10/18  <td>1.8      <td>Zing Fong   <td>增加了[LC] cov_decimation, cov_max_angle
+ * <tr><td>2026/10/18  <td>1.9      <td>Zing Fong   <td>增加了[LC] qd_model
+ * <tr><td>2026/10/18  <td>1.10     <td>Zing Fong   <td>增加了[SINS] frame
+ * <tr><td>2026/10/18  <td>1.11     <td>Zing Fong   <td>增加了[BASE] window_max_diff
  * </table>
  **********************************************************************************
  */
@@ -20,26 +31,83 @@
 // c/c++系统文件
 
 // 其他库的 .h 文件
-#include <map>
+#include <cstdint>
 #include <string>
+#include <string_view>
+#include <vector>
 
 // 本项目内 .h 文件
 
+/**@struct      ConfigValue
+ * @brief       一个配置参数, 读取配置文件时一次性解析为各类型
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Author      <th>Description
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>Initialize
+ * </table>
+ */
+struct ConfigValue
+{
+    std::string key{};  // 块.参数项, 如LC.arw
+    std::string text{};  // 参数值原文
+    int int_value{};  // 按atoi解析的值
+    double double_value{};  // 按atof解析的值
+    bool bool_value{};  // 1, true, yes, on(不区分大小写)为true
+};
+
+/**@struct      ConfigBinding
+ * @brief       参数结构体成员与配置参数项的绑定, 用于Config::Resolve
+ * @details     成员指针在编译期确定, 启动时一次性读取所有参数, 之后直接访问结构体成员
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Author      <th>Description
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>Initialize
+ * </table>
+ */
+template<typename S, typename T>
+struct ConfigBinding
+{
+    constexpr ConfigBinding(std::string_view section, std::string_view item,
+                            T S::*member)
+            : section(section), item(item), member(member) {}
+    
+    std::string_view section;  // 块
+    std::string_view item;  // 参数项
+    T S::*member;  // 结构体成员
+};
+
 /**@class   Config
  * @brief   配置表类, 声明了各种配置参数, 以及配置文件的创建读取等操作
+ * @details 参数按"块.参数项"存放在开放寻址的哈希表中, 读取配置文件时解析为string/int/double/bool。
+ *          查找时直接对块和参数项分别计算哈希, 不拼接字符串, 除ReadString外都不申请内存。
  * @par     修改日志:
  * <table>
  * <tr><th>Date         <th>Author      <th>Description
  * <tr><td>2022/5/28    <td>Zing Fong   <td>Initialize
  * <tr><td>2022/6/7     <td>Zing Fong   <td>将参数读取函数更改为const
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>改为预解析的哈希表, 修正了同一块重复出现时丢失参数的错误
  * </table>
  */
 class Config
 {
     /** ini文件示例
     [BASE]
-    #可选解算模式spp, rtk, loose coupled
+    #可选解算模式spp, rtk, sins, loose coupled, sim(生成仿真数据)
     mode=rtk
+    #分时段并行后处理: 窗口长度(s, 0为不分段), 窗口间重叠预热时长(s), 线程数(0为硬件线程数)
+    #第一个窗口按配置初始化, 之后的窗口在重叠段内第一个速度大于[LC] align_speed的GNSS历元处运动中对准
+    window_length=0
+    window_overlap=300
+    thread_num=0
+    #重叠段最大位置差或拼接跳变超过此值(m)时警告
+    window_max_diff=0.5
+    #Chrome trace时间线文件, 为空不输出, 需要以LOOSECOUPLED_PROFILE=ON编译
+    trace_file=
+    #稳态下不应申请内存的阶段(以逗号分隔, 如mechanization,lc predict)及预热历元数, 需要以LOOSECOUPLED_ALLOC_TRACK=ON编译
+    alloc_free_stages=
+    alloc_warmup_epochs=1000
+    #流式松组合运行中监视本文件, [LC]中的IMU噪声、GNSS标准差和协方差传播间隔修改后在下一历元生效, 不需要重启
+    config_watch=false
     
     [SPP]
     o_file_path=
@@ -54,20 +122,122 @@ class Config
     #高度角阈值单位为°
     elevation_threshold=15
     ratio_threshold=3.0
+    #流水线各阶段间队列长度, 基站数据最大龄期(s)
+    pipeline_queue_size=8
+    max_base_age=30
     
     [SINS]
-    imr_file_path=
+    #IMU文件每行: 时间 三轴速度增量(m/s) 三轴角增量(rad), b系前右下
+    #binary为每个历元7个double, 顺序同上
+    imu_file_path=
+    imu_file_format=text
+    #纯惯导初始状态: 时间(周秒), 纬度经度(°), 高程(m), 北东地速度(m/s), 横滚俯仰航向(°)
+    #松组合模式下只使用横滚、俯仰, 以及低速时的航向
+    init_time=0
+    init_lat=
+    init_lon=
+    init_h=
+    init_vn=0
+    init_ve=0
+    init_vd=0
+    init_roll=0
+    init_pitch=0
+    init_yaw=0
+    #解算精度: double为全双精度, mixed为协方差和姿态更新用单精度, 位置仍为双精度
+    precision=double
+    #导航坐标系: ned为按BLH积分位置, ecef为在地心地固系下积分XYZ, 松组合的误差状态也在该坐标系下表示
+    frame=ned
+    
+    [LC]
+    #GNSS结果文件每行: 时间 ECEF坐标(m) ECEF速度(m/s)
+    gnss_file_path=
+    #GNSS位置标准差(m), 用速度确定初始航向的最小速度(m/s)
+    gnss_pos_std=0.05
+    gnss_hgt_std=0.1
+    align_speed=1.0
+    #误差状态维数: 15为位置、速度、姿态和陀螺、加表零偏, 18增加陀螺比例因子, 21再增加加表比例因子
+    state_dim=21
+    #IMU误差参数: ARW(deg/√h), VRW(m/s/√h), 零偏标准差(deg/h, mGal), 比例因子标准差(ppm), 相关时间(h)
+    arw=0.1
+    vrw=0.1
+    gyro_bias_std=50
+    acc_bias_std=250
+    gyro_scale_std=1000
+    acc_scale_std=1000
+    corr_time=1
+    #初始位置(m)、速度(m/s)、姿态(°)标准差
+    init_pos_std=1
+    init_vel_std=0.1
+    init_att_std=1
+    #协方差传播间隔: 最多每cov_decimation个IMU历元传播一次, 间隔内转角超过cov_max_angle(°)时提前传播, 0为不限制
+    #GNSS量测更新前总是先传播, 1为逐历元传播
+    cov_decimation=1
+    cov_max_angle=0
+    #过程噪声离散化: first_order为对角阵Q·Δt, van_loan为按IMU间隔缓存的精确解, 含位置、速度、姿态与零偏的互相关
+    qd_model=first_order
+    
+    [OUTPUT]
+    result_file_path=result.txt
+    
+    [SIM]
+    #仿真数据: IMU和GNSS文件写入[SINS] imu_file_path和[LC] gnss_file_path, 初始状态取[SINS]
+    seed=1
+    duration=3600
+    imu_rate=200
+    gnss_rate=1
+    #真值输出频率, 0为每个IMU历元
+    truth_rate=0
+    truth_file_path=truth.txt
+    #运动剖面, 循环执行: 时长(s),前向加速度(m/s²),航向角速度(°/s);...
+    profile=60,0,0;10,1,0;60,0,0;20,0,4.5;60,0,0;10,-1,0
+    #IMU误差: 常值零偏标准差(deg/h, mGal), 比例因子标准差(ppm), 马尔科夫零偏标准差(deg/h, mGal)及相关时间(h), ARW(deg/√h), VRW(m/s/√h)
+    gyro_bias_std=10
+    acc_bias_std=100
+    gyro_scale_std=100
+    acc_scale_std=100
+    gyro_drift_std=1
+    acc_drift_std=10
+    corr_time=1
+    arw=0.05
+    vrw=0.05
+    #GNSS噪声: 水平位置(m), 高程(m), 速度(m/s)
+    gnss_pos_std=0.02
+    gnss_hgt_std=0.04
+    gnss_vel_std=0.01
      */
      friend class BaseApp;
      
 public:
     bool ReadConfig(const std::string &filename);  // 读取配置文件并保存配置参数
-    std::string ReadString(const char *section, const char *item,
-                           const char *default_value) const;  // 读取类型为string的参数
-    int ReadInt(const char *section, const char *item,
+    std::string ReadString(std::string_view section, std::string_view item,
+                           std::string_view default_value) const;  // 读取类型为string的参数
+    int ReadInt(std::string_view section, std::string_view item,
                 const int &default_value) const;  // 读取类型为int的参数
-    float ReadFloat(const char *section, const char *item,
+    float ReadFloat(std::string_view section, std::string_view item,
                     const float &default_value) const;  // 读取类型为float的参数
+    double ReadDouble(std::string_view section, std::string_view item,
+                      const double &default_value) const;  // 读取类型为double的参数
+    const ConfigValue *Find(std::string_view section,
+                            std::string_view item) const;  // 查找参数, 不存在返回nullptr
+    void Set(std::string_view section, std::string_view item,
+             std::string_view text);  // 设置参数
+    
+    // 读取参数, 不存在时value不变并返回-1
+    int Get(std::string_view section, std::string_view item, std::string &value) const;
+    int Get(std::string_view section, std::string_view item, int &value) const;
+    int Get(std::string_view section, std::string_view item, float &value) const;
+    int Get(std::string_view section, std::string_view item, double &value) const;
+    int Get(std::string_view section, std::string_view item, bool &value) const;
+    
+    /**@brief       按绑定表读取参数结构体, 配置文件中没有的参数保持结构体中的默认值
+     * @param[in,out]   params      参数结构体
+     * @param[in]       bindings    成员与参数项的绑定
+     */
+    template<typename S, typename... T>
+    void Resolve(S &params, const ConfigBinding<S, T> &... bindings) const
+    {
+        (Get(bindings.section, bindings.item, params.*(bindings.member)), ...);
+    }
 
 private:
     bool isSpace(char c);  // 判断一个char类型变量是否为' '字符
@@ -76,14 +246,13 @@ private:
     bool AnalyseLine(const std::string &line, std::string &section,
                      std::string &key, std::string &value);  // 读取一行, 并对一行进行分析
     bool CreateDefaultConfig();  // 创建默认配置文件
+    static uint64_t Hash(std::string_view section, std::string_view item);  // 块.参数项的哈希值
+    int FindSlot(std::string_view section, std::string_view item,
+                 const uint64_t &hash) const;  // 查找参数所在的槽, 不存在时返回应插入的空槽
+    void Rehash(const int &slot_num);  // 扩容并重新插入
     
-    
-    // 参数设置, 支持块->参数项->参数值的存储模式
-    std::map<std::string, std::map<std::string, std::string> > settings_;
-
-    
-
-
+    std::vector<ConfigValue> values_{};  // 参数, 按首次出现的顺序存放
+    std::vector<int> slots_{};  // 哈希表, 存放values_的下标, -1为空, 大小为2的幂
 };
 
 
@@ -93,18 +262,18 @@ private:
  * <table>
  * <tr><th>Date         <th>Author      <th>Description
  * <tr><td>2022/5/29    <td>Zing Fong   <td>Initialize
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>实现了run, GnssApp和SinsApp改为在run中按模式创建
  * </table>
  */
 class BaseApp
 {
 public:
-    void run();  // 启动函数, 在此读取配置表并选择解算类型等
+    int run();  // 启动函数, 在此读取配置表并选择解算类型等
     
 private:
+    static double GetPeakRss();  // 进程内存占用峰值(MB)
+    
     Config config_{};  // 配置表
-    // GnssApp gnss_app_{};
-    // SinsApp sins_app_{};
-
 };
 
 
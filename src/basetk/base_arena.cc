@@ -0,0 +1,117 @@
+/**@file    base_arena.cc
+ * @brief   单历元临时区.cc文件
+ * @details 实现了按指针递增分配、溢出块管理和历元结束时的回收
+ * @author  Zing Fong\n
+ *          zing.fong.whu\@outlook.com
+ * @date    2026/10/18
+ * @version V1.0
+ **********************************************************************************
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Version  <th>Author     <th>Description
+ * <tr><td>2026/10/18   <td>1.0      <td>Zing Fong  <td>Initialize
+ * </table>
+ **********************************************************************************
+ */
+
+// 本类对应的.h文件
+#include "base_arena.h"
+// c/c++系统文件
+#include <cstdint>
+// 其他库的 .h 文件
+#include <algorithm>
+
+// 本项目内 .h 文件
+
+/**@brief       构造函数, 申请缓冲区
+ * @param[in]   capacity        缓冲区大小(字节), 为0时第一个历元全部使用溢出块, 之后按用量扩大
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+EpochArena::EpochArena(const size_t &capacity)
+        : buffer_(capacity > 0 ? new std::byte[capacity] : nullptr), capacity_(capacity)
+{
+    overflow_blocks_.reserve(16);
+}
+
+EpochArena::~EpochArena()
+{
+    Reset();
+}
+
+/**@brief       历元结束, 回收本历元分配的全部内存
+ * @details     有溢出时把缓冲区扩大为本历元用量的两倍, 之后同样规模的历元不再溢出
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void EpochArena::Reset()
+{
+    const size_t used = get_used();
+    peak_ = std::max(peak_, used);
+    for(const auto &block: overflow_blocks_)
+        std::pmr::new_delete_resource()->deallocate(block.ptr, block.bytes, block.alignment);
+    overflow_blocks_.clear();
+    if(overflow_bytes_ > 0)
+    {
+        capacity_ = 2*used;
+        buffer_.reset(new std::byte[capacity_]);
+    }
+    offset_ = 0;
+    overflow_bytes_ = 0;
+}
+
+/**@brief       分配内存: 缓冲区内按对齐要求移动指针, 缓冲区不够时申请溢出块
+ * @param[in]   bytes           字节数
+ * @param[in]   alignment       对齐要求, 为2的整数次幂
+ * @return      内存地址
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void *EpochArena::do_allocate(size_t bytes, size_t alignment)
+{
+    const auto base = reinterpret_cast<uintptr_t>(buffer_.get());
+    const size_t begin = ((base + offset_ + alignment - 1) & ~(alignment - 1)) - base;
+    if(buffer_ && begin + bytes <= capacity_)
+    {
+        offset_ = begin + bytes;
+        return buffer_.get() + begin;
+    }
+    void *ptr = std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    overflow_blocks_.push_back({ptr, bytes, alignment});
+    overflow_bytes_ += bytes;
+    ++overflow_num_;
+    return ptr;
+}
+
+/**@brief       释放为空操作, 内存在Reset时统一回收
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void EpochArena::do_deallocate(void * /*ptr*/, size_t /*bytes*/, size_t /*alignment*/)
+{
+}
+
+bool EpochArena::do_is_equal(const std::pmr::memory_resource &other) const noexcept
+{
+    return this == &other;
+}
+
+size_t EpochArena::get_capacity() const
+{
+    return capacity_;
+}
+
+size_t EpochArena::get_used() const
+{
+    return offset_ + overflow_bytes_;
+}
+
+size_t EpochArena::get_peak() const
+{
+    return peak_;
+}
+
+long EpochArena::get_overflow_num() const
+{
+    return overflow_num_;
+}
@@ -0,0 +1,82 @@
+/**@file    base_arena.h
+ * @brief   单历元临时区.h文件
+ * @details 按指针递增分配的内存资源, 供一个历元内的临时矩阵使用, 历元结束时整体回收
+ * @author  Zing Fong\n
+ *          zing.fong.whu\@outlook.com
+ * @date    2026/10/18
+ * @version V1.0
+ **********************************************************************************
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Version  <th>Author     <th>Description
+ * <tr><td>2026/10/18   <td>1.0      <td>Zing Fong  <td>Initialize
+ * </table>
+ **********************************************************************************
+ */
+#ifndef LOOSECOUPLED_SRC_BASETK_BASE_ARENA_H
+#define LOOSECOUPLED_SRC_BASETK_BASE_ARENA_H
+
+// c/c++系统文件
+#include <cstddef>
+
+// 其他库的 .h 文件
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+// 本项目内 .h 文件
+
+/**@class   EpochArena
+ * @brief   单历元临时区, 单调递增的内存资源
+ * @details 在预先申请的缓冲区中按指针递增分配, 释放为空操作, 历元结束时调用Reset一次性回收。
+ *          缓冲区不够时向全局堆申请溢出块; Reset时释放溢出块, 并把缓冲区扩大为本历元用量的两倍,
+ *          所以卫星数等维数稳定后, 每个历元的临时矩阵都不再访问全局堆。\n
+ *          Reset之后此前分配的内存全部失效, 其中的矩阵只能析构, 要保留的结果须赋值给使用全局堆的矩阵。
+ *          临时区须比从中分配的矩阵后析构。不是线程安全的, 每个线程使用自己的临时区
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Author      <th>Description
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>Initialize
+ * </table>
+ */
+class EpochArena : public std::pmr::memory_resource
+{
+  public:
+    static constexpr size_t kDefaultCapacity = 64*1024;  // 默认缓冲区大小(字节)
+    
+    explicit EpochArena(const size_t &capacity = kDefaultCapacity);
+    ~EpochArena() override;
+    EpochArena(const EpochArena &) = delete;
+    EpochArena &operator=(const EpochArena &) = delete;
+    
+    void Reset();  // 历元结束, 回收本历元分配的全部内存
+    
+    // get
+    size_t get_capacity() const;  // 缓冲区大小(字节)
+    size_t get_used() const;  // 本历元已分配的字节数, 含溢出块
+    size_t get_peak() const;  // 已结束的各历元中最大的用量
+    long get_overflow_num() const;  // 累计申请溢出块的次数
+  
+  private:
+    struct OverflowBlock
+    {
+        void *ptr;  // 地址
+        size_t bytes;  // 字节数
+        size_t alignment;  // 对齐
+    };
+    
+    void *do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void *ptr, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+    
+    std::unique_ptr<std::byte[]> buffer_{};  // 缓冲区
+    size_t capacity_{};  // 缓冲区大小
+    size_t offset_{};  // 缓冲区中下一次分配的起点
+    size_t overflow_bytes_{};  // 本历元溢出块的总字节数
+    size_t peak_{};  // 各历元最大用量
+    long overflow_num_{};  // 累计溢出次数
+    std::vector<OverflowBlock> overflow_blocks_{};  // 本历元的溢出块, Reset时释放
+};
+
+
+#endif //LOOSECOUPLED_SRC_BASETK_BASE_ARENA_H
@@ -0,0 +1,189 @@
+/**@file    base_config_watcher.cc
+ * @brief   配置文件热更新.cc文件
+ * @details 实现了配置文件的监视、重新读取和快照发布
+ * @author  Zing Fong\n
+ *          zing.fong.whu\@outlook.com
+ * @date    2026/10/18
+ * @version V1.0
+ **********************************************************************************
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Version  <th>Author     <th>Description
+ * <tr><td>2026/10/18   <td>1.0      <td>Zing Fong  <td>Initialize
+ * </table>
+ **********************************************************************************
+ */
+
+// 本类对应的.h文件
+#include "base_config_watcher.h"
+// c/c++系统文件
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+// 其他库的 .h 文件
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+
+// 本项目内 .h 文件
+
+ConfigWatcher::~ConfigWatcher()
+{
+    Stop();
+}
+
+/**@brief       以config为初始快照开始监视配置文件
+ * @param[in]   file_path       配置文件路径
+ * @param[in]   config          已读取的配置表, 作为版本0
+ * @return      0为正常
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int ConfigWatcher::Start(const std::string &file_path, const Config &config)
+{
+    Stop();
+    file_path_ = file_path;
+    stop_ = false;
+    Publish(std::make_unique<const Config>(config));
+    version_ = 0;
+
+    std::error_code error{};
+    last_write_time_ = std::filesystem::last_write_time(file_path_, error);
+#ifdef __linux__
+    // 监视所在目录, 编辑器保存时常先写临时文件再改名覆盖
+    auto dir = std::filesystem::path(file_path_).parent_path();
+    if(dir.empty())
+        dir = ".";
+    inotify_fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if(inotify_fd_ >= 0 &&
+       inotify_add_watch(inotify_fd_, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0)
+    {
+        close(inotify_fd_);
+        inotify_fd_ = -1;
+    }
+#endif
+    if(inotify_fd_ < 0)
+        printf("Watching %s by polling its modification time\n", file_path_.c_str());
+    thread_ = std::thread(&ConfigWatcher::WatchLoop, this);
+    return 0;
+}
+
+/**@brief       停止监视, 已发布的快照保留到析构
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void ConfigWatcher::Stop()
+{
+    stop_ = true;
+    if(thread_.joinable())
+        thread_.join();
+#ifdef __linux__
+    if(inotify_fd_ >= 0)
+        close(inotify_fd_);
+#endif
+    inotify_fd_ = -1;
+}
+
+/**@brief       监视线程, 文件变化后重新读取
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void ConfigWatcher::WatchLoop()
+{
+    while(!stop_)
+    {
+        bool changed = inotify_fd_ >= 0 ? WaitInotify() : WaitPolling();
+        if(changed && !stop_)
+            Reload();
+    }
+}
+
+/**@brief       用inotify等待文件变化, 最多等待200ms以便及时响应停止
+ * @return      true为配置文件有变化
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+bool ConfigWatcher::WaitInotify()
+{
+    bool changed = false;
+#ifdef __linux__
+    pollfd poll_fd{inotify_fd_, POLLIN, 0};
+    if(poll(&poll_fd, 1, 200) <= 0)
+        return false;
+    auto file_name = std::filesystem::path(file_path_).filename().string();
+    alignas(inotify_event) char buffer[4096];
+    ssize_t length;
+    while((length = read(inotify_fd_, buffer, sizeof(buffer))) > 0)
+    {
+        for(char *ptr = buffer; ptr < buffer + length;)
+        {
+            const auto *event = reinterpret_cast<const inotify_event *>(ptr);
+            if(event->len > 0 && file_name == event->name)
+                changed = true;
+            ptr += sizeof(inotify_event) + event->len;
+        }
+    }
+#endif
+    return changed;
+}
+
+/**@brief       按修改时间轮询, 每秒检查一次
+ * @return      true为配置文件有变化
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+bool ConfigWatcher::WaitPolling()
+{
+    for(int i = 0; i < 10 && !stop_; ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    std::error_code error{};
+    auto write_time = std::filesystem::last_write_time(file_path_, error);
+    if(error || write_time == last_write_time_)
+        return false;
+    last_write_time_ = write_time;
+    return true;
+}
+
+/**@brief       重新读取配置文件并发布, 文件无法打开时保留当前快照
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void ConfigWatcher::Reload()
+{
+    if(!std::ifstream(file_path_))
+    {
+        printf("Cannot open config file! file path: %s\n", file_path_.c_str());
+        return;
+    }
+    auto config = std::make_unique<Config>();
+    if(!config->ReadConfig(file_path_))
+        return;
+    Publish(std::move(config));
+    printf("Config reloaded: %s, version %llu\n", file_path_.c_str(),
+           static_cast<unsigned long long>(get_version()));
+}
+
+/**@brief       发布快照: 先更新指针, 再递增版本号
+ * @details     读取方先读版本号再读指针, 所以看到新版本号时一定能取到不旧于该版本的快照
+ * @param[in]   config      新快照
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void ConfigWatcher::Publish(std::unique_ptr<const Config> config)
+{
+    snapshots_.push_back(std::move(config));
+    config_.store(snapshots_.back().get(), std::memory_order_release);
+    version_.fetch_add(1, std::memory_order_release);
+}
+
+const Config *ConfigWatcher::get_config() const
+{
+    return config_.load(std::memory_order_acquire);
+}
+
+uint64_t ConfigWatcher::get_version() const
+{
+    return version_.load(std::memory_order_acquire);
+}
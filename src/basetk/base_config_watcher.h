@@ -0,0 +1,76 @@
+/**@file    base_config_watcher.h
+ * @brief   配置文件热更新.h文件
+ * @details 监视配置文件, 文件修改后重新读取并发布新的只读快照, 解算线程在历元间隙无锁地取用
+ * @author  Zing Fong\n
+ *          zing.fong.whu\@outlook.com
+ * @date    2026/10/18
+ * @version V1.0
+ **********************************************************************************
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Version  <th>Author     <th>Description
+ * <tr><td>2026/10/18   <td>1.0      <td>Zing Fong  <td>Initialize
+ * </table>
+ **********************************************************************************
+ */
+#ifndef LOOSECOUPLED_SRC_BASETK_BASE_CONFIG_WATCHER_H
+#define LOOSECOUPLED_SRC_BASETK_BASE_CONFIG_WATCHER_H
+
+// c/c++系统文件
+#include <thread>
+
+// 其他库的 .h 文件
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+// 本项目内 .h 文件
+#include "base_app.h"
+
+/**@class   ConfigWatcher
+ * @brief   配置文件监视器
+ * @details 后台线程监视配置文件(Linux下用inotify监视所在目录, 以便兼容编辑器先写临时文件再改名的保存方式;
+ *          其他平台或inotify不可用时每秒检查一次修改时间)。文件变化后重新读取为新的Config,
+ *          通过原子指针发布, 并递增版本号。\n
+ *          读取方先比较版本号(一次原子读), 有变化时再取快照指针, 读路径上没有锁。旧快照保留到监视器析构,
+ *          所以已取得的指针一直有效, 不需要引用计数或等待读者退出。
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Author      <th>Description
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>Initialize
+ * </table>
+ */
+class ConfigWatcher
+{
+  public:
+    ~ConfigWatcher();
+
+    int Start(const std::string &file_path, const Config &config);  // 以config为初始快照开始监视
+    void Stop();  // 停止监视
+
+    // get
+    const Config *get_config() const;  // 当前快照
+    uint64_t get_version() const;  // 快照版本号, 每次重新读取后加1
+
+  private:
+    void WatchLoop();  // 监视线程
+    bool WaitInotify();  // 用inotify等待文件变化, 超时返回false
+    bool WaitPolling();  // 按修改时间轮询等待文件变化, 超时返回false
+    void Reload();  // 重新读取并发布快照
+    void Publish(std::unique_ptr<const Config> config);  // 发布快照
+
+    std::string file_path_{};  // 配置文件路径
+    std::thread thread_{};  // 监视线程
+    std::atomic<bool> stop_{false};  // 是否停止
+    std::atomic<const Config *> config_{nullptr};  // 当前快照
+    std::atomic<uint64_t> version_{0};  // 快照版本号
+    std::vector<std::unique_ptr<const Config>> snapshots_{};  // 所有快照, 只由监视线程追加, 析构时释放
+    int inotify_fd_ = -1;  // inotify文件描述符, -1为使用轮询
+    std::filesystem::file_time_type last_write_time_{};  // 轮询时上次的修改时间
+};
+
+
+#endif //LOOSECOUPLED_SRC_BASETK_BASE_CONFIG_WATCHER_H
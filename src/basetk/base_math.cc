@@ -11,6 +11,8 @@
  * <tr><th>Date         <th>Version  <th>Author     <th>Description
  * <tr><td>2022/6/5     <td>1.0      <td>Zing Fong  <td>Initialize
  * <tr><td>2022/6/11    <td>1.0      <td>Zing Fong  <td>修正了四元数和旋转矢量的转换函数
+ * <tr><td>2026/10/18   <td>1.1      <td>Zing Fong  <td>四元数和姿态转换函数改为元素类型的模板
+ * <tr><td>2026/10/18   <td>1.2      <td>Zing Fong  <td>增加了CalcCne和CalcGeXyz
  * </table>
  **********************************************************************************
  */
@@ -325,11 +327,12 @@ std::vector<double> BaseMath::Enu2Ecef(const std::vector<double> &ref_xyz,
  * @author      Zing Fong
  * @date        2022/6/2
  */
-std::vector<double> BaseMath::QuaternionMul(
-        const std::vector<double> &quaternion1,
-        const std::vector<double> &quaternion2)
+template<typename T>
+std::vector<T> BaseMath::QuaternionMul(
+        const std::vector<T> &quaternion1,
+        const std::vector<T> &quaternion2)
 {
-    std::vector<double> result(4, 0.0);
+    std::vector<T> result(4, 0.0);
     
     if(quaternion1.size() != 4 || quaternion2.size() != 4)
     {
@@ -340,8 +343,8 @@ std::vector<double> BaseMath::QuaternionMul(
     }
     
     // 起别名, 方便书写
-    const std::vector<double> &p = quaternion1;
-    const std::vector<double> &q = quaternion2;
+    const std::vector<T> &p = quaternion1;
+    const std::vector<T> &q = quaternion2;
     
     result[0] = p[0]*q[0] - p[1]*q[1] - p[2]*q[2] - p[3]*q[3];
     result[1] = p[0]*q[1] + p[1]*q[0] + p[2]*q[3] - p[3]*q[2];
@@ -363,9 +366,10 @@ std::vector<double> BaseMath::QuaternionMul(
  * @author      Zing Fong
  * @date        2022/6/2
  */
-double BaseMath::Norm(const std::vector<double> &vector)
+template<typename T>
+T BaseMath::Norm(const std::vector<T> &vector)
 {
-    double norm{};
+    T norm{};
     for(const auto &a_vec: vector)
         norm += a_vec*a_vec;  // 平方和
     norm = sqrt(norm);
@@ -378,9 +382,10 @@ double BaseMath::Norm(const std::vector<double> &vector)
  * @author      Zing Fong
  * @date        2022/6/5
  */
-void BaseMath::Normalize(std::vector<double> &vector)
+template<typename T>
+void BaseMath::Normalize(std::vector<T> &vector)
 {
-    double norm = Norm(vector);;  // 取模
+    T norm = Norm(vector);;  // 取模
     for(auto &a_vec: vector)
         a_vec /= norm;
 }
@@ -390,7 +395,8 @@ void BaseMath::Normalize(std::vector<double> &vector)
  * @author      Zing Fong
  * @date        2022/6/5
  */
-void BaseMath::QuaternionNormalize(std::vector<double> &quaternion)
+template<typename T>
+void BaseMath::QuaternionNormalize(std::vector<T> &quaternion)
 {
     if(quaternion[0] < 0)
     {
@@ -409,23 +415,24 @@ void BaseMath::QuaternionNormalize(std::vector<double> &quaternion)
  * @author      Zing Fong
  * @date        2022/6/5
  */
-BaseMatrix BaseMath::Euler2RotationMat(const std::vector<double> &euler)
+template<typename T>
+BaseMatrixT<T> BaseMath::Euler2RotationMat(const std::vector<T> &euler)
 {
     if(euler.size() != 3)
     {
         // 传入参数错误
         printf("Euler2RotationMat error.\n");
-        return BaseMatrix::eye(3);
+        return BaseMatrixT<T>::eye(3);
     }
-    const double roll = euler[0];
-    const double pitch = euler[1];
-    const double yaw = euler[2];
+    const T roll = euler[0];
+    const T pitch = euler[1];
+    const T yaw = euler[2];
     // PPT上公式用的字母, 这样方便书写和检查
-    const double &psi = yaw;
-    const double &theta = pitch;
-    const double &phi = roll;
+    const T &psi = yaw;
+    const T &theta = pitch;
+    const T &phi = roll;
     
-    BaseMatrix rotation(3, 3);
+    BaseMatrixT<T> rotation(3, 3);
     rotation.write(0, 0, cos(theta)*cos(psi));
     rotation.write(0, 1, -cos(phi)*sin(psi) + sin(phi)*sin(theta)*cos(psi));
     rotation.write(0, 2, sin(phi)*sin(psi) + cos(phi)*sin(theta)*cos(psi));
@@ -450,17 +457,18 @@ BaseMatrix BaseMath::Euler2RotationMat(const std::vector<double> &euler)
  * @author      Zing Fong
  * @date        2022/6/5
  */
-std::vector<double> BaseMath::RotationMat2Euler(const BaseMatrix &rotation_mat)
+template<typename T>
+std::vector<T> BaseMath::RotationMat2Euler(const BaseMatrixT<T> &rotation_mat)
 {
     if(rotation_mat.get_col_num() != 3 || rotation_mat.get_row_num() != 3)
     {
         // 传入参数错误
         printf("RotationMat2Euler error. c_b_n size: %d×%d\n",
                rotation_mat.get_row_num(), rotation_mat.get_col_num());
-        return std::vector<double>(3, 0.0);
+        return std::vector<T>(3, 0.0);
     }
-    std::vector<double> euler(3, 0.0);
-    const BaseMatrix &R = rotation_mat;  // PPT上公式所用字母, 方便书写与检查
+    std::vector<T> euler(3, 0.0);
+    const BaseMatrixT<T> &R = rotation_mat;  // PPT上公式所用字母, 方便书写与检查
     euler[1] = atan2(-R.read(2, 0),
                      sqrt(R.read(2, 1)*R.read(2, 1) +
                           R.read(2, 2)*R.read(2, 2)));
@@ -476,19 +484,20 @@ std::vector<double> BaseMath::RotationMat2Euler(const BaseMatrix &rotation_mat)
  * @author      Zing Fong
  * @date        2022/6/5
  */
-std::vector<double> BaseMath::Euler2Quaternion(const std::vector<double> &euler)
+template<typename T>
+std::vector<T> BaseMath::Euler2Quaternion(const std::vector<T> &euler)
 {
     if(euler.size() != 3)
     {
         // 传入参数错误
         printf("Euler2Quaternion error.\n");
-        return std::vector<double>(4, 0.0);
+        return std::vector<T>(4, 0.0);
     }
-    const double &phi = euler[0];
-    const double &theta = euler[1];
-    const double &psi = euler[2];
+    const T &phi = euler[0];
+    const T &theta = euler[1];
+    const T &psi = euler[2];
     
-    std::vector<double> q(4, 0.0);  // b系相对于R系的姿态四元数
+    std::vector<T> q(4, 0.0);  // b系相对于R系的姿态四元数
     q[0] = cos(phi/2)*cos(theta/2)*cos(psi/2)
            + sin(phi/2)*sin(theta/2)*sin(psi/2);
     q[1] = sin(phi/2)*cos(theta/2)*cos(psi/2)
@@ -508,17 +517,18 @@ std::vector<double> BaseMath::Euler2Quaternion(const std::vector<double> &euler)
  * @author      Zing Fong
  * @date        2022/6/5
  */
-std::vector<double> BaseMath::Quaternion2Euler(
-        const std::vector<double> &quaternion)
+template<typename T>
+std::vector<T> BaseMath::Quaternion2Euler(
+        const std::vector<T> &quaternion)
 {
     if(quaternion.size() != 4)
     {
         // 传入参数错误
         printf("Quaternion2Euler error.\n");
-        return std::vector<double>(3, 0.0);
+        return std::vector<T>(3, 0.0);
     }
-    const std::vector<double> &q = quaternion;  // 四元数, 别名
-    std::vector<double> euler(3, 0.0);  // 欧拉角
+    const std::vector<T> &q = quaternion;  // 四元数, 别名
+    std::vector<T> euler(3, 0.0);  // 欧拉角
     euler[0] = atan2(2*(q[0]*q[1] + q[2]*q[3]), 1 - 2*(q[1]*q[1] + q[2]*q[2]));
     euler[1] = asin(2*(q[0]*q[2] - q[3]*q[1]));
     euler[2] = atan2(2*(q[0]*q[3] + q[1]*q[2]), 1 - 2*(q[2]*q[2] + q[3]*q[3]));
@@ -532,23 +542,24 @@ std::vector<double> BaseMath::Quaternion2Euler(
  * @author      Zing Fong
  * @date        2022/6/5
  */
-BaseMatrix BaseMath::Quaternion2RotationMat(
-        const std::vector<double> &quaternion)
+template<typename T>
+BaseMatrixT<T> BaseMath::Quaternion2RotationMat(
+        const std::vector<T> &quaternion)
 {
     if(quaternion.size() != 4)
     {
         // 传入参数错误
         printf("Quaternion2RotationMat error.\n");
-        return BaseMatrix(3, 3);
+        return BaseMatrixT<T>(3, 3);
     }
-    BaseMatrix C_b_R(3, 3);
-    const std::vector<double> &q = quaternion;
+    BaseMatrixT<T> C_b_R(3, 3);
+    const std::vector<T> &q = quaternion;
     // 方便书写
-    double q1q1 = q[0]*q[0], q2q2 = q[1]*q[1],
+    T q1q1 = q[0]*q[0], q2q2 = q[1]*q[1],
             q3q3 = q[2]*q[2], q4q4 = q[3]*q[3];
-    double q1q2 = q[0]*q[1], q1q3 = q[0]*q[2], q1q4 = q[0]*q[3];
-    double q2q3 = q[1]*q[2], q2q4 = q[1]*q[3];
-    double q3q4 = q[2]*q[3];
+    T q1q2 = q[0]*q[1], q1q3 = q[0]*q[2], q1q4 = q[0]*q[3];
+    T q2q3 = q[1]*q[2], q2q4 = q[1]*q[3];
+    T q3q4 = q[2]*q[3];
     // 为方向余弦矩阵各项赋值
     C_b_R.write(0, 0, q1q1 + q2q2 - q3q3 - q4q4);
     C_b_R.write(0, 1, 2*(q2q3 - q1q4));
@@ -571,20 +582,21 @@ BaseMatrix BaseMath::Quaternion2RotationMat(
  * @author      Zing Fong
  * @date        2022/6/5
  */
-std::vector<double> BaseMath::RotationMat2Quaternion(
-        const BaseMatrix &rotation_mat)
+template<typename T>
+std::vector<T> BaseMath::RotationMat2Quaternion(
+        const BaseMatrixT<T> &rotation_mat)
 {
     if(rotation_mat.get_row_num() != 3 || rotation_mat.get_col_num() != 3)
     {
         printf("RotationMat2Quaternion error.\n");
-        return std::vector<double>(4, 0.0);
+        return std::vector<T>(4, 0.0);
     }
-    const BaseMatrix &c = rotation_mat;
-    double p1 = 1 + c.Trace();
-    double p2 = 1 + 2*c.read(0, 0) - c.Trace();
-    double p3 = 1 + 2*c.read(1, 1) - c.Trace();
-    double p4 = 1 + 2*c.read(2, 2) - c.Trace();
-    double q1{}, q2{}, q3{}, q4{};  // 四元数
+    const BaseMatrixT<T> &c = rotation_mat;
+    T p1 = 1 + c.Trace();
+    T p2 = 1 + 2*c.read(0, 0) - c.Trace();
+    T p3 = 1 + 2*c.read(1, 1) - c.Trace();
+    T p4 = 1 + 2*c.read(2, 2) - c.Trace();
+    T q1{}, q2{}, q3{}, q4{};  // 四元数
     if(p1 == max({p1, p2, p3, p4}))
     {
         q1 = 0.5*sqrt(p1);
@@ -613,7 +625,7 @@ std::vector<double> BaseMath::RotationMat2Quaternion(
         q2 = (c.read(0, 2) + c.read(2, 0))/(4*q4);
         q3 = (c.read(2, 1) + c.read(1, 2))/(4*q4);
     }
-    std::vector<double> result{q1, q2, q3, q4};
+    std::vector<T> result{q1, q2, q3, q4};
     QuaternionNormalize(result);
     return result;
 }
@@ -624,26 +636,27 @@ std::vector<double> BaseMath::RotationMat2Quaternion(
  * @author      Zing Fong
  * @date        2022/6/11
  */
-std::vector<double> BaseMath::Quaternion2RotationVec(
-        const std::vector<double> &quaternion)
+template<typename T>
+std::vector<T> BaseMath::Quaternion2RotationVec(
+        const std::vector<T> &quaternion)
 {
     if(quaternion.size() != 4)
     {
         // 传入参数错误
         printf("Quaternion2RotationVec error.\n");
-        return std::vector<double>(3, 0.0);
+        return std::vector<T>(3, 0.0);
     }
-    const std::vector<double> &q = quaternion;
-    const double &q1 = q[0], &q2 = q[1], &q3 = q[2], &q4 = q[3];  // 方便书写
-    double half_phi_norm = acos(q1);  // 模长的一半
+    const std::vector<T> &q = quaternion;
+    const T &q1 = q[0], &q2 = q[1], &q3 = q[2], &q4 = q[3];  // 方便书写
+    T half_phi_norm = acos(q1);  // 模长的一半
     if(fabs(half_phi_norm) < 1e-12)  // 旋转矢量为0, 直接返回
-        return std::vector<double>{0.0, 0.0, 0.0};
-    double f = 2*half_phi_norm/sin(half_phi_norm);
-    double pi = BaseSdc::kPi;  // 方便书写
+        return std::vector<T>{0.0, 0.0, 0.0};
+    T f = 2*half_phi_norm/sin(half_phi_norm);
+    T pi = BaseSdc::kPi;  // 方便书写
     if(q1 == 0)
-        return std::vector<double>{q2*pi, q3*pi, q4*pi};
+        return std::vector<T>{q2*pi, q3*pi, q4*pi};
     else
-        return std::vector<double>{q2*f, q3*f, q4*f};
+        return std::vector<T>{q2*f, q3*f, q4*f};
 }
 
 /**@brief       旋转矢量转四元数
@@ -652,21 +665,22 @@ std::vector<double> BaseMath::Quaternion2RotationVec(
  * @author      Zing Fong
  * @date        2022/6/11
  */
-std::vector<double> BaseMath::RotationVec2Quaternion(
-        const std::vector<double> &rotation_vec)
+template<typename T>
+std::vector<T> BaseMath::RotationVec2Quaternion(
+        const std::vector<T> &rotation_vec)
 {
     if(rotation_vec.size() != 3)
     {
         // 传入参数错误
         printf("RotationVec2Quaternion error.\n");
-        return std::vector<double>(4, 0.0);
+        return std::vector<T>(4, 0.0);
     }
-    const std::vector<double> &phi = rotation_vec;  // 方便书写
-    std::vector<double> q(4, 0.0);  // 返回的结果
-    double phi_norm = Norm(phi);
+    const std::vector<T> &phi = rotation_vec;  // 方便书写
+    std::vector<T> q(4, 0.0);  // 返回的结果
+    T phi_norm = Norm(phi);
     if(fabs(phi_norm) < 1e-12)  // 旋转矢量为0, 直接返回
-        return std::vector<double>{1.0, 0.0, 0.0, 0.0};
-    double f = sin(0.5*phi_norm)/(phi_norm);  // 注意这里把书上公式里的0.5约掉了
+        return std::vector<T>{1.0, 0.0, 0.0, 0.0};
+    T f = sin(0.5*phi_norm)/(phi_norm);  // 注意这里把书上公式里的0.5约掉了
     q[0] = cos(0.5*phi_norm);
     q[1] = f*phi[0];
     q[2] = f*phi[1];
@@ -681,22 +695,23 @@ std::vector<double> BaseMath::RotationVec2Quaternion(
  * @author      Zing Fong
  * @date        2022/6/5
  */
-BaseMatrix BaseMath::RotationVec2RotationMat(
-        const std::vector<double> &rotation_vec)
+template<typename T>
+BaseMatrixT<T> BaseMath::RotationVec2RotationMat(
+        const std::vector<T> &rotation_vec)
 {
     if(rotation_vec.size() != 3)
     {
         // 传入参数错误
         printf("RotationVec2RotationMat error.\n");
-        return BaseMatrix(3, 3);
+        return BaseMatrixT<T>(3, 3);
     }
-    const std::vector<double> &phi = rotation_vec;
-    BaseMatrix antisymmetric_mat =
-            BaseMatrix::CalcAntisymmetryMat(phi);  // 反对称矩阵
-    double norm = Norm(phi);  // 模长
-    double scalar1 = sin(norm)/norm;
-    double scalar2 = (1 - cos(norm))/(norm*norm);
-    BaseMatrix C_b_R = BaseMatrix::eye(3) + antisymmetric_mat*scalar1
+    const std::vector<T> &phi = rotation_vec;
+    BaseMatrixT<T> antisymmetric_mat =
+            BaseMatrixT<T>::CalcAntisymmetryMat(phi);  // 反对称矩阵
+    T norm = Norm(phi);  // 模长
+    T scalar1 = sin(norm)/norm;
+    T scalar2 = (1 - cos(norm))/(norm*norm);
+    BaseMatrixT<T> C_b_R = BaseMatrixT<T>::eye(3) + antisymmetric_mat*scalar1
                        + antisymmetric_mat*antisymmetric_mat*scalar2;
     return C_b_R;
 }
@@ -707,19 +722,55 @@ BaseMatrix BaseMath::RotationVec2RotationMat(
  * @author      Zing Fong
  * @date        2022/6/5
  */
-std::vector<double> BaseMath::RotationMat2RotationVec(
-        const BaseMatrix &rotation_mat)
+template<typename T>
+std::vector<T> BaseMath::RotationMat2RotationVec(
+        const BaseMatrixT<T> &rotation_mat)
 {
     if(rotation_mat.get_row_num() != 3 || rotation_mat.get_col_num() != 3)
     {
         printf("RotationMat2RotationVec error.\n");
-        return std::vector<double>(3, 0.0);
+        return std::vector<T>(3, 0.0);
     }
     // 这里没有直接实现的路径, 只能以四元数为媒介
-    std::vector<double> q = RotationMat2Quaternion(rotation_mat);
+    std::vector<T> q = RotationMat2Quaternion(rotation_mat);
     return Quaternion2RotationVec(q);
 }
 
+// 姿态相关的函数模板只实例化double和float两种
+#define LC_INSTANTIATE_ATTITUDE(T) \
+    template std::vector<T> BaseMath::QuaternionMul(const std::vector<T> &, const std::vector<T> &); \
+    template T BaseMath::Norm(const std::vector<T> &); \
+    template void BaseMath::Normalize(std::vector<T> &); \
+    template void BaseMath::QuaternionNormalize(std::vector<T> &); \
+    template BaseMatrixT<T> BaseMath::Euler2RotationMat(const std::vector<T> &); \
+    template std::vector<T> BaseMath::RotationMat2Euler(const BaseMatrixT<T> &); \
+    template std::vector<T> BaseMath::Euler2Quaternion(const std::vector<T> &); \
+    template std::vector<T> BaseMath::Quaternion2Euler(const std::vector<T> &); \
+    template BaseMatrixT<T> BaseMath::Quaternion2RotationMat(const std::vector<T> &); \
+    template std::vector<T> BaseMath::RotationMat2Quaternion(const BaseMatrixT<T> &); \
+    template std::vector<T> BaseMath::Quaternion2RotationVec(const std::vector<T> &); \
+    template std::vector<T> BaseMath::RotationVec2Quaternion(const std::vector<T> &); \
+    template BaseMatrixT<T> BaseMath::RotationVec2RotationMat(const std::vector<T> &); \
+    template std::vector<T> BaseMath::RotationMat2RotationVec(const BaseMatrixT<T> &);
+LC_INSTANTIATE_ATTITUDE(double)
+LC_INSTANTIATE_ATTITUDE(float)
+#undef LC_INSTANTIATE_ATTITUDE
+
+/**@brief       n系(北东地)到e系的旋转矩阵C_n^e
+ * @param[in]   blh          大地坐标BLH
+ * @return      C_n^e, 各列依次为北、东、地方向在e系下的单位矢量
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+BaseMatrix BaseMath::CalcCne(const std::vector<double> &blh)
+{
+    double sin_b = sin(blh[0]), cos_b = cos(blh[0]);
+    double sin_l = sin(blh[1]), cos_l = cos(blh[1]);
+    return BaseMatrix({-sin_b*cos_l, -sin_l, -cos_b*cos_l,
+                       -sin_b*sin_l, cos_l, -cos_b*sin_l,
+                       cos_b, 0.0, -sin_b}, 3, 3);
+}
+
 /**@brief       e系下的重力加速度矢量计算
  * @param[in]   blh          已知大地坐标BLH
  * @return      e系下的重力加速度矢量
@@ -752,6 +803,38 @@ std::vector<double> BaseMath::CalcGe(const std::vector<double> &blh)
     return ge;
 }
 
+/**@brief       由ECEF坐标计算e系下的重力加速度矢量, 引力取WGS84正常重力场的J2、J4项, 加上离心力
+ * @details     只用到开方, 不需要先转换为大地坐标, 用于ECEF系机械编排。
+ *              与CalcGn的正常重力公式在地面附近相差约2e-6m/s², 高度1km时约1e-5m/s²(CalcGn不计铅垂线的弯曲)
+ * @param[in]   xyz          ECEF坐标(m)
+ * @return      e系下的重力加速度矢量(m/s²)
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+std::vector<double> BaseMath::CalcGeXyz(const std::vector<double> &xyz)
+{
+    const double j2 = 1.082629821e-3;  // WGS84正常重力场二阶带谐系数
+    const double j4 = -2.37091222e-6;  // WGS84正常重力场四阶带谐系数
+    const double &a = BaseSdc::wgs84.kA;
+    const double &gm = BaseSdc::wgs84.kGm;
+    const double &omega_e = BaseSdc::wgs84.kOmega;
+    const double &x = xyz[0], &y = xyz[1], &z = xyz[2];
+    double r2 = x*x + y*y + z*z;
+    double r = sqrt(r2);
+    double a2_r2 = a*a/r2;
+    double k2 = 1.5*j2*a2_r2;  // 1.5·J2·(a/r)²
+    double k4 = 0.625*j4*a2_r2*a2_r2;  // 5/8·J4·(a/r)⁴
+    double s2 = z*z/r2;  // 地心纬度正弦的平方
+    double mu_r3 = gm/(r2*r);
+    double f_xy = 1 + k2*(1 - 5*s2) - k4*(3 - 42*s2 + 63*s2*s2);
+    double f_z = 1 + k2*(3 - 5*s2) - k4*(15 - 70*s2 + 63*s2*s2);
+    std::vector<double> ge(3, 0.0);
+    ge[0] = -mu_r3*x*f_xy + omega_e*omega_e*x;
+    ge[1] = -mu_r3*y*f_xy + omega_e*omega_e*y;
+    ge[2] = -mu_r3*z*f_z;
+    return ge;
+}
+
 /**@brief       n系下的重力加速度矢量计算
  * @param[in]   blh          已知大地坐标BLH
  * @return      n系下的重力加速度矢量
@@ -11,6 +11,8 @@
  * <tr><th>Date         <th>Version  <th>Author     <th>Description
  * <tr><td>2022/5/27    <td>1.0      <td>Zing Fong  <td>Initialize
  * <tr><td>2022/6/5     <td>1.1      <td>Zing Fong  <td>修正了对constexpr变量引用的错误
+ * <tr><td>2026/10/18   <td>1.2      <td>Zing Fong  <td>四元数和姿态转换函数改为元素类型的模板
+ * <tr><td>2026/10/18   <td>1.3      <td>Zing Fong  <td>增加了n系到e系的旋转矩阵和由ECEF坐标计算的重力
  * </table>
  **********************************************************************************
  */
@@ -36,6 +38,8 @@
  * <tr><td>2022/6/10    <td>Zing Fong   <td>将max和min函数的参数类型更改为vector
  * <tr><td>2022/6/12    <td>Zing Fong   <td>增加了计算n系重力加速度矢量的函数
  * <tr><td>2022/6/14    <td>Zing Fong   <td>增加了NED系和ENU系相互转换的函数
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>四元数和姿态转换函数改为模板, 实例化double和float, 坐标转换仍只用double
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>增加了CalcCne和CalcGeXyz, 用于ECEF系机械编排
  * </table>
  */
 class BaseMath
@@ -61,41 +65,57 @@ class BaseMath
     static std::vector<double> Enu2Ned(const std::vector<double> &enu);  // ENU转NED
     static std::vector<double> Enu2Ecef(const std::vector<double> &ref_xyz,
                                         const std::vector<double> &enu);  // ENU系下某个向量转ECEF系
+    static BaseMatrix CalcCne(const std::vector<double> &blh);  // n系(NED)到e系的旋转矩阵
     
-    // 四元数相关运算
-    static std::vector<double> QuaternionMul(
-            const std::vector<double> &quaternion1,
-            const std::vector<double> &quaternion2);  // 四元数乘法
-    static double Norm(const std::vector<double> &vector);  // 向量取模
-    static void Normalize(std::vector<double> &vector);  // 向量归一化
-    static void QuaternionNormalize(std::vector<double> &quaternion);  // 四元数归一化
+    // 四元数相关运算, T为double或float
+    template<typename T = double>
+    static std::vector<T> QuaternionMul(
+            const std::vector<T> &quaternion1,
+            const std::vector<T> &quaternion2);  // 四元数乘法
+    template<typename T = double>
+    static T Norm(const std::vector<T> &vector);  // 向量取模
+    template<typename T = double>
+    static void Normalize(std::vector<T> &vector);  // 向量归一化
+    template<typename T = double>
+    static void QuaternionNormalize(std::vector<T> &quaternion);  // 四元数归一化
     
     // 姿态转换
     // 欧拉角排列顺序roll, pitch, yaw
     // 旋转顺序R(yaw, pitch, roll)
-    static BaseMatrix Euler2RotationMat(
-            const std::vector<double> &euler);  // 欧拉角转旋转矩阵
-    static std::vector<double> RotationMat2Euler(
-            const BaseMatrix &rotation_mat);  // 旋转矩阵转欧拉角
-    static std::vector<double> Euler2Quaternion(
-            const std::vector<double> &euler);  // 欧拉角转四元数
-    static std::vector<double> Quaternion2Euler(
-            const std::vector<double> &quaternion);  // 四元数转欧拉角
-    static BaseMatrix Quaternion2RotationMat(
-            const std::vector<double> &quaternion);  // 四元数转旋转矩阵
-    static std::vector<double> RotationMat2Quaternion(
-            const BaseMatrix &rotation_mat);  // 旋转矩阵转四元数
-    static std::vector<double> Quaternion2RotationVec(
-            const std::vector<double> &quaternion);  // 四元数转旋转矢量
-    static std::vector<double> RotationVec2Quaternion(
-            const std::vector<double> &rotation_vec);  // 旋转矢量转四元数
-    static BaseMatrix RotationVec2RotationMat(
-            const std::vector<double> &rotation_vec);  // 旋转矢量转旋转矩阵
-    static std::vector<double> RotationMat2RotationVec(
-            const BaseMatrix &rotation_mat);  // 旋转矩阵转旋转矢量
+    template<typename T = double>
+    static BaseMatrixT<T> Euler2RotationMat(
+            const std::vector<T> &euler);  // 欧拉角转旋转矩阵
+    template<typename T = double>
+    static std::vector<T> RotationMat2Euler(
+            const BaseMatrixT<T> &rotation_mat);  // 旋转矩阵转欧拉角
+    template<typename T = double>
+    static std::vector<T> Euler2Quaternion(
+            const std::vector<T> &euler);  // 欧拉角转四元数
+    template<typename T = double>
+    static std::vector<T> Quaternion2Euler(
+            const std::vector<T> &quaternion);  // 四元数转欧拉角
+    template<typename T = double>
+    static BaseMatrixT<T> Quaternion2RotationMat(
+            const std::vector<T> &quaternion);  // 四元数转旋转矩阵
+    template<typename T = double>
+    static std::vector<T> RotationMat2Quaternion(
+            const BaseMatrixT<T> &rotation_mat);  // 旋转矩阵转四元数
+    template<typename T = double>
+    static std::vector<T> Quaternion2RotationVec(
+            const std::vector<T> &quaternion);  // 四元数转旋转矢量
+    template<typename T = double>
+    static std::vector<T> RotationVec2Quaternion(
+            const std::vector<T> &rotation_vec);  // 旋转矢量转四元数
+    template<typename T = double>
+    static BaseMatrixT<T> RotationVec2RotationMat(
+            const std::vector<T> &rotation_vec);  // 旋转矢量转旋转矩阵
+    template<typename T = double>
+    static std::vector<T> RotationMat2RotationVec(
+            const BaseMatrixT<T> &rotation_mat);  // 旋转矩阵转旋转矢量
     
     static std::vector<double> CalcGe(const std::vector<double> &blh);  // e系下的重力加速度矢量计算
     static std::vector<double> CalcGn(const std::vector<double> &blh);  // n系吓得重力加速度计算
+    static std::vector<double> CalcGeXyz(const std::vector<double> &xyz);  // 由ECEF坐标计算e系下的重力(J2、J4)
 };
 
 
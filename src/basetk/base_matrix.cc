@@ -11,6 +11,14 @@
  * <tr><th>Date        <th>Version  <th>Author     <th>Description
  * <tr><td>2022/6/1    <td>1.0      <td>Zing Fong  <td>Initialize
  * <tr><td>2022/6/5    <td>1.1      <td>Zing Fong  <td>加入了矩阵求迹函数
+ * <tr><td>2026/10/18  <td>1.2      <td>Zing Fong  <td>按行跨度存储, 原地增删行列
+ * <tr><td>2026/10/18  <td>1.3      <td>Zing Fong  <td>增加了移动语义和Gemm、Syrk、Symm、Axpy、Scale
+ * <tr><td>2026/10/18  <td>1.4      <td>Zing Fong  <td>增加了运行时大小的子矩阵视图
+ * <tr><td>2026/10/18  <td>1.5      <td>Zing Fong  <td>存储改为std::pmr::vector, 运算结果使用左操作数的内存资源
+ * <tr><td>2026/10/18  <td>1.6      <td>Zing Fong  <td>大维数运算调用BLAS/LAPACK, 增加了Solve和Cholesky
+ * <tr><td>2026/10/18  <td>1.7      <td>Zing Fong  <td>改为模板实现, 显式实例化double和float
+ * <tr><td>2026/10/18  <td>1.8      <td>Zing Fong  <td>增加了矩阵指数Exp
+ * <tr><td>2026/10/18  <td>1.9      <td>Zing Fong  <td>修正了BLAS求逆结果丢失内存资源的问题
  * </table>
  **********************************************************************************
  */
@@ -21,88 +29,271 @@
 #include <iostream>
 #include <iomanip>
 // 其他库的 .h 文件
+#include <algorithm>
 #include <cmath>
+#include <utility>
 
 // 本项目内 .h 文件
 
+#ifdef LC_USE_BLAS
+// BLAS/LAPACK的Fortran接口, 矩阵按列优先存储。行优先存储的矩阵按列优先解释即为其转置, 行跨度即leading dimension
+extern "C"
+{
+void dgemm_(const char *trans_a, const char *trans_b, const int *m, const int *n, const int *k,
+            const double *alpha, const double *a, const int *lda, const double *b, const int *ldb,
+            const double *beta, double *c, const int *ldc);
+void sgemm_(const char *trans_a, const char *trans_b, const int *m, const int *n, const int *k,
+            const float *alpha, const float *a, const int *lda, const float *b, const int *ldb,
+            const float *beta, float *c, const int *ldc);
+void dsyrk_(const char *uplo, const char *trans, const int *n, const int *k,
+            const double *alpha, const double *a, const int *lda,
+            const double *beta, double *c, const int *ldc);
+void ssyrk_(const char *uplo, const char *trans, const int *n, const int *k,
+            const float *alpha, const float *a, const int *lda,
+            const float *beta, float *c, const int *ldc);
+void dsymm_(const char *side, const char *uplo, const int *m, const int *n,
+            const double *alpha, const double *a, const int *lda, const double *b, const int *ldb,
+            const double *beta, double *c, const int *ldc);
+void ssymm_(const char *side, const char *uplo, const int *m, const int *n,
+            const float *alpha, const float *a, const int *lda, const float *b, const int *ldb,
+            const float *beta, float *c, const int *ldc);
+void dgetrf_(const int *m, const int *n, double *a, const int *lda, int *ipiv, int *info);
+void sgetrf_(const int *m, const int *n, float *a, const int *lda, int *ipiv, int *info);
+void dgetri_(const int *n, double *a, const int *lda, const int *ipiv,
+             double *work, const int *lwork, int *info);
+void sgetri_(const int *n, float *a, const int *lda, const int *ipiv,
+             float *work, const int *lwork, int *info);
+void dgetrs_(const char *trans, const int *n, const int *nrhs, const double *a, const int *lda,
+             const int *ipiv, double *b, const int *ldb, int *info);
+void sgetrs_(const char *trans, const int *n, const int *nrhs, const float *a, const int *lda,
+             const int *ipiv, float *b, const int *ldb, int *info);
+void dpotrf_(const char *uplo, const int *n, double *a, const int *lda, int *info);
+void spotrf_(const char *uplo, const int *n, float *a, const int *lda, int *info);
+}
+
+namespace
+{
+// 按元素类型选择d、s两种版本, 参数与Fortran接口相同
+void BlasGemm(const char *trans_a, const char *trans_b, const int *m, const int *n, const int *k,
+              const double *alpha, const double *a, const int *lda, const double *b, const int *ldb,
+              const double *beta, double *c, const int *ldc)
+{
+    dgemm_(trans_a, trans_b, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+void BlasGemm(const char *trans_a, const char *trans_b, const int *m, const int *n, const int *k,
+              const float *alpha, const float *a, const int *lda, const float *b, const int *ldb,
+              const float *beta, float *c, const int *ldc)
+{
+    sgemm_(trans_a, trans_b, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+void BlasSyrk(const char *uplo, const char *trans, const int *n, const int *k,
+              const double *alpha, const double *a, const int *lda,
+              const double *beta, double *c, const int *ldc)
+{
+    dsyrk_(uplo, trans, n, k, alpha, a, lda, beta, c, ldc);
+}
+
+void BlasSyrk(const char *uplo, const char *trans, const int *n, const int *k,
+              const float *alpha, const float *a, const int *lda,
+              const float *beta, float *c, const int *ldc)
+{
+    ssyrk_(uplo, trans, n, k, alpha, a, lda, beta, c, ldc);
+}
+
+void BlasSymm(const char *side, const char *uplo, const int *m, const int *n,
+              const double *alpha, const double *a, const int *lda, const double *b, const int *ldb,
+              const double *beta, double *c, const int *ldc)
+{
+    dsymm_(side, uplo, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+void BlasSymm(const char *side, const char *uplo, const int *m, const int *n,
+              const float *alpha, const float *a, const int *lda, const float *b, const int *ldb,
+              const float *beta, float *c, const int *ldc)
+{
+    ssymm_(side, uplo, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+void LapackGetrf(const int *m, const int *n, double *a, const int *lda, int *ipiv, int *info)
+{
+    dgetrf_(m, n, a, lda, ipiv, info);
+}
+
+void LapackGetrf(const int *m, const int *n, float *a, const int *lda, int *ipiv, int *info)
+{
+    sgetrf_(m, n, a, lda, ipiv, info);
+}
+
+void LapackGetri(const int *n, double *a, const int *lda, const int *ipiv,
+                 double *work, const int *lwork, int *info)
+{
+    dgetri_(n, a, lda, ipiv, work, lwork, info);
+}
+
+void LapackGetri(const int *n, float *a, const int *lda, const int *ipiv,
+                 float *work, const int *lwork, int *info)
+{
+    sgetri_(n, a, lda, ipiv, work, lwork, info);
+}
+
+void LapackGetrs(const char *trans, const int *n, const int *nrhs, const double *a, const int *lda,
+                 const int *ipiv, double *b, const int *ldb, int *info)
+{
+    dgetrs_(trans, n, nrhs, a, lda, ipiv, b, ldb, info);
+}
+
+void LapackGetrs(const char *trans, const int *n, const int *nrhs, const float *a, const int *lda,
+                 const int *ipiv, float *b, const int *ldb, int *info)
+{
+    sgetrs_(trans, n, nrhs, a, lda, ipiv, b, ldb, info);
+}
+
+void LapackPotrf(const char *uplo, const int *n, double *a, const int *lda, int *info)
+{
+    dpotrf_(uplo, n, a, lda, info);
+}
+
+void LapackPotrf(const char *uplo, const int *n, float *a, const int *lda, int *info)
+{
+    spotrf_(uplo, n, a, lda, info);
+}
+}
+#endif
+
+#ifndef LC_BLAS_THRESHOLD
+#define LC_BLAS_THRESHOLD 64
+#endif
+namespace
+{
+int blas_threshold = LC_BLAS_THRESHOLD;  // 交给BLAS/LAPACK的最小维数, 各元素类型共用
+}
+
 /**@brief          构造函数
  * @param[in]      mat          用于构造矩阵的一维数组
  * @param[in]      row_num      矩阵行数
  * @param[in]      col_num      矩阵列数
+ * @param[in]      resource     元素存储使用的内存资源
  * @author      Zing Fong
  * @date        2022/6/1
  */
-BaseMatrix::BaseMatrix(const std::vector<double> &mat,
-                       const int &row_num, const int &col_num)
+template<typename T>
+BaseMatrixT<T>::BaseMatrixT(const std::vector<T> &mat,
+                            const int &row_num, const int &col_num,
+                            std::pmr::memory_resource *resource)
+        : mat_(resource)
 {
     if(row_num > 0 && col_num > 0 &&
        mat.size() == row_num*col_num)  // 行列数不为零, 且与数组元素匹配
     {
         row_num_ = row_num;
         col_num_ = col_num;
-        mat_ = mat;
+        ld_ = col_num;
+        mat_.assign(mat.begin(), mat.end());
     }
     else
     {
         printf("Constructor error!\n");
-        *this = BaseMatrix();  // 默认构造
+        *this = BaseMatrixT<T>();  // 默认构造
     }
 }
 
 /**@brief          全零构造函数
  * @param[in]      row_num      矩阵行数
  * @param[in]      col_num      矩阵列数
+ * @param[in]      resource     元素存储使用的内存资源
  * @author      Zing Fong
  * @date        2022/6/1
  */
-BaseMatrix::BaseMatrix(const int &row_num, const int &col_num)
+template<typename T>
+BaseMatrixT<T>::BaseMatrixT(const int &row_num, const int &col_num,
+                            std::pmr::memory_resource *resource)
+        : mat_(resource)
 {
     if(row_num > 0 && col_num > 0)  // 行列数均不为0
     {
         row_num_ = row_num;
         col_num_ = col_num;
-        mat_ = std::vector<double>(row_num_*col_num_, 0.0);
+        ld_ = col_num;
+        mat_.assign(row_num_*col_num_, 0.0);
     }
     else
     {
         printf("Constructor error!\n");
-        *this = BaseMatrix();  // 默认构造
+        *this = BaseMatrixT<T>();  // 默认构造
     }
 }
 
-/**@brief          拷贝构造函数
+/**@brief          拷贝构造函数, 结果为紧凑存储, 不保留源矩阵的空余容量
+ * @details        与std::pmr容器相同, 拷贝使用默认内存资源, 不沿用源矩阵的内存资源
  * @param[in]      src          源矩阵
  * @author      Zing Fong
  * @date        2022/6/1
  */
-BaseMatrix::BaseMatrix(const BaseMatrix &src)
+template<typename T>
+BaseMatrixT<T>::BaseMatrixT(const BaseMatrixT<T> &src)
+        : BaseMatrixT<T>(src, std::pmr::get_default_resource())
+{
+}
+
+/**@brief          指定内存资源的拷贝构造函数, 结果为紧凑存储
+ * @param[in]      src          源矩阵
+ * @param[in]      resource     元素存储使用的内存资源
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename T>
+BaseMatrixT<T>::BaseMatrixT(const BaseMatrixT<T> &src, std::pmr::memory_resource *resource)
+        : mat_(resource)
 {
     if(src.row_num_ > 0 && src.col_num_ > 0)  // 行列数均不为0
     {
         row_num_ = src.row_num_;
         col_num_ = src.col_num_;
-        mat_ = src.mat_;
+        ld_ = src.col_num_;
+        mat_.resize(row_num_*col_num_);
+        for(int i = 0; i < row_num_; ++i)
+            std::copy_n(src.mat_.begin() + i*src.ld_, col_num_, mat_.begin() + i*ld_);
     }
     else
     {
         printf("Constructor error!\n");
-        *this = BaseMatrix();  // 默认构造
+        *this = BaseMatrixT<T>();  // 默认构造
     }
 }
 
+/**@brief          移动构造函数, 接管源矩阵的存储和内存资源
+ * @details        源矩阵变为0×0的空矩阵, 之后只能重新赋值或析构
+ * @param[in]      src          源矩阵
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename T>
+BaseMatrixT<T>::BaseMatrixT(BaseMatrixT<T> &&src) noexcept
+        : row_num_(src.row_num_), col_num_(src.col_num_), ld_(src.ld_),
+          mat_(std::move(src.mat_))
+{
+    src.row_num_ = src.col_num_ = 0;
+    src.ld_ = 1;
+    src.mat_.clear();
+}
+
 /**@brief           单位阵
  * @param[in]       n          单位阵维数, > 0
+ * @param[in]       resource   元素存储使用的内存资源
  * @return          返回结果\n
  * - n > 0(成功)      一个n×n维的单位阵\n
  * - n < 0(失败)      默认构造1×1矩阵\n
  * @author      Zing Fong
  * @date        2022/6/1
  */
-BaseMatrix BaseMatrix::eye(const int &n)
+template<typename T>
+BaseMatrixT<T> BaseMatrixT<T>::eye(const int &n, std::pmr::memory_resource *resource)
 {
     if(n > 0)
     {
-        BaseMatrix eye_mat(n, n);
+        BaseMatrixT<T> eye_mat(n, n, resource);
         for(int i = 0; i < n; ++i)
             eye_mat.write(i, i, 1);  // 对角线写入元素
         return eye_mat;
@@ -114,16 +305,19 @@ BaseMatrix BaseMatrix::eye(const int &n)
 /**@brief           全零阵
  * @param[in]       row_num         矩阵行数
  * @param[in]       col_num         矩阵列数
+ * @param[in]       resource        元素存储使用的内存资源
  * @return          返回结果\n
  * - n > 0(成功)     一个row_num×col_num维的全零阵\n
  * - n < 0(失败)     默认构造1×1矩阵\n
  * @author      Zing Fong
  * @date        2022/6/1
  */
-BaseMatrix BaseMatrix::zeros(const int &row_num, const int &col_num)
+template<typename T>
+BaseMatrixT<T> BaseMatrixT<T>::zeros(const int &row_num, const int &col_num,
+                                     std::pmr::memory_resource *resource)
 {
     if(row_num > 0 && col_num > 0)
-        return BaseMatrix(row_num, col_num);
+        return BaseMatrixT<T>(row_num, col_num, resource);
     else
     {
         printf("Constructor error!\n");
@@ -139,11 +333,12 @@ BaseMatrix BaseMatrix::zeros(const int &row_num, const int &col_num)
  * @author          Zing Fong
  * @date            2022/6/1
  */
-BaseMatrix BaseMatrix::CalcAntisymmetryMat(const std::vector<double> &vec)
+template<typename T>
+BaseMatrixT<T> BaseMatrixT<T>::CalcAntisymmetryMat(const std::vector<T> &vec)
 {
     if(vec.size() == 3)  // 确实是三维向量
     {
-        BaseMatrix result(3, 3);
+        BaseMatrixT<T> result(3, 3);
         result.write(0, 1, -vec[2]);
         result.write(0, 2, vec[1]);
         result.write(1, 0, vec[2]);
@@ -169,16 +364,17 @@ BaseMatrix BaseMatrix::CalcAntisymmetryMat(const std::vector<double> &vec)
  * @author          Zing Fong
  * @date            2022/6/12
  */
-std::vector<double> BaseMatrix::CrossProduct(const std::vector<double> &vec1,
-                                             const std::vector<double> &vec2)
+template<typename T>
+std::vector<T> BaseMatrixT<T>::CrossProduct(const std::vector<T> &vec1,
+                                            const std::vector<T> &vec2)
 {
     if(vec1.size() != 3 || vec2.size() != 3)
     {
         // 不是两个三维向量
         printf("CrossProduct error!\n");
-        return std::vector<double>(3, 0.0);
+        return std::vector<T>(3, 0.0);
     }
-    std::vector<double> result(3, 0.0);
+    std::vector<T> result(3, 0.0);
     result[0] = vec1[1]*vec2[2] - vec1[2]*vec2[1];
     result[1] = -(vec1[0]*vec2[2] - vec1[2]*vec2[0]);
     result[2] = vec1[0]*vec2[1] - vec1[1]*vec2[0];
@@ -193,8 +389,9 @@ std::vector<double> BaseMatrix::CrossProduct(const std::vector<double> &vec1,
  * @author          Zing Fong
  * @date            2022/6/12
  */
-std::vector<double> BaseMatrix::VectorAdd(const std::vector<double> &vec1,
-                                          const std::vector<double> &vec2)
+template<typename T>
+std::vector<T> BaseMatrixT<T>::VectorAdd(const std::vector<T> &vec1,
+                                         const std::vector<T> &vec2)
 {
     if(vec1.empty() || vec2.empty() || vec1.size() != vec2.size())
     {
@@ -203,7 +400,7 @@ std::vector<double> BaseMatrix::VectorAdd(const std::vector<double> &vec1,
                vec1.size(), vec2.size());
         return {};  //
     }
-    std::vector<double> result(vec1.size(), 0.0);
+    std::vector<T> result(vec1.size(), 0.0);
     for(int i = 0; i < vec1.size(); ++i)
         result[i] = vec1[i] + vec2[i];
     return result;
@@ -216,8 +413,9 @@ std::vector<double> BaseMatrix::VectorAdd(const std::vector<double> &vec1,
  * @author          Zing Fong
  * @date            2022/6/12
  */
-std::vector<double> BaseMatrix::VectorSub(const std::vector<double> &vec1,
-                                          const std::vector<double> &vec2)
+template<typename T>
+std::vector<T> BaseMatrixT<T>::VectorSub(const std::vector<T> &vec1,
+                                         const std::vector<T> &vec2)
 {
     if(vec1.empty() || vec2.empty() || vec1.size() != vec2.size())
     {
@@ -226,7 +424,7 @@ std::vector<double> BaseMatrix::VectorSub(const std::vector<double> &vec1,
                vec1.size(), vec2.size());
         return {};  //
     }
-    std::vector<double> result(vec1.size(), 0.0);
+    std::vector<T> result(vec1.size(), 0.0);
     for(int i = 0; i < vec1.size(); ++i)
         result[i] = vec1[i] - vec2[i];
     return result;
@@ -238,23 +436,350 @@ std::vector<double> BaseMatrix::VectorSub(const std::vector<double> &vec1,
  * @author          Zing Fong
  * @date            2022/6/18
  */
-BaseMatrix BaseMatrix::Diag(const std::vector<double> &vec)
+template<typename T>
+BaseMatrixT<T> BaseMatrixT<T>::Diag(const std::vector<T> &vec)
 {
     auto size = vec.size();
-    BaseMatrix diag(size, size);
+    BaseMatrixT<T> diag(size, size);
     for(int i = 0; i < size; ++i)
         diag.write(i, i, vec[i]);
     
     return diag;
 }
 
+/**@brief       通用矩阵乘法 C = α·op(A)·op(B) + β·C
+ * @details     op(X)为X或Xᵀ。β为0时C按结果重设行列数且不读取原有元素, 否则C的行列数须与结果一致。
+ *              op(B)不转置时按行累加, 并跳过op(A)中的零元素, F阵、Φ阵等稀疏矩阵可以省去大部分乘法
+ * @param[in]   alpha       op(A)·op(B)的系数
+ * @param[in]   a           矩阵A
+ * @param[in]   trans_a     true为使用Aᵀ
+ * @param[in]   b           矩阵B
+ * @param[in]   trans_b     true为使用Bᵀ
+ * @param[in]   beta        C的系数
+ * @param[out]  c           结果矩阵, 不能与A、B为同一个对象
+ * @return      返回结果:\n
+ * -   0        正常
+ * -  -1        行列数不匹配或C与A、B为同一个对象, C不变
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename T>
+int BaseMatrixT<T>::Gemm(const T &alpha, const BaseMatrixT<T> &a, const bool &trans_a,
+                         const BaseMatrixT<T> &b, const bool &trans_b,
+                         const T &beta, BaseMatrixT<T> &c)
+{
+    const int m = trans_a ? a.col_num_ : a.row_num_;  // op(A)行数
+    const int n = trans_a ? a.row_num_ : a.col_num_;  // op(A)列数
+    const int nb = trans_b ? b.col_num_ : b.row_num_;  // op(B)行数
+    const int p = trans_b ? b.row_num_ : b.col_num_;  // op(B)列数
+    if(n != nb || &c == &a || &c == &b ||
+       (beta != 0.0 && (c.row_num_ != m || c.col_num_ != p)))
+    {
+        printf("Gemm error! op(A) size: %d×%d, op(B) size: %d×%d, C size: %d×%d\n",
+               m, n, nb, p, c.row_num_, c.col_num_);
+        return -1;
+    }
+    if(beta == 0.0)
+        c.Reshape(m, p);
+#ifdef LC_USE_BLAS
+    if(UseBlas(m, p, n))
+    {
+        // 按列优先解释时三个矩阵都是转置, 即计算Cᵀ = α·op(B)ᵀ·op(A)ᵀ + β·Cᵀ。β为0时BLAS不读取C
+        const char trans_bt = trans_b ? 'T' : 'N', trans_at = trans_a ? 'T' : 'N';
+        BlasGemm(&trans_bt, &trans_at, &p, &m, &n, &alpha, b.mat_.data(), &b.ld_,
+                 a.mat_.data(), &a.ld_, &beta, c.mat_.data(), &c.ld_);
+        return 0;
+    }
+#endif
+    Scale(beta, c);
+    
+    const int ras = trans_a ? 1 : a.ld_, cas = trans_a ? a.ld_ : 1;  // op(A)的行、列步长
+    const int ldb = b.ld_, ldc = c.ld_;
+    const T *pa = a.mat_.data(), *pb = b.mat_.data();
+    T *pc = c.mat_.data();
+    if(!trans_b)
+    {
+        for(int i = 0; i < m; ++i)
+            for(int k = 0; k < n; ++k)
+            {
+                const T aik = alpha*pa[i*ras + k*cas];
+                if(aik == 0.0)
+                    continue;
+                for(int j = 0; j < p; ++j)
+                    pc[i*ldc + j] += aik*pb[k*ldb + j];
+            }
+    }
+    else
+    {
+        // Bᵀ的第j列即B的第j行, 按行做内积。每次算4个内积, op(A)的元素读一次用四次
+        for(int i = 0; i < m; ++i)
+        {
+            int j = 0;
+            for(; j + 4 <= p; j += 4)
+            {
+                const T *b0 = pb + j*ldb, *b1 = b0 + ldb, *b2 = b1 + ldb, *b3 = b2 + ldb;
+                T sum0 = 0.0, sum1 = 0.0, sum2 = 0.0, sum3 = 0.0;
+                for(int k = 0; k < n; ++k)
+                {
+                    const T aik = pa[i*ras + k*cas];
+                    sum0 += aik*b0[k];
+                    sum1 += aik*b1[k];
+                    sum2 += aik*b2[k];
+                    sum3 += aik*b3[k];
+                }
+                pc[i*ldc + j] += alpha*sum0;
+                pc[i*ldc + j + 1] += alpha*sum1;
+                pc[i*ldc + j + 2] += alpha*sum2;
+                pc[i*ldc + j + 3] += alpha*sum3;
+            }
+            for(; j < p; ++j)
+            {
+                T sum = 0.0;
+                for(int k = 0; k < n; ++k)
+                    sum += pa[i*ras + k*cas]*pb[j*ldb + k];
+                pc[i*ldc + j] += alpha*sum;
+            }
+        }
+    }
+    return 0;
+}
+
+/**@brief       对称秩k更新 C = α·op(A)·op(A)ᵀ + β·C
+ * @details     只计算下三角再复制到上三角, 结果严格对称。β不为0时只读取C的下三角
+ * @param[in]   alpha       op(A)·op(A)ᵀ的系数
+ * @param[in]   a           矩阵A
+ * @param[in]   trans_a     true为使用Aᵀ, 即C = α·Aᵀ·A + β·C
+ * @param[in]   beta        C的系数
+ * @param[out]  c           结果矩阵, 不能与A为同一个对象
+ * @return      返回结果:\n
+ * -   0        正常
+ * -  -1        行列数不匹配或C与A为同一个对象, C不变
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename T>
+int BaseMatrixT<T>::Syrk(const T &alpha, const BaseMatrixT<T> &a, const bool &trans_a,
+                         const T &beta, BaseMatrixT<T> &c)
+{
+    const int m = trans_a ? a.col_num_ : a.row_num_;  // op(A)行数
+    const int n = trans_a ? a.row_num_ : a.col_num_;  // op(A)列数
+    if(&c == &a || (beta != 0.0 && (c.row_num_ != m || c.col_num_ != m)))
+    {
+        printf("Syrk error! op(A) size: %d×%d, C size: %d×%d\n",
+               m, n, c.row_num_, c.col_num_);
+        return -1;
+    }
+    if(beta == 0.0)
+        c.Reshape(m, m);
+#ifdef LC_USE_BLAS
+    if(UseBlas(m, m, n))
+    {
+        // C的下三角按列优先解释为上三角; A按列优先解释为Aᵀ, 所以转置标志与trans_a相反
+        const char uplo = 'U', trans = trans_a ? 'N' : 'T';
+        BlasSyrk(&uplo, &trans, &m, &n, &alpha, a.mat_.data(), &a.ld_, &beta, c.mat_.data(), &c.ld_);
+        for(int i = 1; i < m; ++i)
+            for(int j = 0; j < i; ++j)
+                c.mat_[j*c.ld_ + i] = c.mat_[i*c.ld_ + j];
+        return 0;
+    }
+#endif
+    
+    const int ras = trans_a ? 1 : a.ld_, cas = trans_a ? a.ld_ : 1;  // op(A)的行、列步长
+    const int ldc = c.ld_;
+    const T *pa = a.mat_.data();
+    T *pc = c.mat_.data();
+    for(int i = 0; i < m; ++i)
+        for(int j = 0; j <= i; ++j)
+        {
+            T sum = 0.0;
+            for(int k = 0; k < n; ++k)
+                sum += pa[i*ras + k*cas]*pa[j*ras + k*cas];
+            T val = alpha*sum;
+            if(beta != 0.0)
+                val += beta*pc[i*ldc + j];
+            pc[i*ldc + j] = pc[j*ldc + i] = val;
+        }
+    return 0;
+}
+
+/**@brief       对称矩阵乘法 C = α·A·B + β·C 或 C = α·B·A + β·C
+ * @details     A为对称阵, 只读取其下三角。β为0时C按结果重设行列数且不读取原有元素。
+ *              左乘时按行累加并跳过A中的零元素, 右乘时按A的下三角逐行读取
+ * @param[in]   left        true为A在左边, 即C = α·A·B + β·C
+ * @param[in]   alpha       乘积的系数
+ * @param[in]   a           对称阵A
+ * @param[in]   b           矩阵B
+ * @param[in]   beta        C的系数
+ * @param[out]  c           结果矩阵, 不能与A、B为同一个对象
+ * @return      返回结果:\n
+ * -   0        正常
+ * -  -1        行列数不匹配或C与A、B为同一个对象, C不变
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename T>
+int BaseMatrixT<T>::Symm(const bool &left, const T &alpha, const BaseMatrixT<T> &a,
+                         const BaseMatrixT<T> &b, const T &beta, BaseMatrixT<T> &c)
+{
+    const int m = b.row_num_, p = b.col_num_;  // 结果与B的行列数相同
+    if(a.row_num_ != a.col_num_ || a.row_num_ != (left ? m : p) ||
+       &c == &a || &c == &b || (beta != 0.0 && (c.row_num_ != m || c.col_num_ != p)))
+    {
+        printf("Symm error! A size: %d×%d, B size: %d×%d, C size: %d×%d\n",
+               a.row_num_, a.col_num_, m, p, c.row_num_, c.col_num_);
+        return -1;
+    }
+    if(beta == 0.0)
+        c.Reshape(m, p);
+#ifdef LC_USE_BLAS
+    if(UseBlas(m, p, left ? m : p))
+    {
+        // 按列优先解释时Cᵀ = α·Bᵀ·A + β·Cᵀ(left)或α·A·Bᵀ + β·Cᵀ, A的下三角即列优先的上三角
+        const char side = left ? 'R' : 'L', uplo = 'U';
+        BlasSymm(&side, &uplo, &p, &m, &alpha, a.mat_.data(), &a.ld_, b.mat_.data(), &b.ld_,
+                 &beta, c.mat_.data(), &c.ld_);
+        return 0;
+    }
+#endif
+    Scale(beta, c);
+    
+    const int lda = a.ld_, ldb = b.ld_, ldc = c.ld_;
+    const T *pa = a.mat_.data(), *pb = b.mat_.data();
+    T *pc = c.mat_.data();
+    if(left)
+    {
+        for(int i = 0; i < m; ++i)
+            for(int k = 0; k < m; ++k)
+            {
+                const T aik = alpha*(k <= i ? pa[i*lda + k] : pa[k*lda + i]);
+                if(aik == 0.0)
+                    continue;
+                for(int j = 0; j < p; ++j)
+                    pc[i*ldc + j] += aik*pb[k*ldb + j];
+            }
+    }
+    else
+    {
+        // 下三角第k行的元素A(k,j)(j ≤ k)既贡献C(i,j) += B(i,k)·A(k,j),
+        // 又作为A(j,k)贡献C(i,k) += B(i,j)·A(k,j)(j < k), 两部分都按行连续读取
+        for(int i = 0; i < m; ++i)
+        {
+            const T *bi = pb + i*ldb;
+            T *ci = pc + i*ldc;
+            for(int k = 0; k < p; ++k)
+            {
+                const T *ak = pa + k*lda;
+                T sum = 0.0;
+                for(int j = 0; j < k; ++j)
+                    sum += bi[j]*ak[j];
+                ci[k] += alpha*sum;
+                const T bik = alpha*bi[k];
+                if(bik == 0.0)
+                    continue;
+                for(int j = 0; j <= k; ++j)
+                    ci[j] += bik*ak[j];
+            }
+        }
+    }
+    return 0;
+}
+
+/**@brief       Y = α·X + Y
+ * @param[in]   alpha       X的系数
+ * @param[in]   x           矩阵X
+ * @param[out]  y           矩阵Y, 行列数须与X一致
+ * @return      返回结果:\n
+ * -   0        正常
+ * -  -1        行列数不匹配, Y不变
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename T>
+int BaseMatrixT<T>::Axpy(const T &alpha, const BaseMatrixT<T> &x, BaseMatrixT<T> &y)
+{
+    if(x.row_num_ != y.row_num_ || x.col_num_ != y.col_num_)
+    {
+        printf("Axpy error! X size: %d×%d, Y size: %d×%d\n",
+               x.row_num_, x.col_num_, y.row_num_, y.col_num_);
+        return -1;
+    }
+    for(int i = 0; i < y.row_num_; ++i)
+        for(int j = 0; j < y.col_num_; ++j)
+            y.mat_[i*y.ld_ + j] += alpha*x.mat_[i*x.ld_ + j];
+    return 0;
+}
+
+/**@brief       X = α·X
+ * @details     α为0时直接置零, 不会因为X中的inf、nan得到nan
+ * @param[in]   alpha       系数
+ * @param[out]  x           矩阵X
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename T>
+void BaseMatrixT<T>::Scale(const T &alpha, BaseMatrixT<T> &x)
+{
+    if(alpha == 1.0)
+        return;
+    for(int i = 0; i < x.row_num_; ++i)
+    {
+        T *row = x.mat_.data() + i*x.ld_;
+        if(alpha == 0.0)
+            std::fill_n(row, x.col_num_, 0.0);
+        else
+            for(int j = 0; j < x.col_num_; ++j)
+                row[j] *= alpha;
+    }
+}
+
+template<typename T>
+int BaseMatrixT<T>::get_blas_threshold()
+{
+    return blas_threshold;
+}
+
+/**@brief       设置交给BLAS/LAPACK的最小维数
+ * @details     各线程共用, 只应在启动时或没有其他线程做矩阵运算时修改。未定义LC_USE_BLAS时不起作用
+ * @param[in]   threshold   最小维数, 乘法按m·n·k ≥ threshold³判断, 求逆、解方程、分解按方阵维数判断
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename T>
+void BaseMatrixT<T>::set_blas_threshold(const int &threshold)
+{
+    blas_threshold = threshold;
+}
+
+/**@brief       m×k与k×n的乘法是否交给BLAS/LAPACK
+ * @details     小矩阵调用BLAS的开销(参数检查、分块、打包)大于计算量, 按乘法次数与阈值的立方比较,
+ *              细长的矩阵(如n×3)不会因为一维很大就交给BLAS
+ * @param[in]   m           结果的行数
+ * @param[in]   n           结果的列数
+ * @param[in]   k           累加的长度
+ * @return      true为交给BLAS/LAPACK
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename T>
+bool BaseMatrixT<T>::UseBlas(const int &m, const int &n, const int &k)
+{
+#ifdef LC_USE_BLAS
+    const double threshold = blas_threshold;
+    return static_cast<double>(m)*n*k >= threshold*threshold*threshold;
+#else
+    (void)m, (void)n, (void)k;
+    return false;
+#endif
+}
+
 /**@brief           矩阵显示函数
  * @param[in]       width            输出位宽, 默认为9
  * @param[in]       precise          输出精度, 默认为4
  * @author      Zing Fong
  * @date        2022/6/1
  */
-void BaseMatrix::disp(int width, int precise) const
+template<typename T>
+void BaseMatrixT<T>::disp(int width, int precise) const
 {
     for(int i = 0; i < row_num_; ++i)
     {
@@ -275,10 +800,11 @@ void BaseMatrix::disp(int width, int precise) const
  * @author      Zing Fong
  * @date        2022/6/1
  */
-double BaseMatrix::read(const int &row, const int &col) const
+template<typename T>
+T BaseMatrixT<T>::read(const int &row, const int &col) const
 {
     if(row < row_num_ && col < col_num_)
-        return mat_[row*col_num_ + col];
+        return mat_[row*ld_ + col];
     else
     {
         printf("Read matrix error!\n");
@@ -293,26 +819,86 @@ double BaseMatrix::read(const int &row, const int &col) const
  * @author      Zing Fong
  * @date        2022/6/1
  */
-void BaseMatrix::write(const int &row, const int &col, const double &val)
+template<typename T>
+void BaseMatrixT<T>::write(const int &row, const int &col, const T &val)
 {
     if(row < row_num_ && col < col_num_)
-        mat_[row*col_num_ + col] = val;
+        mat_[row*ld_ + col] = val;
     else
         printf("Write matrix error!\n");
 }
 
+/**@brief       运行时大小的子矩阵视图
+ * @param[in]   row         左上角行号
+ * @param[in]   col         左上角列号
+ * @param[in]   row_num     子矩阵行数
+ * @param[in]   col_num     子矩阵列数
+ * @return      子矩阵视图
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename T>
+BaseBlock<T> BaseMatrixT<T>::block(const int &row, const int &col,
+                                   const int &row_num, const int &col_num)
+{
+#ifdef LC_BOUNDS_CHECK
+    if(!CheckBlock(row, col, row_num, col_num))
+        return {nullptr, ld_, row_num, col_num};
+#endif
+    return {mat_.data() + row*ld_ + col, ld_, row_num, col_num};
+}
+
+template<typename T>
+BaseBlock<const T> BaseMatrixT<T>::block(const int &row, const int &col,
+                                         const int &row_num, const int &col_num) const
+{
+#ifdef LC_BOUNDS_CHECK
+    if(!CheckBlock(row, col, row_num, col_num))
+        return {nullptr, ld_, row_num, col_num};
+#endif
+    return {mat_.data() + row*ld_ + col, ld_, row_num, col_num};
+}
+
 /**@brief       “=”重载, 深拷贝
+ * @details     本矩阵容量足够时原地逐行复制, 保留原有的跨度和容量; 否则重新申请为紧凑存储
  * @param[in]   src          待拷贝的BaseMatrix对象
  * @return      拷贝后的this指针
  * @author      Zing Fong
  * @date        2022/6/1
  */
-BaseMatrix &BaseMatrix::operator=(const BaseMatrix &src)
+template<typename T>
+BaseMatrixT<T> &BaseMatrixT<T>::operator=(const BaseMatrixT<T> &src)
 {
     if(this == &src) return *this;  // 身份检测
+    if(src.col_num_ > ld_ || src.row_num_ > get_row_capacity())
+    {
+        ld_ = src.col_num_;
+        mat_.assign(src.row_num_*ld_, 0.0);
+    }
     col_num_ = src.col_num_;
     row_num_ = src.row_num_;
-    mat_ = src.mat_;
+    for(int i = 0; i < row_num_; ++i)
+        std::copy_n(src.mat_.begin() + i*src.ld_, col_num_, mat_.begin() + i*ld_);
+    return *this;
+}
+
+/**@brief       “=”重载, 移动赋值
+ * @details     内存资源相同时与源矩阵交换存储, 本矩阵原有的存储随源矩阵析构;
+ *              不同时按拷贝赋值处理, 本矩阵保留自己的内存资源, 因此可以把临时区中的结果赋给长期保存的矩阵
+ * @param[in]   src          源矩阵
+ * @return      赋值后的this指针
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename T>
+BaseMatrixT<T> &BaseMatrixT<T>::operator=(BaseMatrixT<T> &&src)
+{
+    if(mat_.get_allocator() != src.mat_.get_allocator())
+        return *this = static_cast<const BaseMatrixT<T> &>(src);
+    std::swap(row_num_, src.row_num_);
+    std::swap(col_num_, src.col_num_);
+    std::swap(ld_, src.ld_);
+    mat_.swap(src.mat_);
     return *this;
 }
 
@@ -322,15 +908,17 @@ BaseMatrix &BaseMatrix::operator=(const BaseMatrix &src)
  * @author      Zing Fong
  * @date        2022/6/1
  */
-BaseMatrix BaseMatrix::operator+(const BaseMatrix &add_mat) const
+template<typename T>
+BaseMatrixT<T> BaseMatrixT<T>::operator+(const BaseMatrixT<T> &add_mat) const
 {
-    if(row_num_ == add_mat.row_num_ && col_num_ == add_mat.col_num_ &&
-       mat_.size() == add_mat.mat_.size())
+    if(row_num_ == add_mat.row_num_ && col_num_ == add_mat.col_num_)
     {
         // 矩阵维数一致才可以进行加法运算
-        BaseMatrix result(row_num_, col_num_);
-        for(int i = 0; i < mat_.size(); ++i)
-            result.mat_[i] = this->mat_[i] + add_mat.mat_[i];
+        BaseMatrixT<T> result(row_num_, col_num_, get_resource());
+        for(int i = 0; i < row_num_; ++i)
+            for(int j = 0; j < col_num_; ++j)
+                result.mat_[i*col_num_ + j] = mat_[i*ld_ + j] +
+                                              add_mat.mat_[i*add_mat.ld_ + j];
         return result;
     }
     else
@@ -347,15 +935,17 @@ BaseMatrix BaseMatrix::operator+(const BaseMatrix &add_mat) const
  * @author      Zing Fong
  * @date        2022/6/1
  */
-BaseMatrix BaseMatrix::operator-(const BaseMatrix &subtrahend) const
+template<typename T>
+BaseMatrixT<T> BaseMatrixT<T>::operator-(const BaseMatrixT<T> &subtrahend) const
 {
-    if(row_num_ == subtrahend.row_num_ && col_num_ == subtrahend.col_num_ &&
-       mat_.size() == subtrahend.mat_.size())
+    if(row_num_ == subtrahend.row_num_ && col_num_ == subtrahend.col_num_)
     {
         // 矩阵维数一致才可以进行减法运算
-        BaseMatrix result(row_num_, col_num_);
-        for(int i = 0; i < mat_.size(); ++i)
-            result.mat_[i] = this->mat_[i] - subtrahend.mat_[i];
+        BaseMatrixT<T> result(row_num_, col_num_, get_resource());
+        for(int i = 0; i < row_num_; ++i)
+            for(int j = 0; j < col_num_; ++j)
+                result.mat_[i*col_num_ + j] = mat_[i*ld_ + j] -
+                                              subtrahend.mat_[i*subtrahend.ld_ + j];
         return result;
     }
     else
@@ -372,14 +962,15 @@ BaseMatrix BaseMatrix::operator-(const BaseMatrix &subtrahend) const
  * @author      Zing Fong
  * @date        2022/6/1
  */
-BaseMatrix &BaseMatrix::operator+=(const BaseMatrix &add_mat)
+template<typename T>
+BaseMatrixT<T> &BaseMatrixT<T>::operator+=(const BaseMatrixT<T> &add_mat)
 {
-    if(row_num_ == add_mat.row_num_ && col_num_ == add_mat.col_num_ &&
-       mat_.size() == add_mat.mat_.size())
+    if(row_num_ == add_mat.row_num_ && col_num_ == add_mat.col_num_)
     {
         // 矩阵维数一致才可以进行加法运算
-        for(int i = 0; i < mat_.size(); ++i)
-            this->mat_[i] += add_mat.mat_[i];
+        for(int i = 0; i < row_num_; ++i)
+            for(int j = 0; j < col_num_; ++j)
+                mat_[i*ld_ + j] += add_mat.mat_[i*add_mat.ld_ + j];
     }
     else
         printf("Matrix addition error! left size: %d×%d, right size: %d×%d\n",
@@ -393,14 +984,15 @@ BaseMatrix &BaseMatrix::operator+=(const BaseMatrix &add_mat)
  * @author      Zing Fong
  * @date        2022/6/1
  */
-BaseMatrix &BaseMatrix::operator-=(const BaseMatrix &subtrahend)
+template<typename T>
+BaseMatrixT<T> &BaseMatrixT<T>::operator-=(const BaseMatrixT<T> &subtrahend)
 {
-    if(row_num_ == subtrahend.row_num_ && col_num_ == subtrahend.col_num_ &&
-       mat_.size() == subtrahend.mat_.size())
+    if(row_num_ == subtrahend.row_num_ && col_num_ == subtrahend.col_num_)
     {
         // 矩阵维数一致才可以进行减法运算
-        for(int i = 0; i < mat_.size(); ++i)
-            this->mat_[i] -= subtrahend.mat_[i];
+        for(int i = 0; i < row_num_; ++i)
+            for(int j = 0; j < col_num_; ++j)
+                mat_[i*ld_ + j] -= subtrahend.mat_[i*subtrahend.ld_ + j];
     }
     else
         printf("Matrix subtraction error! left size: %d×%d, right size: %d×%d\n",
@@ -414,7 +1006,8 @@ BaseMatrix &BaseMatrix::operator-=(const BaseMatrix &subtrahend)
  * @author      Zing Fong
  * @date        2022/6/1
  */
-BaseMatrix BaseMatrix::operator*(const BaseMatrix &multiplier) const
+template<typename T>
+BaseMatrixT<T> BaseMatrixT<T>::operator*(const BaseMatrixT<T> &multiplier) const
 {
     if(col_num_ == multiplier.row_num_)
     {
@@ -422,13 +1015,20 @@ BaseMatrix BaseMatrix::operator*(const BaseMatrix &multiplier) const
         int m = row_num_;
         int n = col_num_;
         int p = multiplier.col_num_;
-        BaseMatrix result(m, p);  // 声明一个积矩阵
+        BaseMatrixT<T> result(m, p, get_resource());  // 声明一个积矩阵
+        if(UseBlas(m, p, n))
+        {
+            Gemm(1.0, *this, false, multiplier, false, 0.0, result);
+            return result;
+        }
+        const int lda = ld_, ldb = multiplier.ld_;  // 跨度放在局部变量中, 内层循环不必重新读取
+        const T *a = mat_.data(), *b = multiplier.mat_.data();
+        T *c = result.mat_.data();
         // 实际上这里循环顺序并不重要，对于一维数组来说顺序读取和抽样读取速度差异不大
         for(int i = 0; i < m; ++i)
             for(int j = 0; j < n; j++)
                 for(int k = 0; k < p; k++)
-                    result.mat_[i*p + k] += (mat_[i*n + j]*
-                                             multiplier.mat_[j*p + k]);
+                    c[i*p + k] += a[i*lda + j]*b[j*ldb + k];
         return result;
     }
     else
@@ -445,10 +1045,11 @@ BaseMatrix BaseMatrix::operator*(const BaseMatrix &multiplier) const
  * @author      Zing Fong
  * @date        2022/6/1
  */
-BaseMatrix BaseMatrix::operator*(const double &scalar) const
+template<typename T>
+BaseMatrixT<T> BaseMatrixT<T>::operator*(const T &scalar) const
 {
-    BaseMatrix result(*this);
-    for(double &a_mat: result.mat_)
+    BaseMatrixT<T> result(*this, get_resource());  // 拷贝构造结果为紧凑存储
+    for(T &a_mat: result.mat_)
         a_mat *= scalar;
     return result;
 }
@@ -459,19 +1060,39 @@ BaseMatrix BaseMatrix::operator*(const double &scalar) const
  * @author      Zing Fong
  * @date        2022/6/1
  */
-BaseMatrix BaseMatrix::Inverse() const
+template<typename T>
+BaseMatrixT<T> BaseMatrixT<T>::Inverse() const
 {
     int n = row_num_;
-    BaseMatrix inv_mat(n, n);
-    std::vector<double> a = mat_;
-    std::vector<double> b = inv_mat.mat_;
-    int *is = new int[n*n];
-    int *js = new int[n*n];
+    BaseMatrixT<T> inv_mat(*this, get_resource());
+    std::pmr::vector<int> is(n, 0, get_resource());
+    std::pmr::vector<int> js(n, 0, get_resource());
     int i, j, k, l, u, v;
-    double d, p;
+    T d, p;
     
-    /* 将输入矩阵赋值给输出矩阵b，下面对b矩阵求逆，a矩阵不变 */
-    b = a;
+    /* 将输入矩阵紧凑复制到输出矩阵b，下面对b矩阵求逆，本矩阵不变 */
+    T *b = inv_mat.mat_.data();
+#ifdef LC_USE_BLAS
+    if(UseBlas(n, n, n))
+    {
+        // 按列优先解释为Aᵀ, 其逆(A⁻¹)ᵀ按行优先读出即为A⁻¹。主元过小时与下面一样返回单位阵
+        int info = 0, lwork = -1;
+        T work_size = 0.0;
+        LapackGetrf(&n, &n, b, &n, is.data(), &info);
+        for(k = 0; k < n && info == 0; k++)
+            if(fabs(b[k*n + k]) < 1.0E-15)
+                info = k + 1;
+        if(info != 0)
+            return eye(n, get_resource());
+        LapackGetri(&n, b, &n, is.data(), &work_size, &lwork, &info);  // 查询工作区大小
+        lwork = std::max(static_cast<int>(work_size), n);
+        std::pmr::vector<T> work(lwork, 0.0, get_resource());
+        LapackGetri(&n, b, &n, is.data(), work.data(), &lwork, &info);
+        if(info != 0)
+            return eye(n, get_resource());
+        return inv_mat;  // 不能写成条件表达式, 否则按拷贝构造回到默认内存资源
+    }
+#endif
     for(k = 0; k < n; k++)
     {
         d = 0.0;
@@ -492,7 +1113,7 @@ BaseMatrix BaseMatrix::Inverse() const
         
         if(fabs(d) < 1.0E-15)
         {
-            return eye(n);
+            return eye(n, get_resource());
         }
         
         if(is[k] != k)  /* 对主元素所在的行与右下角方阵的首行进行调换 */
@@ -578,11 +1199,6 @@ BaseMatrix BaseMatrix::Inverse() const
             }
         }
     }
-    inv_mat.mat_ = b;
-    
-    delete[] is;
-    delete[] js;
-    
     return inv_mat;
 }
 
@@ -591,85 +1207,385 @@ BaseMatrix BaseMatrix::Inverse() const
  * @author      Zing Fong
  * @date        2022/6/1
  */
-BaseMatrix BaseMatrix::Trans() const
+template<typename T>
+BaseMatrixT<T> BaseMatrixT<T>::Trans() const
 {
     int m = row_num_, n = col_num_;
-    BaseMatrix trans_mat(n, m);
+    BaseMatrixT<T> trans_mat(n, m, get_resource());
     for(int i = 0; i < m; ++i)
         for(int j = 0; j < n; j++)
-            trans_mat.mat_[j*m + i] = mat_[i*n + j];  // 原矩阵i行j列元素赋值到转置矩阵中j行i列处
+            trans_mat.mat_[j*m + i] = mat_[i*ld_ + j];  // 原矩阵i行j列元素赋值到转置矩阵中j行i列处
     return trans_mat;
 }
 
+/**@brief       列主元LU分解解线性方程组A·X = B
+ * @details     比先求逆再相乘少约三分之二的运算量, 也更稳定。本矩阵不变
+ * @param[in]   b           右端矩阵B, 行数须与A的维数一致
+ * @return      解X; A不是方阵、行数不匹配时返回B, 奇异时返回零矩阵
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename T>
+BaseMatrixT<T> BaseMatrixT<T>::Solve(const BaseMatrixT<T> &b) const
+{
+    const int n = row_num_, k = b.col_num_;
+    if(row_num_ != col_num_ || b.row_num_ != n)
+    {
+        printf("Matrix solve error! A size: %d×%d, B size: %d×%d\n",
+               row_num_, col_num_, b.row_num_, b.col_num_);
+        return BaseMatrixT<T>(b, get_resource());
+    }
+    BaseMatrixT<T> lu(*this, get_resource());  // 紧凑复制, 原地分解
+    BaseMatrixT<T> x(b, get_resource());
+    T *pa = lu.mat_.data(), *px = x.mat_.data();
+#ifdef LC_USE_BLAS
+    if(UseBlas(n, n, n))
+    {
+        // 按列优先解释为Aᵀ, 分解Aᵀ后解转置方程即A·X = B; B按列优先重新排列
+        std::pmr::vector<int> ipiv(n, 0, get_resource());
+        std::pmr::vector<T> xt(n*k, 0.0, get_resource());
+        for(int i = 0; i < n; ++i)
+            for(int j = 0; j < k; ++j)
+                xt[j*n + i] = px[i*k + j];
+        const char trans = 'T';
+        int info = 0;
+        LapackGetrf(&n, &n, pa, &n, ipiv.data(), &info);
+        for(int i = 0; i < n && info == 0; ++i)
+            if(fabs(pa[i*n + i]) < 1.0E-15)
+                info = i + 1;
+        if(info != 0)
+        {
+            printf("Matrix solve error! singular matrix\n");
+            return zeros(n, k, get_resource());
+        }
+        LapackGetrs(&trans, &n, &k, pa, &n, ipiv.data(), xt.data(), &n, &info);
+        for(int i = 0; i < n; ++i)
+            for(int j = 0; j < k; ++j)
+                px[i*k + j] = xt[j*n + i];
+        return x;
+    }
+#endif
+    // 消元, 对B做同样的行变换
+    for(int c = 0; c < n; ++c)
+    {
+        int pivot = c;
+        for(int i = c + 1; i < n; ++i)
+            if(fabs(pa[i*n + c]) > fabs(pa[pivot*n + c]))
+                pivot = i;
+        if(fabs(pa[pivot*n + c]) < 1.0E-15)
+        {
+            printf("Matrix solve error! singular matrix\n");
+            return zeros(n, k, get_resource());
+        }
+        if(pivot != c)
+        {
+            std::swap_ranges(pa + c*n, pa + c*n + n, pa + pivot*n);
+            std::swap_ranges(px + c*k, px + c*k + k, px + pivot*k);
+        }
+        for(int i = c + 1; i < n; ++i)
+        {
+            const T factor = pa[i*n + c]/pa[c*n + c];
+            if(factor == 0.0)
+                continue;
+            for(int j = c + 1; j < n; ++j)
+                pa[i*n + j] -= factor*pa[c*n + j];
+            for(int j = 0; j < k; ++j)
+                px[i*k + j] -= factor*px[c*k + j];
+        }
+    }
+    // 回代
+    for(int i = n - 1; i >= 0; --i)
+    {
+        for(int c = i + 1; c < n; ++c)
+        {
+            const T factor = pa[i*n + c];
+            for(int j = 0; j < k; ++j)
+                px[i*k + j] -= factor*px[c*k + j];
+        }
+        const T inv = 1.0/pa[i*n + i];
+        for(int j = 0; j < k; ++j)
+            px[i*k + j] *= inv;
+    }
+    return x;
+}
+
+/**@brief       对称正定矩阵的Cholesky分解A = L·Lᵀ
+ * @details     只读取本矩阵的下三角。L的严格上三角置零
+ * @param[out]  l           下三角矩阵L, 容量足够时不申请内存, 不能与本矩阵为同一个对象
+ * @return      返回结果:\n
+ * -   0        正常
+ * -  -1        不是方阵或不正定, L的内容无意义
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename T>
+int BaseMatrixT<T>::Cholesky(BaseMatrixT<T> &l) const
+{
+    const int n = row_num_;
+    if(row_num_ != col_num_ || &l == this)
+    {
+        printf("Cholesky error! size: %d×%d\n", row_num_, col_num_);
+        return -1;
+    }
+    l.Reshape(n, n);
+    const int ldl = l.ld_;
+    T *pl = l.mat_.data();
+    for(int i = 0; i < n; ++i)
+    {
+        std::copy_n(mat_.data() + i*ld_, i + 1, pl + i*ldl);
+        std::fill_n(pl + i*ldl + i + 1, n - i - 1, 0.0);
+    }
+#ifdef LC_USE_BLAS
+    if(UseBlas(n, n, n))
+    {
+        // 下三角按列优先解释为上三角U, A = Uᵀ·U, 按行优先读出即L = Uᵀ
+        const char uplo = 'U';
+        int info = 0;
+        LapackPotrf(&uplo, &n, pl, &ldl, &info);
+        if(info != 0)
+        {
+            printf("Cholesky error! matrix is not positive definite\n");
+            return -1;
+        }
+        return 0;
+    }
+#endif
+    for(int j = 0; j < n; ++j)
+    {
+        T *lj = pl + j*ldl;
+        T d = lj[j];
+        for(int c = 0; c < j; ++c)
+            d -= lj[c]*lj[c];
+        if(d <= 0.0)
+        {
+            printf("Cholesky error! matrix is not positive definite\n");
+            return -1;
+        }
+        lj[j] = sqrt(d);
+        const T inv = 1.0/lj[j];
+        for(int i = j + 1; i < n; ++i)
+        {
+            T *li = pl + i*ldl;
+            T sum = li[j];
+            for(int c = 0; c < j; ++c)
+                sum -= li[c]*lj[c];
+            li[j] = sum*inv;
+        }
+    }
+    return 0;
+}
+
 /**@brief       矩阵求迹
  * @return      该矩阵的迹
  * @author      Zing Fong
  * @date        2022/6/5
  */
-double BaseMatrix::Trace() const
+template<typename T>
+T BaseMatrixT<T>::Trace() const
 {
     if(row_num_ != col_num_)
     {
         printf("Calculation trace error: Not a square.\n");
         return 0.0;
     }
-    double trace{};
+    T trace{};
     for(int i = 0; i < row_num_; ++i)
         trace += this->read(i, i);
     return trace;
 }
 
+/**@brief       矩阵指数e^A, 缩放与平方法加6阶Padé近似
+ * @details     先将A缩小2^s倍使无穷范数不大于0.5, 用Padé近似D⁻¹·N求e^(A/2^s), 再平方s次。
+ *              见Golub & Van Loan《Matrix Computations》算法11.3.1, 双精度下相对误差约1e-15。本矩阵不变
+ * @return      e^A; 不是方阵时返回单位阵
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename T>
+BaseMatrixT<T> BaseMatrixT<T>::Exp() const
+{
+    const int n = row_num_;
+    if(row_num_ != col_num_)
+    {
+        printf("Matrix exponential error: Not a square.\n");
+        return eye(n, get_resource());
+    }
+    T norm{};  // 无穷范数, 即行绝对值和的最大值
+    for(int i = 0; i < n; ++i)
+    {
+        T row_sum{};
+        for(int j = 0; j < n; ++j)
+            row_sum += fabs(read(i, j));
+        norm = std::max(norm, row_sum);
+    }
+    const int s = norm > 0.5 ? static_cast<int>(ceil(log2(norm/0.5))) : 0;
+    BaseMatrixT<T> a(*this, get_resource());
+    Scale(static_cast<T>(ldexp(1.0, -s)), a);
+    
+    constexpr int kOrder = 6;
+    BaseMatrixT<T> x(a, get_resource()), ax(a, get_resource());
+    BaseMatrixT<T> num = eye(n, get_resource()), den = eye(n, get_resource());
+    T c = 0.5;
+    Axpy(c, a, num);
+    Axpy(-c, a, den);
+    for(int k = 2; k <= kOrder; ++k)
+    {
+        c *= static_cast<T>(kOrder - k + 1)/static_cast<T>(k*(2*kOrder - k + 1));
+        Gemm(1.0, a, false, x, false, 0.0, ax);
+        x = ax;
+        Axpy(c, x, num);
+        Axpy(k % 2 == 0 ? c : -c, x, den);
+    }
+    BaseMatrixT<T> result = den.Solve(num);
+    for(int k = 0; k < s; ++k)
+    {
+        Gemm(1.0, result, false, result, false, 0.0, ax);
+        result = ax;
+    }
+    return result;
+}
+
 /**@brief       矩阵置零
  * @details     将该矩阵元素全部置零
  * @author      Zing Fong
  * @date        2022/6/1
  */
-void BaseMatrix::setZero()
+template<typename T>
+void BaseMatrixT<T>::setZero()
 {
     for(auto &a_mat: mat_)
         a_mat = 0.0;
 }
 
+/**@brief       预留行列容量, 之后在容量内增删行列不再申请内存
+ * @details     列容量增大时按新的跨度重新排列, 只增大行容量时在末尾扩展
+ * @param[in]   row_capacity    行容量, 小于当前容量时不变
+ * @param[in]   col_capacity    列容量, 小于当前容量时不变
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename T>
+void BaseMatrixT<T>::Reserve(const int &row_capacity, const int &col_capacity)
+{
+    int new_ld = std::max(ld_, col_capacity);
+    int new_row_capacity = std::max(get_row_capacity(), row_capacity);
+    if(new_ld == ld_)
+    {
+        if(new_row_capacity*ld_ > static_cast<int>(mat_.size()))
+            mat_.resize(new_row_capacity*ld_, 0.0);
+        return;
+    }
+    decltype(mat_) mat(new_row_capacity*new_ld, 0.0, mat_.get_allocator());
+    for(int i = 0; i < row_num_; ++i)
+        std::copy_n(mat_.begin() + i*ld_, col_num_, mat.begin() + i*new_ld);
+    mat_.swap(mat);
+    ld_ = new_ld;
+}
+
+/**@brief       改变行列数, 不保留原有元素
+ * @details     容量足够时不申请内存, 否则重新申请为紧凑存储。用于原地运算的结果矩阵
+ * @param[in]   row_num     新的行数
+ * @param[in]   col_num     新的列数
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename T>
+void BaseMatrixT<T>::Reshape(const int &row_num, const int &col_num)
+{
+    if(col_num > ld_ || row_num > get_row_capacity())
+    {
+        ld_ = col_num;
+        mat_.assign(row_num*col_num, 0.0);
+    }
+    row_num_ = row_num;
+    col_num_ = col_num;
+}
+
+/**@brief       检查子矩阵是否在本矩阵范围内, 只在定义LC_BOUNDS_CHECK时调用
+ * @param[in]   row         左上角行号
+ * @param[in]   col         左上角列号
+ * @param[in]   row_num     子矩阵行数
+ * @param[in]   col_num     子矩阵列数
+ * @return      true为在范围内
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename T>
+bool BaseMatrixT<T>::CheckBlock(const int &row, const int &col,
+                                const int &row_num, const int &col_num) const
+{
+    if(row >= 0 && col >= 0 && row_num > 0 && col_num > 0 &&
+       row + row_num <= row_num_ && col + col_num <= col_num_)
+        return true;
+    printf("Matrix block error! block: (%d, %d) %d×%d, matrix size: %d×%d\n",
+           row, col, row_num, col_num, row_num_, col_num_);
+    return false;
+}
+
 /**@brief       向矩阵中插入一行
- * @param[in]   vec         要插入的行
+ * @details     aim_row之后的行整体下移一行, 行容量不足时扩展为两倍
+ * @param[in]   vec         要插入的行, 长度为列数
  * @param[in]   aim_row     要插入的位置(行号)
  * @author      Zing Fong
  * @date        2022/6/1
  */
-void BaseMatrix::InsertRow(const std::vector<double> &vec, const int &aim_row)
+template<typename T>
+void BaseMatrixT<T>::InsertRow(const std::vector<T> &vec, const int &aim_row)
 {
-    if(aim_row > row_num_ || aim_row < 0)
+    if(aim_row > row_num_ || aim_row < 0 || vec.size() != col_num_)
     {
         // 要插入的行不在矩阵范围内
-        printf("Matrix InsertRow function error! matrix size: %d×%d, aim_row: %d\n",
-               row_num_, col_num_, aim_row);
+        printf("Matrix InsertRow function error! matrix size: %d×%d, aim_row: %d, "
+               "vector size: %d\n", row_num_, col_num_, aim_row,
+               static_cast<int>(vec.size()));
         return;
     }
+    if(row_num_ + 1 > get_row_capacity())
+        Reserve(std::max(row_num_ + 1, 2*get_row_capacity()), ld_);
+    auto row_begin = mat_.begin() + aim_row*ld_;
+    std::copy_backward(row_begin, mat_.begin() + row_num_*ld_,
+                       mat_.begin() + (row_num_ + 1)*ld_);
+    std::copy(vec.cbegin(), vec.cend(), row_begin);
     ++row_num_;
-    mat_.reserve((row_num_ + 1)*col_num_);
-    mat_.insert(mat_.begin() + aim_row*col_num_, vec.cbegin(), vec.cend());
-    
 }
 
 /**@brief       向矩阵中插入一列
- * @param[in]   vec         要插入的行
+ * @details     每一行中aim_col之后的元素右移一位, 列容量不足时扩展为两倍
+ * @param[in]   vec         要插入的列, 长度为行数
  * @param[in]   aim_col     要插入的位置(列号)
  * @author      Zing Fong
  * @date        2022/6/1
  */
-void BaseMatrix::InsertCol(const std::vector<double> &vec, const int &aim_col)
+template<typename T>
+void BaseMatrixT<T>::InsertCol(const std::vector<T> &vec, const int &aim_col)
 {
-    BaseMatrix tmp = this->Trans();
-    tmp.InsertRow(vec, aim_col);
-    *this = tmp.Trans();
+    if(aim_col > col_num_ || aim_col < 0 || vec.size() != row_num_)
+    {
+        // 要插入的列不在矩阵范围内
+        printf("Matrix InsertCol function error! matrix size: %d×%d, aim_col: %d, "
+               "vector size: %d\n", row_num_, col_num_, aim_col,
+               static_cast<int>(vec.size()));
+        return;
+    }
+    if(col_num_ + 1 > ld_)
+        Reserve(get_row_capacity(), std::max(col_num_ + 1, 2*ld_));
+    for(int i = 0; i < row_num_; ++i)
+    {
+        auto row_begin = mat_.begin() + i*ld_;
+        std::copy_backward(row_begin + aim_col, row_begin + col_num_,
+                           row_begin + col_num_ + 1);
+        row_begin[aim_col] = vec[i];
+    }
+    ++col_num_;
 }
 
-/**@brief       将矩阵删除一行
+/**@brief       将矩阵删除一行, 容量不变
  * @param[in]   aim_row     要删除的位置(行号)
  * @author      Zing Fong
  * @date        2022/6/1
  */
-void BaseMatrix::EraseRow(const int &aim_row)
+template<typename T>
+void BaseMatrixT<T>::EraseRow(const int &aim_row)
 {
     if(aim_row > row_num_ - 1 || aim_row < 0)
     {
@@ -678,50 +1594,118 @@ void BaseMatrix::EraseRow(const int &aim_row)
                row_num_, col_num_, aim_row);
         return;
     }
+    std::copy(mat_.begin() + (aim_row + 1)*ld_, mat_.begin() + row_num_*ld_,
+              mat_.begin() + aim_row*ld_);
     --row_num_;
-    mat_.erase(mat_.begin() + aim_row*col_num_,
-               mat_.begin() + (aim_row + 1)*col_num_);
 }
 
-/**@brief       将矩阵删除一列
+/**@brief       将矩阵删除一列, 容量不变
  * @param[in]   aim_col     要删除的位置(列号)
  * @author      Zing Fong
  * @date        2022/6/1
  */
-void BaseMatrix::EraseCol(const int &aim_col)
+template<typename T>
+void BaseMatrixT<T>::EraseCol(const int &aim_col)
 {
-    BaseMatrix tmp = this->Trans();
-    tmp.EraseRow(aim_col);
-    *this = tmp.Trans();
+    if(aim_col > col_num_ - 1 || aim_col < 0)
+    {
+        // 要删除的列不在矩阵范围内
+        printf("Matrix EraseCol function error! matrix size: %d×%d, aim_col: %d\n",
+               row_num_, col_num_, aim_col);
+        return;
+    }
+    for(int i = 0; i < row_num_; ++i)
+    {
+        auto row_begin = mat_.begin() + i*ld_;
+        std::copy(row_begin + aim_col + 1, row_begin + col_num_, row_begin + aim_col);
+    }
+    --col_num_;
 }
 
-int BaseMatrix::get_row_num() const
+template<typename T>
+int BaseMatrixT<T>::get_row_num() const
 {
     return row_num_;
 }
 
-int BaseMatrix::get_col_num() const
+template<typename T>
+int BaseMatrixT<T>::get_col_num() const
 {
     return col_num_;
 }
 
-std::vector<double> BaseMatrix::get_mat() const
+template<typename T>
+int BaseMatrixT<T>::get_row_capacity() const
 {
-    return mat_;
+    return static_cast<int>(mat_.size())/ld_;
 }
 
-void BaseMatrix::set_row(const int &row)
+template<typename T>
+int BaseMatrixT<T>::get_col_capacity() const
 {
-    if(row > 0)
-        row_num_ = row;
-    else
+    return ld_;
+}
+
+template<typename T>
+std::pmr::memory_resource *BaseMatrixT<T>::get_resource() const
+{
+    return mat_.get_allocator().resource();
+}
+
+/**@brief       按行优先紧凑排列的矩阵元素
+ * @author      Zing Fong
+ * @date        2022/6/1
+ */
+template<typename T>
+std::vector<T> BaseMatrixT<T>::get_mat() const
+{
+    if(ld_ == col_num_)
+        return {mat_.begin(), mat_.begin() + row_num_*col_num_};
+    std::vector<T> mat(row_num_*col_num_, 0.0);
+    for(int i = 0; i < row_num_; ++i)
+        std::copy_n(mat_.begin() + i*ld_, col_num_, mat.begin() + i*col_num_);
+    return mat;
+}
+
+/**@brief       设置行数, 保留原有元素, 新增的行为0
+ * @param[in]   row         行数, > 0
+ * @author      Zing Fong
+ * @date        2022/6/1
+ */
+template<typename T>
+void BaseMatrixT<T>::set_row(const int &row)
+{
+    if(row <= 0)
+    {
         printf("Set row number error!\n");
+        return;
+    }
+    if(row > get_row_capacity())
+        Reserve(row, ld_);
+    if(row > row_num_)
+        std::fill(mat_.begin() + row_num_*ld_, mat_.begin() + row*ld_, 0.0);
+    row_num_ = row;
 }
 
-void BaseMatrix::set_col(const int &col)
+/**@brief       设置列数, 保留原有元素, 新增的列为0
+ * @param[in]   col         列数, > 0
+ * @author      Zing Fong
+ * @date        2022/6/1
+ */
+template<typename T>
+void BaseMatrixT<T>::set_col(const int &col)
 {
-    if(col > 0)
-        col_num_ = col;
-    else
+    if(col <= 0)
+    {
         printf("Set column number error!\n");
+        return;
+    }
+    if(col > ld_)
+        Reserve(get_row_capacity(), col);
+    for(int i = 0; col > col_num_ && i < row_num_; ++i)
+        std::fill(mat_.begin() + i*ld_ + col_num_, mat_.begin() + i*ld_ + col, 0.0);
+    col_num_ = col;
 }
+
+template class BaseMatrixT<double>;
+template class BaseMatrixT<float>;
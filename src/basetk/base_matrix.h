@@ -10,6 +10,12 @@
  * <table>
  * <tr><th>Date         <th>Version  <th>Author     <th>Description
  * <tr><td>2022/5/25    <td>1.0      <td>Zing Fong  <td>Initialize
+ * <tr><td>2026/10/18   <td>1.1      <td>Zing Fong  <td>按行跨度存储, 行列分别预留容量, 原地增删行列
+ * <tr><td>2026/10/18   <td>1.2      <td>Zing Fong  <td>增加了子矩阵视图BaseBlock
+ * <tr><td>2026/10/18   <td>1.3      <td>Zing Fong  <td>元素存储可以指定内存资源
+ * <tr><td>2026/10/18   <td>1.4      <td>Zing Fong  <td>大维数运算可以交给BLAS/LAPACK, 增加了解方程和Cholesky分解
+ * <tr><td>2026/10/18   <td>1.5      <td>Zing Fong  <td>改为元素类型的模板BaseMatrixT, 提供double和float两种实例
+ * <tr><td>2026/10/18   <td>1.6      <td>Zing Fong  <td>增加了矩阵指数
  * </table>
  **********************************************************************************
  */
@@ -18,15 +24,32 @@
 
 
 // c/c++系统文件
-
+#include <cstdio>
 // 其他库的 .h 文件
+#include <memory_resource>
+#include <type_traits>
 #include <vector>
 
 // 本项目内 .h 文件
 
+constexpr int kBlockDynamic = -1;  // 子矩阵视图的行列数在运行时确定
+template<typename T, int R = kBlockDynamic, int C = kBlockDynamic>
+class BaseBlock;
 
-/**@class   BaseMatrix
- * @brief   一维数组实现的矩阵类
+/**@class   BaseMatrixT
+ * @brief   一维数组实现的矩阵类, T为元素类型
+ * @details 成员函数在base_matrix.cc中实现, 只实例化了double(BaseMatrix)和float(BaseMatrixF)两种。
+ *          float的矩阵用于可以容忍单精度的协方差阵等, 占用内存和带宽减半; 位置等需要双精度的量仍用BaseMatrix。
+ *          不同元素类型之间用Cast转换, 不提供隐式转换和混合运算。
+ *          行优先存储, 第i行第j列元素位于mat_[i*ld_ + j]。行跨度ld_即列容量, 可以大于列数; mat_的大小为行容量×ld_,
+ *          行容量可以大于行数。增删行列都在原有存储中原地移动元素, 容量足够时不重新申请内存:
+ *          在末尾追加一行只需写入该行, 追加一列只需在每行的空余位置写入一个元素。容量不足时按两倍扩展。
+ *          拷贝构造得到的矩阵是紧凑的(跨度等于列数)。
+ *          元素存储为std::pmr::vector, 构造时可以指定内存资源(如EpochArena), 默认为全局堆。
+ *          加减乘、转置、求逆的结果使用左操作数的内存资源, 所以由临时区中的矩阵算出的中间结果也在临时区中;
+ *          拷贝构造使用默认内存资源, 拷贝赋值和资源不同的移动赋值只复制元素, 目标矩阵保留自己的内存资源。
+ *          定义LC_USE_BLAS(CMake选项LOOSECOUPLED_BLAS)时, 维数不小于get_blas_threshold()的乘法、求逆、解方程和
+ *          Cholesky分解调用系统的BLAS/LAPACK, 较小的矩阵仍使用内置实现
  * @par 修改日志:
  * <table>
  * <tr><th>Date         <th>Author      <th>Description
@@ -36,65 +59,401 @@
  * <tr><td>2022/6/9     <td>Zing Fong   <td>增加了三维列向量叉乘函数
  * <tr><td>2022/6/12    <td>Zing Fong   <td>增加了向量加减法
  * <tr><td>2022/6/18    <td>Zing Fong   <td>增加了向量求对角阵函数
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>按行跨度存储, 行列分别预留容量, 原地增删行列
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>增加了移动语义和BLAS风格的原地运算
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>增加了子矩阵视图block
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>元素存储改为std::pmr::vector, 可以指定内存资源
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>可选的BLAS/LAPACK后端, 增加了解方程和Cholesky分解
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>改为元素类型的模板, 增加了Cast
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>增加了矩阵指数
  * </table>
  */
-class BaseMatrix
+template<typename T>
+class BaseMatrixT
 {
+    template<typename U, int R, int C>
+    friend class BaseBlock;
+    template<typename U>
+    friend class BaseMatrixT;
+    
   public:
-    BaseMatrix() = default;  // 默认构造函数
-    BaseMatrix(const std::vector<double> &mat,
-               const int &row_num, const int &col_num);  // 构造函数
-    BaseMatrix(const int &row_num, const int &col_num);  // 全零矩阵构造函数
-    BaseMatrix(const BaseMatrix &src);  // 拷贝构造函数
-    
-    static BaseMatrix eye(const int &n);  // 单位阵
-    static BaseMatrix zeros(const int &row_num, const int &col_num);  // 全零阵
-    static BaseMatrix CalcAntisymmetryMat(
-            const std::vector<double> &vec);  // 三维向量的反对称矩阵
-    static std::vector<double> CrossProduct(const std::vector<double> &vec1,
-                                   const std::vector<double> &vec2);  // 三维向量外积
-    static std::vector<double> VectorAdd(const std::vector<double> &vec1,
-                                         const std::vector<double> &vec2);  // 向量加法
-    static std::vector<double> VectorSub(const std::vector<double> &vec1,
-                                const std::vector<double> &vec2);  // 向量减法
-    static BaseMatrix Diag(const std::vector<double> &vec);  // 向量求对角阵
+    BaseMatrixT() = default;  // 默认构造函数
+    BaseMatrixT(const std::vector<T> &mat,
+                const int &row_num, const int &col_num,
+                std::pmr::memory_resource *resource = std::pmr::get_default_resource());  // 构造函数
+    BaseMatrixT(const int &row_num, const int &col_num,
+                std::pmr::memory_resource *resource = std::pmr::get_default_resource());  // 全零矩阵构造函数
+    BaseMatrixT(const BaseMatrixT &src);  // 拷贝构造函数
+    BaseMatrixT(const BaseMatrixT &src, std::pmr::memory_resource *resource);  // 指定内存资源的拷贝构造函数
+    BaseMatrixT(BaseMatrixT &&src) noexcept;  // 移动构造函数
+    template<typename U>
+    BaseMatrixT<U> Cast(std::pmr::memory_resource *resource =
+                        std::pmr::get_default_resource()) const;  // 转换元素类型, 结果为紧凑存储
+    
+    static BaseMatrixT eye(const int &n,
+                           std::pmr::memory_resource *resource = std::pmr::get_default_resource());  // 单位阵
+    static BaseMatrixT zeros(const int &row_num, const int &col_num,
+                             std::pmr::memory_resource *resource = std::pmr::get_default_resource());  // 全零阵
+    static BaseMatrixT CalcAntisymmetryMat(
+            const std::vector<T> &vec);  // 三维向量的反对称矩阵
+    static std::vector<T> CrossProduct(const std::vector<T> &vec1,
+                                       const std::vector<T> &vec2);  // 三维向量外积
+    static std::vector<T> VectorAdd(const std::vector<T> &vec1,
+                                    const std::vector<T> &vec2);  // 向量加法
+    static std::vector<T> VectorSub(const std::vector<T> &vec1,
+                                    const std::vector<T> &vec2);  // 向量减法
+    static BaseMatrixT Diag(const std::vector<T> &vec);  // 向量求对角阵
+    
+    // BLAS风格的原地运算, 结果写入已有的矩阵C/Y/X, 容量足够时不申请内存
+    static int Gemm(const T &alpha, const BaseMatrixT &a, const bool &trans_a,
+                    const BaseMatrixT &b, const bool &trans_b,
+                    const T &beta, BaseMatrixT &c);  // C = α·op(A)·op(B) + β·C
+    static int Syrk(const T &alpha, const BaseMatrixT &a, const bool &trans_a,
+                    const T &beta, BaseMatrixT &c);  // C = α·op(A)·op(A)ᵀ + β·C, C对称
+    static int Symm(const bool &left, const T &alpha, const BaseMatrixT &a,
+                    const BaseMatrixT &b, const T &beta,
+                    BaseMatrixT &c);  // C = α·A·B + β·C(left)或α·B·A + β·C, A对称
+    static int Axpy(const T &alpha, const BaseMatrixT &x, BaseMatrixT &y);  // Y = α·X + Y
+    static void Scale(const T &alpha, BaseMatrixT &x);  // X = α·X
+    
+    // 交给BLAS/LAPACK的最小维数, 各元素类型共用, 只在启动时或单线程中修改
+    static int get_blas_threshold();
+    static void set_blas_threshold(const int &threshold);
     
     
     void disp(int width = 9, int precise = 4) const;  // 按照位宽和精度显示矩阵
-    double read(const int &row, const int &col) const;  // 读取矩阵元素
-    void write(const int &row, const int &col, const double &val);  // 向矩阵中写入值
-    
-    BaseMatrix &operator=(const BaseMatrix &src);  // 矩阵复制
-    BaseMatrix operator+(const BaseMatrix &add_mat) const;  // 矩阵加法
-    BaseMatrix operator-(const BaseMatrix &subtrahend) const;  // 矩阵减法
-    BaseMatrix &operator+=(const BaseMatrix &add_mat);  // +=
-    BaseMatrix &operator-=(const BaseMatrix &subtrahend);  // -=
-    BaseMatrix operator*(const BaseMatrix &multiplier) const;  // 矩阵乘法
-    BaseMatrix operator*(const double &scalar) const;  // 矩阵数乘
-    
-    BaseMatrix Inverse() const;  // 矩阵求逆, 返回该矩阵的逆矩阵
-    BaseMatrix Trans() const;  // 矩阵转置, 返回该矩阵的转置矩阵
-    double Trace() const;  // 矩阵求迹
+    T read(const int &row, const int &col) const;  // 读取矩阵元素
+    void write(const int &row, const int &col, const T &val);  // 向矩阵中写入值
+    
+    // 子矩阵视图, 不复制元素, 见BaseBlock
+    template<int R, int C>
+    BaseBlock<T, R, C> block(const int &row, const int &col);  // R×C固定大小的子矩阵
+    template<int R, int C>
+    BaseBlock<const T, R, C> block(const int &row, const int &col) const;  // 只读
+    BaseBlock<T> block(const int &row, const int &col,
+                       const int &row_num, const int &col_num);  // 运行时大小的子矩阵
+    BaseBlock<const T> block(const int &row, const int &col,
+                             const int &row_num, const int &col_num) const;  // 只读
+    
+    BaseMatrixT &operator=(const BaseMatrixT &src);  // 矩阵复制
+    BaseMatrixT &operator=(BaseMatrixT &&src);  // 矩阵移动赋值, 内存资源不同时复制元素
+    BaseMatrixT operator+(const BaseMatrixT &add_mat) const;  // 矩阵加法
+    BaseMatrixT operator-(const BaseMatrixT &subtrahend) const;  // 矩阵减法
+    BaseMatrixT &operator+=(const BaseMatrixT &add_mat);  // +=
+    BaseMatrixT &operator-=(const BaseMatrixT &subtrahend);  // -=
+    BaseMatrixT operator*(const BaseMatrixT &multiplier) const;  // 矩阵乘法
+    BaseMatrixT operator*(const T &scalar) const;  // 矩阵数乘
+    
+    BaseMatrixT Inverse() const;  // 矩阵求逆, 返回该矩阵的逆矩阵
+    BaseMatrixT Trans() const;  // 矩阵转置, 返回该矩阵的转置矩阵
+    BaseMatrixT Solve(const BaseMatrixT &b) const;  // 解线性方程组A·X = B, 返回X
+    int Cholesky(BaseMatrixT &l) const;  // Cholesky分解A = L·Lᵀ
+    T Trace() const;  // 矩阵求迹
+    BaseMatrixT Exp() const;  // 矩阵指数e^A
     void setZero();  // 将矩阵置零
-    void InsertRow(const std::vector<double> &vec, const int &aim_row);  // 矩阵扩展, 加一行
-    void InsertCol(const std::vector<double> &vec, const int &aim_col);  // 矩阵扩展, 加一列
+    void Reserve(const int &row_capacity, const int &col_capacity);  // 预留行列容量
+    void InsertRow(const std::vector<T> &vec, const int &aim_row);  // 矩阵扩展, 加一行
+    void InsertCol(const std::vector<T> &vec, const int &aim_col);  // 矩阵扩展, 加一列
     void EraseRow(const int &aim_row);  // 去掉一行
     void EraseCol(const int &aim_col);  // 去掉一列
     
     // get
     int get_row_num() const;
     int get_col_num() const;
-    std::vector<double> get_mat() const;
+    int get_row_capacity() const;
+    int get_col_capacity() const;
+    std::pmr::memory_resource *get_resource() const;
+    std::vector<T> get_mat() const;
     
     // set
     void set_row(const int &row);
     void set_col(const int &col);
   
   private:
+    static bool UseBlas(const int &m, const int &n, const int &k);  // m×k与k×n的乘法量是否交给BLAS
+    void Reshape(const int &row_num, const int &col_num);  // 改变行列数, 不保留元素
+    bool CheckBlock(const int &row, const int &col,
+                    const int &row_num, const int &col_num) const;  // 检查子矩阵是否在范围内
+    
     int row_num_ = 1;  // 矩阵行数
     int col_num_ = 1;  // 矩阵列数
-    std::vector<double> mat_ = std::vector<double>(1, 0.0);  // 矩阵的一维数组存储
+    int ld_ = 1;  // 行跨度, 即列容量
+    std::pmr::vector<T> mat_ = std::pmr::vector<T>(1, 0.0);  // 矩阵的一维数组存储, 大小为行容量×ld_
+};
+
+using BaseMatrix = BaseMatrixT<double>;  // 双精度矩阵
+using BaseMatrixF = BaseMatrixT<float>;  // 单精度矩阵
+extern template class BaseMatrixT<double>;
+extern template class BaseMatrixT<float>;
+
+/**@class   BaseBlock
+ * @brief   BaseMatrixT的子矩阵视图, 按父矩阵的行跨度读写, 不复制元素
+ * @details T为double、float时可写, 为const double、const float时只读。赋值和+=、-=的右边可以是另一种元素类型,
+ *          逐元素转换, 如由双精度算出的子矩阵写入单精度矩阵。R、C为编译期常量时循环次数固定, 用于3×3等小块;
+ *          为kBlockDynamic时行列数在运行时确定。赋值、+=、-=要求左右行列数一致, 不一致时打印错误且不修改。
+ *          定义LC_BOUNDS_CHECK(CMake选项LOOSECOUPLED_BOUNDS_CHECK)时检查子矩阵范围和元素下标,
+ *          越界时打印错误且操作不生效; 未定义时不做检查。
+ *          父矩阵改变行列数或容量后视图失效; 赋值两边不能是同一矩阵中相互重叠的子矩阵
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Author      <th>Description
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>Initialize
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>元素类型改为模板参数, 可以在不同元素类型之间赋值
+ * </table>
+ */
+template<typename T, int R, int C>
+class BaseBlock
+{
+    static_assert((R > 0 || R == kBlockDynamic) && (C > 0 || C == kBlockDynamic),
+                  "block size must be positive or kBlockDynamic");
+    
+  public:
+    using Scalar = std::remove_const_t<T>;  // 元素类型
+    
+    BaseBlock(T *data, const int &ld, const int &row_num, const int &col_num)
+            : data_(data), ld_(ld), row_num_(row_num), col_num_(col_num) {}
+    BaseBlock(const BaseBlock &src) = default;  // 复制视图本身, 不复制元素
+    template<typename U, typename = std::enable_if_t<std::is_same_v<const U, T>>>
+    BaseBlock(const BaseBlock<U, R, C> &src)
+            : data_(src.data()), ld_(src.get_ld()),
+              row_num_(src.get_row_num()), col_num_(src.get_col_num()) {}  // 可写视图转为只读视图
+    
+    BaseBlock &operator=(const BaseBlock &src);  // 逐元素复制
+    template<typename U, int R2, int C2>
+    BaseBlock &operator=(const BaseBlock<U, R2, C2> &src);  // 逐元素复制
+    template<typename U>
+    BaseBlock &operator=(const BaseMatrixT<U> &src);  // 逐元素复制
+    template<typename U, int R2, int C2>
+    BaseBlock &operator+=(const BaseBlock<U, R2, C2> &src);  // +=
+    template<typename U>
+    BaseBlock &operator+=(const BaseMatrixT<U> &src);  // +=
+    template<typename U, int R2, int C2>
+    BaseBlock &operator-=(const BaseBlock<U, R2, C2> &src);  // -=
+    template<typename U>
+    BaseBlock &operator-=(const BaseMatrixT<U> &src);  // -=
+    BaseBlock &operator*=(const Scalar &scalar);  // 数乘
+    T &operator()(const int &row, const int &col) const;  // 访问元素
+    
+    void setZero();  // 置零
+    void setIdentity();  // 置为单位阵, 非方阵时为主对角线为1
+    BaseMatrixT<Scalar> ToMatrix() const;  // 复制为紧凑存储的矩阵
+    
+    // get
+    int get_row_num() const { return R == kBlockDynamic ? row_num_ : R; }
+    int get_col_num() const { return C == kBlockDynamic ? col_num_ : C; }
+    int get_ld() const { return ld_; }
+    T *data() const { return data_; }
+  
+  private:
+    template<typename U, int R2, int C2, typename Op>
+    BaseBlock &Apply(const BaseBlock<U, R2, C2> &src, const char *name, Op op);  // 逐元素运算
+    
+    T *data_{};  // 左上角元素地址, 越界检查失败时为空
+    int ld_{};  // 行跨度, 与父矩阵相同
+    int row_num_{};  // 行数
+    int col_num_{};  // 列数
 };
 
+/**@brief       转换元素类型, 如单精度的协方差阵转为双精度输出
+ * @param[in]   resource    结果使用的内存资源
+ * @return      元素类型为U的紧凑存储矩阵
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename T>
+template<typename U>
+BaseMatrixT<U> BaseMatrixT<T>::Cast(std::pmr::memory_resource *resource) const
+{
+    BaseMatrixT<U> result(row_num_, col_num_, resource);
+    for(int i = 0; i < row_num_; ++i)
+        for(int j = 0; j < col_num_; ++j)
+            result.mat_[i*col_num_ + j] = static_cast<U>(mat_[i*ld_ + j]);
+    return result;
+}
+
+/**@brief       R×C固定大小的子矩阵视图
+ * @param[in]   row         左上角行号
+ * @param[in]   col         左上角列号
+ * @return      子矩阵视图
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename T>
+template<int R, int C>
+BaseBlock<T, R, C> BaseMatrixT<T>::block(const int &row, const int &col)
+{
+#ifdef LC_BOUNDS_CHECK
+    if(!CheckBlock(row, col, R, C))
+        return {nullptr, ld_, R, C};
+#endif
+    return {mat_.data() + row*ld_ + col, ld_, R, C};
+}
+
+template<typename T>
+template<int R, int C>
+BaseBlock<const T, R, C> BaseMatrixT<T>::block(const int &row, const int &col) const
+{
+#ifdef LC_BOUNDS_CHECK
+    if(!CheckBlock(row, col, R, C))
+        return {nullptr, ld_, R, C};
+#endif
+    return {mat_.data() + row*ld_ + col, ld_, R, C};
+}
+
+template<typename T, int R, int C>
+BaseBlock<T, R, C> &BaseBlock<T, R, C>::operator=(const BaseBlock &src)
+{
+    return Apply(src, "assignment", [](Scalar &dst, const auto &val) { dst = val; });
+}
+
+template<typename T, int R, int C>
+template<typename U, int R2, int C2>
+BaseBlock<T, R, C> &BaseBlock<T, R, C>::operator=(const BaseBlock<U, R2, C2> &src)
+{
+    return Apply(src, "assignment", [](Scalar &dst, const auto &val) { dst = val; });
+}
+
+template<typename T, int R, int C>
+template<typename U>
+BaseBlock<T, R, C> &BaseBlock<T, R, C>::operator=(const BaseMatrixT<U> &src)
+{
+    return *this = src.block(0, 0, src.get_row_num(), src.get_col_num());
+}
+
+template<typename T, int R, int C>
+template<typename U, int R2, int C2>
+BaseBlock<T, R, C> &BaseBlock<T, R, C>::operator+=(const BaseBlock<U, R2, C2> &src)
+{
+    return Apply(src, "addition", [](Scalar &dst, const auto &val) { dst += val; });
+}
+
+template<typename T, int R, int C>
+template<typename U>
+BaseBlock<T, R, C> &BaseBlock<T, R, C>::operator+=(const BaseMatrixT<U> &src)
+{
+    return *this += src.block(0, 0, src.get_row_num(), src.get_col_num());
+}
+
+template<typename T, int R, int C>
+template<typename U, int R2, int C2>
+BaseBlock<T, R, C> &BaseBlock<T, R, C>::operator-=(const BaseBlock<U, R2, C2> &src)
+{
+    return Apply(src, "subtraction", [](Scalar &dst, const auto &val) { dst -= val; });
+}
+
+template<typename T, int R, int C>
+template<typename U>
+BaseBlock<T, R, C> &BaseBlock<T, R, C>::operator-=(const BaseMatrixT<U> &src)
+{
+    return *this -= src.block(0, 0, src.get_row_num(), src.get_col_num());
+}
+
+template<typename T, int R, int C>
+BaseBlock<T, R, C> &BaseBlock<T, R, C>::operator*=(const Scalar &scalar)
+{
+    static_assert(!std::is_const_v<T>, "cannot modify a read-only block");
+#ifdef LC_BOUNDS_CHECK
+    if(data_ == nullptr)
+        return *this;
+#endif
+    for(int i = 0; i < get_row_num(); ++i)
+        for(int j = 0; j < get_col_num(); ++j)
+            data_[i*ld_ + j] *= scalar;
+    return *this;
+}
+
+/**@brief       访问子矩阵中的元素
+ * @details     定义LC_BOUNDS_CHECK时检查下标, 越界时打印错误并返回一个临时位置, 写入无效, 读出为0
+ * @param[in]   row         子矩阵中的行号
+ * @param[in]   col         子矩阵中的列号
+ * @return      元素的引用
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename T, int R, int C>
+T &BaseBlock<T, R, C>::operator()(const int &row, const int &col) const
+{
+#ifdef LC_BOUNDS_CHECK
+    if(data_ == nullptr || row < 0 || row >= get_row_num() || col < 0 || col >= get_col_num())
+    {
+        printf("Matrix block index error! index: (%d, %d), size: %d×%d\n",
+               row, col, get_row_num(), get_col_num());
+        static thread_local Scalar sink;
+        sink = 0.0;
+        return sink;
+    }
+#endif
+    return data_[row*ld_ + col];
+}
+
+template<typename T, int R, int C>
+void BaseBlock<T, R, C>::setZero()
+{
+    static_assert(!std::is_const_v<T>, "cannot modify a read-only block");
+#ifdef LC_BOUNDS_CHECK
+    if(data_ == nullptr)
+        return;
+#endif
+    for(int i = 0; i < get_row_num(); ++i)
+        for(int j = 0; j < get_col_num(); ++j)
+            data_[i*ld_ + j] = 0.0;
+}
+
+template<typename T, int R, int C>
+void BaseBlock<T, R, C>::setIdentity()
+{
+    setZero();
+#ifdef LC_BOUNDS_CHECK
+    if(data_ == nullptr)
+        return;
+#endif
+    for(int i = 0; i < get_row_num() && i < get_col_num(); ++i)
+        data_[i*ld_ + i] = 1.0;
+}
+
+template<typename T, int R, int C>
+BaseMatrixT<typename BaseBlock<T, R, C>::Scalar> BaseBlock<T, R, C>::ToMatrix() const
+{
+    BaseMatrixT<Scalar> result(get_row_num(), get_col_num());
+    result.block(0, 0, get_row_num(), get_col_num()) = *this;
+    return result;
+}
+
+/**@brief       逐元素运算dst = op(dst, src)
+ * @param[in]   src         右边的子矩阵
+ * @param[in]   name        运算名称, 用于打印错误
+ * @param[in]   op          逐元素运算
+ * @return      *this
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename T, int R, int C>
+template<typename U, int R2, int C2, typename Op>
+BaseBlock<T, R, C> &BaseBlock<T, R, C>::Apply(const BaseBlock<U, R2, C2> &src,
+                                              const char *name, Op op)
+{
+    static_assert(!std::is_const_v<T>, "cannot modify a read-only block");
+    static_assert((R == kBlockDynamic || R2 == kBlockDynamic || R == R2) &&
+                  (C == kBlockDynamic || C2 == kBlockDynamic || C == C2),
+                  "block sizes do not match");
+    const int row_num = get_row_num(), col_num = get_col_num();
+    if(src.get_row_num() != row_num || src.get_col_num() != col_num)
+    {
+        printf("Matrix block %s error! left size: %d×%d, right size: %d×%d\n",
+               name, row_num, col_num, src.get_row_num(), src.get_col_num());
+        return *this;
+    }
+#ifdef LC_BOUNDS_CHECK
+    if(data_ == nullptr || src.data() == nullptr)
+        return *this;
+#endif
+    const int ld_src = src.get_ld();
+    const U *src_data = src.data();
+    for(int i = 0; i < row_num; ++i)
+        for(int j = 0; j < col_num; ++j)
+            op(data_[i*ld_ + j], src_data[i*ld_src + j]);
+    return *this;
+}
+
 
 #endif // LOOSECOUPLED_SRC_BASETK_BASE_MATRIX_H
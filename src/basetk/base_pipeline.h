@@ -0,0 +1,104 @@
+/**@file    base_pipeline.h
+ * @brief   流水线基础组件
+ * @details 声明并实现了有界阻塞队列BoundedQueue, 用于多线程流水线各处理阶段之间的数据传递
+ * @author  Zing Fong\n
+ *          zing.fong.whu\@outlook.com
+ * @date    2026/10/18
+ * @version V1.0
+ **********************************************************************************
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Version  <th>Author     <th>Description
+ * <tr><td>2026/10/18   <td>1.0      <td>Zing Fong  <td>Initialize
+ * </table>
+ **********************************************************************************
+ */
+#ifndef LOOSECOUPLED_SRC_BASETK_BASE_PIPELINE_H
+#define LOOSECOUPLED_SRC_BASETK_BASE_PIPELINE_H
+
+// c/c++系统文件
+#include <condition_variable>
+#include <mutex>
+
+// 其他库的 .h 文件
+#include <deque>
+#include <utility>
+
+// 本项目内 .h 文件
+
+/**@class   BoundedQueue
+ * @brief   有界阻塞队列, 多生产者多消费者
+ * @details 队列满时Push阻塞, 队列空时Pop阻塞; Close之后Push失败,
+ *          Pop在取完剩余元素后返回false, 用于通知下游阶段数据结束
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Author      <th>Description
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>Initialize
+ * </table>
+ */
+template<typename T>
+class BoundedQueue
+{
+  public:
+    explicit BoundedQueue(const int &capacity = 8)
+            : capacity_(capacity > 0 ? capacity : 1) {}
+
+    /**@brief       入队, 队列满时阻塞
+     * @param[in]   item        入队元素
+     * @return      队列已关闭时返回false
+     */
+    bool Push(T item)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_full_.wait(lock, [this] {
+            return closed_ || static_cast<int>(queue_.size()) < capacity_;
+        });
+        if(closed_)
+            return false;
+        queue_.push_back(std::move(item));
+        not_empty_.notify_one();
+        return true;
+    }
+
+    /**@brief       出队, 队列空时阻塞
+     * @param[out]  item        出队元素
+     * @return      队列已关闭且为空时返回false
+     */
+    bool Pop(T &item)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_empty_.wait(lock, [this] { return closed_ || !queue_.empty(); });
+        if(queue_.empty())
+            return false;
+        item = std::move(queue_.front());
+        queue_.pop_front();
+        not_full_.notify_one();
+        return true;
+    }
+
+    /**@brief       关闭队列, 唤醒所有等待的线程
+     */
+    void Close()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+        not_empty_.notify_all();
+        not_full_.notify_all();
+    }
+
+    int get_capacity() const
+    {
+        return capacity_;
+    }
+
+  private:
+    int capacity_{};  // 队列容量
+    bool closed_{};  // 是否已关闭
+    std::deque<T> queue_{};  // 数据
+    std::mutex mutex_{};
+    std::condition_variable not_full_{};
+    std::condition_variable not_empty_{};
+};
+
+
+#endif //LOOSECOUPLED_SRC_BASETK_BASE_PIPELINE_H
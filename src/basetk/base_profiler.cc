@@ -0,0 +1,611 @@
+/**@file    base_profiler.cc
+ * @brief   热点路径计时与计数
+ * @details 实现了各线程计时数据的记录、合并以及退出时的汇总输出, 以及内存申请统计用的operator new/delete
+ * @author  Zing Fong\n
+ *          zing.fong.whu\@outlook.com
+ * @date    2026/10/18
+ * @version V1.0
+ **********************************************************************************
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Version  <th>Author     <th>Description
+ * <tr><td>2026/10/18   <td>1.0      <td>Zing Fong  <td>Initialize
+ * <tr><td>2026/10/18   <td>1.1      <td>Zing Fong  <td>增加了Chrome trace时间线输出
+ * <tr><td>2026/10/18   <td>1.2      <td>Zing Fong  <td>增加了按阶段的堆内存申请统计
+ * </table>
+ **********************************************************************************
+ */
+
+// 本类对应的.h文件
+#include "base_profiler.h"
+// c/c++系统文件
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+// 其他库的 .h 文件
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+// 本项目内 .h 文件
+
+namespace
+{
+constexpr int kStageNum = static_cast<int>(ProfileStage::kNum);
+constexpr int kCounterNum = static_cast<int>(ProfileCounter::kNum);
+
+const char *const kStageName[kStageNum] = {
+        "epoch", "imu read", "gnss read", "mechanization", "attitude update",
+        "velocity update", "position update", "lc predict", "lc calc F",
+        "lc update", "lambda", "rtk prepare", "rtk solve", "output"};
+const char *const kCounterName[kCounterNum] = {"gnss update", "lambda node"};
+
+/**@struct      AllocCount
+ * @brief       一个阶段的内存申请统计
+ */
+struct AllocCount
+{
+    uint64_t alloc_num;  // 申请次数
+    uint64_t alloc_bytes;  // 申请字节数
+    uint64_t free_num;  // 释放次数
+    uint64_t violation_num;  // 稳态下无内存申请阶段的申请次数
+};
+
+// 以下变量都是常量初始化的, operator new中访问时不会触发动态初始化或再次申请内存
+thread_local AllocCount tls_alloc[kStageNum + 1];  // 最后一项为不在任何阶段内
+thread_local int tls_stage = kStageNum;  // 当前所在阶段
+thread_local int tls_alloc_free_stage = -1;  // 当前所在的最外层无内存申请阶段, -1为不在其中
+thread_local int tls_internal = 0;  // 大于0时为Profiler内部申请, 不计入统计
+std::atomic<bool> g_alloc_free[kStageNum];  // 各阶段是否标记为无内存申请
+std::atomic<bool> g_steady{false};  // 是否已进入稳态
+std::atomic<long> g_epoch_num{0};  // 已处理历元数
+std::atomic<long> g_warmup_epoch_num{1000};  // 预热历元数
+
+#ifdef LC_ALLOC_TRACK
+// 只在替换全局operator new/delete时使用
+void CountAlloc(const std::size_t &size)
+{
+    if(tls_internal > 0)
+        return;
+    auto &count = tls_alloc[tls_stage];
+    ++count.alloc_num;
+    count.alloc_bytes += size;
+    if(tls_alloc_free_stage >= 0 && g_steady.load(std::memory_order_relaxed))
+        ++tls_alloc[tls_alloc_free_stage].violation_num;
+}
+
+void CountFree()
+{
+    if(tls_internal == 0)
+        ++tls_alloc[tls_stage].free_num;
+}
+#endif
+
+/**@struct      ProfileData
+ * @brief       各阶段的计时数据
+ */
+struct ProfileData
+{
+    uint64_t calls[kStageNum];  // 调用次数
+    uint64_t total[kStageNum];  // 总计数
+    uint64_t max[kStageNum];  // 最大值
+    uint64_t hist[kStageNum][Profiler::kBinNum];  // 对数直方图
+    uint64_t counters[kCounterNum];  // 计数项
+    AllocCount alloc[kStageNum + 1];  // 内存申请统计
+
+    ProfileData()
+    {
+        memset(this, 0, sizeof(ProfileData));
+    }
+
+    void Merge(const ProfileData &src)
+    {
+        for(int i = 0; i < kStageNum; ++i)
+        {
+            calls[i] += src.calls[i];
+            total[i] += src.total[i];
+            max[i] = max[i] > src.max[i] ? max[i] : src.max[i];
+            for(int j = 0; j < Profiler::kBinNum; ++j)
+                hist[i][j] += src.hist[i][j];
+        }
+        for(int i = 0; i < kCounterNum; ++i)
+            counters[i] += src.counters[i];
+        for(int i = 0; i <= kStageNum; ++i)
+        {
+            alloc[i].alloc_num += src.alloc[i].alloc_num;
+            alloc[i].alloc_bytes += src.alloc[i].alloc_bytes;
+            alloc[i].free_num += src.alloc[i].free_num;
+            alloc[i].violation_num += src.alloc[i].violation_num;
+        }
+    }
+};
+
+/**@struct      TraceEvent
+ * @brief       时间线上的一次计时
+ */
+struct TraceEvent
+{
+    uint64_t begin;  // 开始时刻
+    uint64_t end;  // 结束时刻
+    int stage;  // 阶段
+};
+
+constexpr long kTraceChunkSize = 1L << 14;  // 每块事件数
+constexpr long kTraceMaxEvents = 1L << 22;  // 每个线程最多记录的事件数(约96MB), 超出部分丢弃
+
+/**@struct      TraceBuffer
+ * @brief       线程私有的时间线缓冲区, 按块申请, 已写入的事件不会移动
+ */
+struct TraceBuffer
+{
+    int tid{};  // 线程编号
+    std::string name{};  // 线程名称
+    std::vector<std::unique_ptr<TraceEvent[]>> chunks{};  // 事件块
+    long size{};  // 事件数
+    long dropped{};  // 丢弃的事件数
+
+    void Push(const int &stage, const uint64_t &begin, const uint64_t &end)
+    {
+        if(size >= kTraceMaxEvents)
+        {
+            ++dropped;
+            return;
+        }
+        if(size%kTraceChunkSize == 0)
+            chunks.emplace_back(new TraceEvent[kTraceChunkSize]);
+        chunks.back()[size%kTraceChunkSize] = {begin, end, stage};
+        ++size;
+    }
+
+    const TraceEvent &at(const long &i) const
+    {
+        return chunks[i/kTraceChunkSize][i%kTraceChunkSize];
+    }
+};
+
+/**@struct      GlobalProfile
+ * @brief       全局汇总, 析构时(进程退出)打印结果并写出时间线
+ */
+struct GlobalProfile
+{
+    std::mutex mutex{};
+    ProfileData data{};
+    uint64_t start_tick = Profiler::Tick();  // 用于TSC标定, 也是时间线的零点
+    std::chrono::steady_clock::time_point start_time =
+            std::chrono::steady_clock::now();
+    std::atomic<bool> trace_enabled{false};  // 是否记录时间线
+    std::string trace_file_path{};  // 时间线文件路径
+    int next_tid = 0;  // 下一个线程编号
+    std::vector<TraceBuffer> traces{};  // 已结束线程的时间线
+
+    ~GlobalProfile()
+    {
+#ifdef LC_PROFILE
+        Profiler::Report();
+#endif
+        if(trace_enabled)
+            WriteTrace();
+    }
+
+    double NsPerTick() const;
+    void WriteTrace();
+};
+
+GlobalProfile &Global()
+{
+    static GlobalProfile global{};
+    return global;
+}
+
+/**@struct      ThreadProfile
+ * @brief       线程私有数据, 线程结束时合并到全局
+ */
+struct ThreadProfile
+{
+    ProfileData data{};
+    TraceBuffer trace{};
+    GlobalProfile &global;
+
+    ThreadProfile() : global(Global())  // 保证全局数据先于本对象构造, 从而后于本对象析构
+    {
+        ++tls_internal;
+        std::lock_guard<std::mutex> lock(global.mutex);
+        trace.tid = global.next_tid++;
+        trace.name = "thread " + std::to_string(trace.tid);
+        --tls_internal;
+    }
+
+    ~ThreadProfile()
+    {
+        ++tls_internal;
+        memcpy(data.alloc, tls_alloc, sizeof(tls_alloc));
+        memset(tls_alloc, 0, sizeof(tls_alloc));
+        std::lock_guard<std::mutex> lock(global.mutex);
+        global.data.Merge(data);
+        if(trace.size > 0)
+            global.traces.push_back(std::move(trace));
+        --tls_internal;
+    }
+};
+
+ThreadProfile &Local()
+{
+    thread_local ThreadProfile local{};
+    return local;
+}
+
+/**@brief       计数值所在的直方图档, 每倍程分8档
+ */
+int BinIndex(const uint64_t &ticks)
+{
+    if(ticks < 8)
+        return static_cast<int>(ticks);
+    int msb = 63;
+    while(!(ticks >> msb))
+        --msb;
+    return (msb - 2)*8 + static_cast<int>((ticks >> (msb - 3)) & 7);
+}
+
+/**@brief       直方图档的下界
+ */
+double BinLower(const int &bin)
+{
+    if(bin < 8)
+        return bin;
+    int msb = bin/8 + 2;
+    return static_cast<double>((8ULL + bin%8) << (msb - 3));
+}
+
+/**@brief       直方图的百分位数, 取所在档的中点
+ */
+double Percentile(const uint64_t *hist, const uint64_t &calls,
+                  const double &ratio)
+{
+    auto target = static_cast<uint64_t>(ratio*static_cast<double>(calls));
+    uint64_t sum = 0;
+    for(int i = 0; i < Profiler::kBinNum; ++i)
+    {
+        sum += hist[i];
+        if(sum > target)
+            return i + 1 < Profiler::kBinNum ?
+                   0.5*(BinLower(i) + BinLower(i + 1)) : BinLower(i);
+    }
+    return 0.0;
+}
+
+/**@brief       计时器计数与ns的换算系数
+ */
+double GlobalProfile::NsPerTick() const
+{
+#ifdef LC_PROFILE_HAS_TSC
+    double ns = std::chrono::duration<double, std::nano>(
+            std::chrono::steady_clock::now() - start_time).count();
+    uint64_t ticks = Profiler::Tick() - start_tick;
+    if(ticks > 0)
+        return ns/static_cast<double>(ticks);
+#endif
+    return 1.0;
+}
+
+/**@brief       时间线写为Chrome trace格式的JSON文件
+ * @details     每次计时为一个完整事件(ph为X), 时间单位为μs; 每个线程另有一个thread_name元数据事件
+ */
+void GlobalProfile::WriteTrace()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    FILE *file_ptr = fopen(trace_file_path.c_str(), "w");
+    if(file_ptr == nullptr)
+    {
+        printf("Cannot open trace file! file path: %s\n",
+               trace_file_path.c_str());
+        return;
+    }
+    std::sort(traces.begin(), traces.end(),
+              [](const TraceBuffer &a, const TraceBuffer &b)
+              {
+                  return a.tid < b.tid;
+              });
+    double us_per_tick = NsPerTick()*1e-3;
+    auto to_us = [this, &us_per_tick](const uint64_t &tick)
+    {
+        return static_cast<double>(static_cast<int64_t>(tick - start_tick))*
+               us_per_tick;
+    };
+
+    long event_num = 0, dropped_num = 0;
+    const char *separator = "";
+    fprintf(file_ptr, "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [\n");
+    for(const auto &a_trace: traces)
+    {
+        fprintf(file_ptr, "%s{\"name\": \"thread_name\", \"ph\": \"M\", "
+                          "\"pid\": 1, \"tid\": %d, \"args\": {\"name\": \"%s\"}}",
+                separator, a_trace.tid, a_trace.name.c_str());
+        separator = ",\n";
+        for(long i = 0; i < a_trace.size; ++i)
+        {
+            const auto &event = a_trace.at(i);
+            fprintf(file_ptr, ",\n{\"name\": \"%s\", \"ph\": \"X\", \"pid\": 1, "
+                              "\"tid\": %d, \"ts\": %.3f, \"dur\": %.3f}",
+                    kStageName[event.stage], a_trace.tid, to_us(event.begin),
+                    static_cast<double>(event.end - event.begin)*us_per_tick);
+        }
+        event_num += a_trace.size;
+        dropped_num += a_trace.dropped;
+    }
+    fprintf(file_ptr, "\n]}\n");
+    fclose(file_ptr);
+    printf("trace: %ld events written to %s", event_num,
+           trace_file_path.c_str());
+    if(dropped_num > 0)
+        printf(", %ld events dropped", dropped_num);
+    printf("\n");
+}
+}
+
+/**@brief       记录一次耗时
+ * @param[in]   stage       阶段
+ * @param[in]   begin       开始时刻(计时器计数)
+ * @param[in]   end         结束时刻(计时器计数)
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void Profiler::Record(const ProfileStage &stage, const uint64_t &begin,
+                      const uint64_t &end)
+{
+    auto &local = Local();
+    auto &data = local.data;
+    uint64_t ticks = end - begin;
+    int i = static_cast<int>(stage);
+    ++data.calls[i];
+    data.total[i] += ticks;
+    if(ticks > data.max[i])
+        data.max[i] = ticks;
+    ++data.hist[i][BinIndex(ticks)];
+    if(local.global.trace_enabled.load(std::memory_order_relaxed))
+    {
+        ++tls_internal;
+        local.trace.Push(i, begin, end);
+        --tls_internal;
+    }
+}
+
+/**@brief       计数
+ * @param[in]   counter     计数项
+ * @param[in]   n           增加的数量
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void Profiler::Count(const ProfileCounter &counter, const uint64_t &n)
+{
+    Local().data.counters[static_cast<int>(counter)] += n;
+}
+
+/**@brief       打印汇总结果
+ * @details     只包含已结束线程的数据。进程退出时主线程数据已经合并, 所以结果是完整的。
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void Profiler::Report()
+{
+    auto &global = Global();
+    std::lock_guard<std::mutex> lock(global.mutex);
+    const auto &data = global.data;
+
+    double ns_per_tick = global.NsPerTick();  // 计时器计数换算为ns
+
+    printf("profile (ns):\n%-18s %12s %12s %10s %10s %10s %12s\n", "stage",
+           "calls", "total(ms)", "mean", "p50", "p99", "max");
+    for(int i = 0; i < kStageNum; ++i)
+    {
+        if(data.calls[i] == 0)
+            continue;
+        printf("%-18s %12llu %12.3f %10.1f %10.1f %10.1f %12.1f\n",
+               kStageName[i], static_cast<unsigned long long>(data.calls[i]),
+               data.total[i]*ns_per_tick*1e-6,
+               data.total[i]*ns_per_tick/data.calls[i],
+               Percentile(data.hist[i], data.calls[i], 0.50)*ns_per_tick,
+               Percentile(data.hist[i], data.calls[i], 0.99)*ns_per_tick,
+               data.max[i]*ns_per_tick);
+    }
+    for(int i = 0; i < kCounterNum; ++i)
+        if(data.counters[i] > 0)
+            printf("%-18s %12llu\n", kCounterName[i],
+                   static_cast<unsigned long long>(data.counters[i]));
+#ifdef LC_ALLOC_TRACK
+    printf("allocation:\n%-18s %12s %14s %12s %12s %12s\n", "stage", "allocs",
+           "bytes", "allocs/call", "frees", "violations");
+    for(int i = 0; i <= kStageNum; ++i)
+    {
+        const auto &count = data.alloc[i];
+        if(count.alloc_num == 0 && count.free_num == 0)
+            continue;
+        bool other = i == kStageNum;
+        printf("%-18s %12llu %14llu %12.2f %12llu %12llu\n",
+               other ? "other" : kStageName[i],
+               static_cast<unsigned long long>(count.alloc_num),
+               static_cast<unsigned long long>(count.alloc_bytes),
+               !other && data.calls[i] > 0 ?
+               static_cast<double>(count.alloc_num)/data.calls[i] : 0.0,
+               static_cast<unsigned long long>(count.free_num),
+               static_cast<unsigned long long>(count.violation_num));
+    }
+#endif
+}
+
+/**@brief       开启时间线记录
+ * @details     只记录开启之后的计时, 进程退出时写入文件。未定义LC_PROFILE时没有计时点, 只给出提示。
+ * @param[in]   trace_file_path     时间线文件路径
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void Profiler::EnableTrace(const std::string &trace_file_path)
+{
+#ifdef LC_PROFILE
+    auto &global = Global();
+    {
+        std::lock_guard<std::mutex> lock(global.mutex);
+        global.trace_file_path = trace_file_path;
+    }
+    global.trace_enabled = true;
+#else
+    printf("Trace file %s ignored, build with LOOSECOUPLED_PROFILE=ON to "
+           "enable timing\n", trace_file_path.c_str());
+#endif
+}
+
+/**@brief       设置当前线程在时间线中的名称
+ * @param[in]   name        线程名称
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void Profiler::SetThreadName(const char *name)
+{
+    Local().trace.name = name;
+}
+
+/**@brief       进入阶段, 之后的内存申请记在该阶段上
+ * @details     进入被标记为无内存申请的阶段后, 其中嵌套的各阶段内的申请也记为该阶段的违例
+ * @param[in]   stage       阶段
+ * @return      之前所在的阶段
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int Profiler::EnterStage(const ProfileStage &stage)
+{
+    int prev_stage = tls_stage;
+    tls_stage = static_cast<int>(stage);
+    if(tls_alloc_free_stage < 0 &&
+       g_alloc_free[tls_stage].load(std::memory_order_relaxed))
+        tls_alloc_free_stage = tls_stage;
+    return prev_stage;
+}
+
+/**@brief       离开阶段
+ * @param[in]   prev_stage  EnterStage返回的外层阶段
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void Profiler::LeaveStage(const int &prev_stage)
+{
+    if(tls_alloc_free_stage == tls_stage)
+        tls_alloc_free_stage = -1;
+    tls_stage = prev_stage;
+}
+
+/**@brief       标记阶段在稳态下不应申请内存
+ * @param[in]   stage_name  阶段名称, 与统计结果中的名称相同, 如"mechanization", "lc predict"
+ * @param[in]   alloc_free  true为标记, false为取消标记
+ * @return      0为正常, -1为阶段名称不存在
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int Profiler::SetAllocFree(const std::string &stage_name, const bool &alloc_free)
+{
+    for(int i = 0; i < kStageNum; ++i)
+    {
+        if(stage_name == kStageName[i])
+        {
+            g_alloc_free[i] = alloc_free;
+            return 0;
+        }
+    }
+    printf("Unknown profile stage: %s\n", stage_name.c_str());
+    return -1;
+}
+
+/**@brief       设置进入稳态前的预热历元数
+ * @param[in]   epoch_num   预热历元数, 0为立即进入稳态
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void Profiler::SetAllocWarmup(const long &epoch_num)
+{
+    g_warmup_epoch_num = epoch_num;
+    g_steady = g_epoch_num >= epoch_num;
+}
+
+/**@brief       历元计数, 所有线程共用, 达到预热历元数后进入稳态
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void Profiler::CountEpoch()
+{
+    if(!g_steady.load(std::memory_order_relaxed) &&
+       ++g_epoch_num >= g_warmup_epoch_num.load(std::memory_order_relaxed))
+        g_steady = true;
+}
+
+/**@brief       稳态下无内存申请阶段的申请次数
+ * @details     包括已结束线程和当前线程, 其他仍在运行的线程不计入
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+long Profiler::GetAllocViolationNum()
+{
+#ifdef LC_ALLOC_TRACK
+    uint64_t violation_num = 0;
+    for(const auto &a_count: tls_alloc)
+        violation_num += a_count.violation_num;
+    auto &global = Global();
+    std::lock_guard<std::mutex> lock(global.mutex);
+    for(const auto &a_count: global.data.alloc)
+        violation_num += a_count.violation_num;
+    return static_cast<long>(violation_num);
+#else
+    return 0;
+#endif
+}
+
+#ifdef LC_ALLOC_TRACK
+// 替换全局operator new/delete, 统计后转交malloc/free
+void *operator new(std::size_t size)
+{
+    CountAlloc(size);
+    void *ptr = std::malloc(size > 0 ? size : 1);
+    if(ptr == nullptr)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void *operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+    CountAlloc(size);
+    return std::malloc(size > 0 ? size : 1);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept
+{
+    return operator new(size, std::nothrow);
+}
+
+void operator delete(void *ptr) noexcept
+{
+    if(ptr == nullptr)
+        return;
+    CountFree();
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    operator delete(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+    operator delete(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t) noexcept
+{
+    operator delete(ptr);
+}
+#endif
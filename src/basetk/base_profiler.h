@@ -0,0 +1,189 @@
+/**@file    base_profiler.h
+ * @brief   热点路径计时与计数
+ * @details 编译期开关控制的低开销计时器和计数器, 用于定位一个历元内的耗时分布。
+ *          定义LC_PROFILE(CMake选项LOOSECOUPLED_PROFILE)时生效, 否则LC_PROFILE_*宏展开为空, 没有任何开销。
+ *          定义LC_ALLOC_TRACK(CMake选项LOOSECOUPLED_ALLOC_TRACK)时还替换全局operator new/delete,
+ *          按当前所在的计时阶段统计堆内存申请次数和字节数。
+ * @author  Zing Fong\n
+ *          zing.fong.whu\@outlook.com
+ * @date    2026/10/18
+ * @version V1.0
+ **********************************************************************************
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Version  <th>Author     <th>Description
+ * <tr><td>2026/10/18   <td>1.0      <td>Zing Fong  <td>Initialize
+ * <tr><td>2026/10/18   <td>1.1      <td>Zing Fong  <td>增加了Chrome trace时间线输出
+ * <tr><td>2026/10/18   <td>1.2      <td>Zing Fong  <td>增加了按阶段的堆内存申请统计
+ * </table>
+ **********************************************************************************
+ */
+#ifndef LOOSECOUPLED_SRC_BASETK_BASE_PROFILER_H
+#define LOOSECOUPLED_SRC_BASETK_BASE_PROFILER_H
+
+// c/c++系统文件
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#define LC_PROFILE_HAS_TSC
+#endif
+
+// 其他库的 .h 文件
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+// 本项目内 .h 文件
+
+/**@enum    ProfileStage
+ * @brief   计时的处理阶段
+ */
+enum class ProfileStage : int
+{
+    kEpoch = 0,  // 松组合/纯惯导一个IMU历元的完整处理
+    kImuRead,  // SinsFileStream::ReadImuFile
+    kGnssRead,  // GnssPos::ReadOneSec
+    kMechanization,  // SinsMechanization::ImuMechanization
+    kAttitudeUpdate,  // SinsMechanization::AttitudeUpdate
+    kVelocityUpdate,  // SinsMechanization::VelocityUpdate
+    kPositionUpdate,  // SinsMechanization::PositionUpdate
+    kPredict,  // SinsLooseCoupled::Predict
+    kCalcF,  // SinsLooseCoupled::CalcF
+    kUpdate,  // SinsLooseCoupled::Update
+    kLambda,  // LambdaSolver::Solve/PartialSolve
+    kRtkPrepare,  // RTK流水线读取与预处理(含卫星位置计算)
+    kRtkSolve,  // RTK流水线双差解算
+    kOutput,  // 结果输出
+    kNum  // 阶段数
+};
+
+/**@enum    ProfileCounter
+ * @brief   计数项
+ */
+enum class ProfileCounter : int
+{
+    kGnssUpdate = 0,  // GNSS量测更新次数
+    kLambdaNode,  // LAMBDA搜索节点数
+    kNum  // 计数项数
+};
+
+/**@class   Profiler
+ * @brief   计时与计数的汇总
+ * @details 每个线程在thread_local中记录各阶段的调用次数、总耗时、最大值和对数直方图(每倍程8档, 每档宽12.5%),
+ *          记录时不加锁。线程结束时将数据合并到全局, 进程退出时打印各阶段的p50/p99/max。\n
+ *          x86下用TSC计时, 退出时按steady_clock标定换算为ns; 其他平台直接用steady_clock。
+ *          开启时间线后, 每次计时的起止时刻另外追加到线程私有的分块缓冲区中(只有本线程写, 不需要同步),
+ *          进程退出时写为Chrome trace格式的JSON文件, 可以在chrome://tracing或Perfetto中查看各线程的阶段分布。
+ *          内存申请统计: 计时作用域嵌套时记在最内层阶段上, 不在任何阶段内的记为other。被标记为无内存申请的阶段
+ *          (包括其中嵌套的阶段)在稳态(预热历元数之后)申请内存时记为该阶段的违例, 用于防止这些路径上重新出现临时对象。
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Author      <th>Description
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>Initialize
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>增加了Chrome trace时间线输出
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>增加了按阶段的堆内存申请统计
+ * </table>
+ */
+class Profiler
+{
+  public:
+    static constexpr int kBinNum = 64*8;  // 直方图档数
+
+    /**@brief       读取计时器
+     * @return      x86下为TSC计数, 其他平台为ns
+     */
+    static uint64_t Tick()
+    {
+#ifdef LC_PROFILE_HAS_TSC
+        return __rdtsc();
+#else
+        return static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    static void Record(const ProfileStage &stage, const uint64_t &begin,
+                       const uint64_t &end);  // 记录一次耗时
+    static void Count(const ProfileCounter &counter, const uint64_t &n);  // 计数
+    static void Report();  // 打印汇总结果
+    static void EnableTrace(const std::string &trace_file_path);  // 开启时间线记录, 退出时写入文件
+    static void SetThreadName(const char *name);  // 设置当前线程在时间线中的名称
+
+    // 内存申请统计
+    static int EnterStage(const ProfileStage &stage);  // 进入阶段, 返回之前所在的阶段
+    static void LeaveStage(const int &prev_stage);  // 离开阶段, 恢复之前所在的阶段
+    static int SetAllocFree(const std::string &stage_name,
+                            const bool &alloc_free = true);  // 标记阶段在稳态下不应申请内存
+    static void SetAllocWarmup(const long &epoch_num);  // 设置进入稳态前的预热历元数
+    static void CountEpoch();  // 历元计数, 达到预热历元数后进入稳态
+    static long GetAllocViolationNum();  // 稳态下无内存申请阶段的申请次数
+};
+
+/**@class   ProfileScope
+ * @brief   作用域计时器, 构造时开始计时, 析构时记录
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Author      <th>Description
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>Initialize
+ * </table>
+ */
+class ProfileScope
+{
+  public:
+    explicit ProfileScope(const ProfileStage &stage) : stage_(stage)
+    {
+#ifdef LC_ALLOC_TRACK
+        prev_stage_ = Profiler::EnterStage(stage);
+#endif
+        start_ = Profiler::Tick();
+    }
+    ~ProfileScope()
+    {
+        uint64_t end = Profiler::Tick();
+#ifdef LC_ALLOC_TRACK
+        Profiler::LeaveStage(prev_stage_);
+#endif
+        Profiler::Record(stage_, start_, end);
+    }
+    ProfileScope(const ProfileScope &) = delete;
+    ProfileScope &operator=(const ProfileScope &) = delete;
+
+  private:
+    ProfileStage stage_;  // 阶段
+    uint64_t start_{};  // 开始时刻
+#ifdef LC_ALLOC_TRACK
+    int prev_stage_{};  // 外层阶段
+#endif
+};
+
+#define LC_PROFILE_CONCAT_IMPL(a, b) a##b
+#define LC_PROFILE_CONCAT(a, b) LC_PROFILE_CONCAT_IMPL(a, b)
+
+#ifdef LC_PROFILE
+// 对当前作用域计时
+#define LC_PROFILE_SCOPE(stage) \
+    ProfileScope LC_PROFILE_CONCAT(lc_profile_scope_, __LINE__)(ProfileStage::stage)
+// 计数加n
+#define LC_PROFILE_COUNT(counter, n) \
+    Profiler::Count(ProfileCounter::counter, static_cast<uint64_t>(n))
+// 设置当前线程名称
+#define LC_PROFILE_THREAD_NAME(name) Profiler::SetThreadName(name)
+#else
+#define LC_PROFILE_SCOPE(stage) do {} while(0)
+#define LC_PROFILE_COUNT(counter, n) do {} while(0)
+#define LC_PROFILE_THREAD_NAME(name) do {} while(0)
+#endif
+
+#ifdef LC_ALLOC_TRACK
+// 一个历元处理完毕, 用于判断是否进入稳态
+#define LC_ALLOC_EPOCH() Profiler::CountEpoch()
+#else
+#define LC_ALLOC_EPOCH() do {} while(0)
+#endif
+
+
+#endif //LOOSECOUPLED_SRC_BASETK_BASE_PROFILER_H
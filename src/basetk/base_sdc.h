@@ -10,6 +10,7 @@
  * <table>
  * <tr><th>Date         <th>Version  <th>Author     <th>Description
  * <tr><td>2022/5/27    <td>1.0      <td>Zing Fong  <td>Initialize
+ * <tr><td>2026/10/18   <td>1.1      <td>Zing Fong  <td>最大卫星数提高到四系统接收机的水平
  * </table>
  **********************************************************************************
  */
@@ -102,7 +103,7 @@ class BaseSdc
                     7.292115e-5
             };  // CGCS2000坐标系参数
     
-    static constexpr int kMaxChannelNum = 36;  // 一秒最多可观测到的卫星数
+    static constexpr int kMaxChannelNum = 128;  // 一秒最多可观测到的卫星数, 四系统接收机常超过60颗
     static constexpr int kMaxGpsNum = 32;  // GPS最大卫星数
     static constexpr int kMaxBdsNum = 63;  // BDS最大卫星数
 };
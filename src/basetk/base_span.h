@@ -0,0 +1,59 @@
+/**@file    base_span.h
+ * @brief   连续内存视图
+ * @details C++17中没有std::span, 这里只实现按列访问观测值等场景用到的部分: 指针加长度, 不拥有内存
+ * @author  Zing Fong\n
+ *          zing.fong.whu\@outlook.com
+ * @date    2026/10/18
+ * @version V1.0
+ **********************************************************************************
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Version  <th>Author     <th>Description
+ * <tr><td>2026/10/18   <td>1.0      <td>Zing Fong  <td>Initialize
+ * </table>
+ **********************************************************************************
+ */
+#ifndef LOOSECOUPLED_SRC_BASETK_BASE_SPAN_H
+#define LOOSECOUPLED_SRC_BASETK_BASE_SPAN_H
+
+// c/c++系统文件
+
+// 其他库的 .h 文件
+#include <type_traits>
+
+// 本项目内 .h 文件
+
+/**@class   BaseSpan
+ * @brief   连续内存视图, 指向一段长度为size的数组
+ * @details 可以从BaseSpan<T>隐式转换为BaseSpan<const T>。不做越界检查, 用于热点路径上的循环
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Author      <th>Description
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>Initialize
+ * </table>
+ */
+template<typename T>
+class BaseSpan
+{
+  public:
+    constexpr BaseSpan() = default;
+    constexpr BaseSpan(T *data, const int &size) : data_(data), size_(size) {}
+    template<typename U, typename = std::enable_if_t<std::is_same_v<const U, T>>>
+    constexpr BaseSpan(const BaseSpan<U> &other) : data_(other.data()), size_(other.size()) {}
+
+    constexpr T &operator[](const int &i) const { return data_[i]; }
+    constexpr T *begin() const { return data_; }
+    constexpr T *end() const { return data_ + size_; }
+
+    // get
+    constexpr T *data() const { return data_; }
+    constexpr int size() const { return size_; }
+    constexpr bool empty() const { return size_ == 0; }
+
+  private:
+    T *data_{};  // 首元素地址
+    int size_{};  // 元素个数
+};
+
+
+#endif //LOOSECOUPLED_SRC_BASETK_BASE_SPAN_H
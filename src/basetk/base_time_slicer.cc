@@ -0,0 +1,315 @@
+/**@file    base_time_slicer.cc
+ * @brief   分时段并行后处理.cc文件
+ * @details 实现了时间窗口的划分、多线程调度、按顺序流式拼接以及一致性统计
+ * @author  Zing Fong\n
+ *          zing.fong.whu\@outlook.com
+ * @date    2026/10/18
+ * @version V1.0
+ **********************************************************************************
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Version  <th>Author     <th>Description
+ * <tr><td>2026/10/18   <td>1.0      <td>Zing Fong  <td>Initialize
+ * <tr><td>2026/10/18   <td>1.1      <td>Zing Fong  <td>工作线程在时间线中命名
+ * <tr><td>2026/10/18   <td>1.2      <td>Zing Fong  <td>按窗口顺序流式输出并及时释放结果, 拼接差超限时警告
+ * </table>
+ **********************************************************************************
+ */
+
+// 本类对应的.h文件
+#include "base_time_slicer.h"
+// c/c++系统文件
+#include <thread>
+// 其他库的 .h 文件
+#include <atomic>
+#include <cmath>
+#include <mutex>
+#include <string>
+
+// 本项目内 .h 文件
+#include "base_profiler.h"
+
+/**@brief       读取窗口参数和拼接差阈值
+ * @param[in]   config          配置表
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void TimeSlicer::Init(const Config &config)
+{
+    set_window(config.ReadFloat("BASE", "window_length", 3600.0f),
+               config.ReadFloat("BASE", "window_overlap", 300.0f));
+    set_thread_num(config.ReadInt("BASE", "thread_num", 0));
+    set_max_diff(config.ReadFloat("BASE", "window_max_diff", 0.5f));
+}
+
+/**@brief       划分时间窗口
+ * @param[in]   t_begin         任务开始时刻
+ * @param[in]   t_end           任务结束时刻
+ * @return      时间窗口列表, 第一个窗口没有预热段
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+std::vector<TimeWindow> TimeSlicer::Split(const double &t_begin,
+                                          const double &t_end) const
+{
+    std::vector<TimeWindow> windows;
+    if(t_end <= t_begin)
+    {
+        printf("TimeSlicer split error! begin: %.3f, end: %.3f\n", t_begin,
+               t_end);
+        return windows;
+    }
+    int num = static_cast<int>(ceil((t_end - t_begin)/window_length_));
+    for(int i = 0; i < num; ++i)
+    {
+        TimeWindow window{};
+        window.id = i;
+        window.begin = t_begin + i*window_length_;
+        window.end = i == num - 1 ? t_end : window.begin + window_length_;
+        window.warm_begin = i == 0 ? window.begin :
+                            fmax(t_begin, window.begin - overlap_);
+        windows.push_back(window);
+    }
+    return windows;
+}
+
+/**@brief       各窗口并行解算, 按窗口顺序流式拼接输出
+ * @details     窗口解算完成后存入结果表, 若之前的窗口都已输出, 则由该线程在锁内依次输出
+ *              所有已完成且轮到的窗口, 并释放已不再需要的前一窗口结果。
+ *              输出回调只在锁内被调用, 所以按时间顺序串行执行, 回调内可以直接写文件
+ * @param[in]   t_begin         任务开始时刻
+ * @param[in]   t_end           任务结束时刻
+ * @param[in]   process         单个窗口的解算回调, 各线程同时调用, 回调内不能共享可写状态
+ * @param[in]   output          拼接结果的输出回调
+ * @return      输出的历元数
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+long TimeSlicer::Run(const double &t_begin, const double &t_end,
+                     const WindowFunc &process, const OutputFunc &output)
+{
+    auto windows = Split(t_begin, t_end);
+    int window_num = static_cast<int>(windows.size());
+    std::vector<std::vector<SliceEpoch>> results(window_num);
+    std::vector<char> done(window_num, 0);
+    reports_.clear();
+
+    int thread_num = thread_num_ > 0 ? thread_num_ :
+                     static_cast<int>(std::thread::hardware_concurrency());
+    if(thread_num <= 0)
+        thread_num = 1;
+    if(thread_num > window_num)
+        thread_num = window_num;
+
+    // 各线程依次领取窗口, 长短不一的窗口也能均衡分配
+    std::atomic<int> next{0};
+    std::mutex emit_mutex;
+    int next_emit = 0;  // 下一个待输出的窗口
+    long epoch_num = 0;
+    auto worker = [&]()
+    {
+        for(int i = next++; i < window_num; i = next++)
+        {
+            auto result = process(windows[i]);
+            std::lock_guard<std::mutex> lock(emit_mutex);
+            results[i] = std::move(result);
+            done[i] = 1;
+            for(; next_emit < window_num && done[next_emit]; ++next_emit)
+            {
+                epoch_num += Emit(windows, results, next_emit, output);
+                if(next_emit > 0)
+                    std::vector<SliceEpoch>().swap(results[next_emit - 1]);
+            }
+        }
+    };
+    std::vector<std::thread> threads;
+    for(int i = 1; i < thread_num; ++i)
+        threads.emplace_back([&worker, i]()
+                             {
+                                 LC_PROFILE_THREAD_NAME(
+                                         ("slicer worker " + std::to_string(i)).c_str());
+                                 worker();
+                             });
+    worker();  // 调用线程也参与解算
+    for(auto &a_thread: threads)
+        a_thread.join();
+
+    return epoch_num;
+}
+
+/**@brief       输出一个窗口的有效段, 并统计它与前一窗口在重叠段上的一致性
+ * @details     每个窗口只保留有效段[begin, end)(最后一个窗口包含end)。
+ *              重叠段后半段内, 前一窗口的有效段与本窗口的预热段在相同时刻上比较位置差;
+ *              拼接跳变为前一窗口最后一个输出历元与本窗口第一个输出历元的位置差。
+ * @param[in]   windows         时间窗口
+ * @param[in]   results         各窗口结果, 需要index和index - 1两个窗口
+ * @param[in]   index           输出的窗口序号
+ * @param[in]   output          输出回调
+ * @return      输出的历元数
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+long TimeSlicer::Emit(const std::vector<TimeWindow> &windows,
+                      const std::vector<std::vector<SliceEpoch>> &results,
+                      const int &index, const OutputFunc &output)
+{
+    const double kTimeEps = 1e-6;  // 时间匹配容差(s)
+    auto distance = [](const SliceEpoch &a, const SliceEpoch &b)
+    {
+        double dx = a.xyz[0] - b.xyz[0];
+        double dy = a.xyz[1] - b.xyz[1];
+        double dz = a.xyz[2] - b.xyz[2];
+        return sqrt(dx*dx + dy*dy + dz*dz);
+    };
+
+    const auto &window = windows[index];
+    bool last = index == static_cast<int>(windows.size()) - 1;
+    const SliceEpoch *first_kept = nullptr;
+    long epoch_num = 0;
+    for(const auto &a_epoch: results[index])
+    {
+        if(a_epoch.t < window.begin - kTimeEps)
+            continue;  // 预热段
+        if(last ? a_epoch.t > window.end + kTimeEps :
+           a_epoch.t >= window.end - kTimeEps)
+            break;
+        if(first_kept == nullptr)
+            first_kept = &a_epoch;
+        output(a_epoch);
+        ++epoch_num;
+    }
+    if(index == 0)
+        return epoch_num;
+
+    // 与前一窗口比较, 只取重叠段后半段, 前半段滤波尚未收敛
+    const auto &left_window = windows[index - 1];
+    SliceReport report{};
+    report.left_id = left_window.id;
+    report.right_id = window.id;
+    report.boundary = left_window.end;
+    double compare_begin = 0.5*(window.warm_begin + left_window.end);
+    const auto &left = results[index - 1];
+    const auto &right = results[index];
+    double sum_square = 0.0;
+    for(int l = 0, r = 0; l < static_cast<int>(left.size()) &&
+                          r < static_cast<int>(right.size());)
+    {
+        if(left[l].t < right[r].t - kTimeEps)
+            ++l;
+        else if(right[r].t < left[l].t - kTimeEps)
+            ++r;
+        else
+        {
+            if(left[l].t >= compare_begin - kTimeEps &&
+               left[l].t < left_window.end - kTimeEps)
+            {
+                double diff = distance(left[l], right[r]);
+                report.max_diff = fmax(report.max_diff, diff);
+                sum_square += diff*diff;
+                ++report.epoch_num;
+            }
+            ++l;
+            ++r;
+        }
+    }
+    if(report.epoch_num > 0)
+        report.rms_diff = sqrt(sum_square/report.epoch_num);
+
+    // 前一窗口有效段的最后一个历元
+    const SliceEpoch *left_last = nullptr;
+    for(const auto &a_epoch: left)
+    {
+        if(a_epoch.t >= left_window.end - kTimeEps)
+            break;
+        if(a_epoch.t >= left_window.begin - kTimeEps)
+            left_last = &a_epoch;
+    }
+    if(left_last != nullptr && first_kept != nullptr)
+        report.seam_jump = distance(*left_last, *first_kept);
+    reports_.push_back(report);
+    return epoch_num;
+}
+
+/**@brief       打印各拼接处的一致性报告
+ * @details     最大位置差或拼接跳变超过阈值, 或者重叠段内没有可比较历元的拼接处会给出警告,
+ *              通常是窗口起点的初始化不好或者重叠段内没能对准, 需要加长重叠段
+ * @return      超过阈值的拼接处个数
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int TimeSlicer::PrintReport() const
+{
+    printf("window stitching report (window %.1fs, overlap %.1fs):\n",
+           window_length_, overlap_);
+    printf("%6s %6s %14s %8s %10s %10s %10s\n", "left", "right", "boundary",
+           "epochs", "max(m)", "rms(m)", "jump(m)");
+    int bad_num = 0;
+    for(const auto &a_report: reports_)
+    {
+        bool bad = a_report.epoch_num == 0 || a_report.max_diff > max_diff_ ||
+                   a_report.seam_jump > max_diff_;
+        printf("%6d %6d %14.3f %8d %10.4f %10.4f %10.4f%s\n", a_report.left_id,
+               a_report.right_id, a_report.boundary, a_report.epoch_num,
+               a_report.max_diff, a_report.rms_diff, a_report.seam_jump,
+               bad ? "  !" : "");
+        if(bad)
+            ++bad_num;
+    }
+    if(bad_num > 0)
+        printf("Warning! %d seam(s) exceed window_max_diff %.3fm or have no common epoch\n",
+               bad_num, max_diff_);
+    return bad_num;
+}
+
+double TimeSlicer::get_window_length() const
+{
+    return window_length_;
+}
+
+double TimeSlicer::get_overlap() const
+{
+    return overlap_;
+}
+
+int TimeSlicer::get_thread_num() const
+{
+    return thread_num_;
+}
+
+double TimeSlicer::get_max_diff() const
+{
+    return max_diff_;
+}
+
+const std::vector<SliceReport> &TimeSlicer::get_reports() const
+{
+    return reports_;
+}
+
+void TimeSlicer::set_window(const double &window_length, const double &overlap)
+{
+    if(window_length > 0 && overlap >= 0)
+    {
+        window_length_ = window_length;
+        overlap_ = overlap;
+    }
+    else
+        printf("Set window error! length: %.3f, overlap: %.3f\n",
+               window_length, overlap);
+}
+
+void TimeSlicer::set_thread_num(const int &thread_num)
+{
+    if(thread_num >= 0)
+        thread_num_ = thread_num;
+    else
+        printf("Set thread number error!\n");
+}
+
+void TimeSlicer::set_max_diff(const double &max_diff)
+{
+    if(max_diff > 0)
+        max_diff_ = max_diff;
+    else
+        printf("Set window max diff error! %.3f\n", max_diff);
+}
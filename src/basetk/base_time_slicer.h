@@ -0,0 +1,137 @@
+/**@file    base_time_slicer.h
+ * @brief   分时段并行后处理.h文件
+ * @details 将长时间的任务划分为有重叠的时间窗口, 各窗口在独立线程中解算, 最后在窗口边界处拼接并检查一致性
+ * @author  Zing Fong\n
+ *          zing.fong.whu\@outlook.com
+ * @date    2026/10/18
+ * @version V1.0
+ **********************************************************************************
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Version  <th>Author     <th>Description
+ * <tr><td>2026/10/18   <td>1.0      <td>Zing Fong  <td>Initialize
+ * <tr><td>2026/10/18   <td>1.1      <td>Zing Fong  <td>按窗口顺序流式输出拼接结果, 拼接差超限时给出警告
+ * </table>
+ **********************************************************************************
+ */
+#ifndef LOOSECOUPLED_SRC_BASETK_BASE_TIME_SLICER_H
+#define LOOSECOUPLED_SRC_BASETK_BASE_TIME_SLICER_H
+
+// c/c++系统文件
+
+// 其他库的 .h 文件
+#include <functional>
+#include <vector>
+
+// 本项目内 .h 文件
+#include "base_app.h"
+
+/**@struct      TimeWindow
+ * @brief       一个时间窗口, [warm_begin, begin)为预热段, [begin, end)为有效段
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Author      <th>Description
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>Initialize
+ * </table>
+ */
+struct TimeWindow
+{
+    int id{};  // 窗口编号
+    double warm_begin{};  // 预热开始时刻, GPS周秒
+    double begin{};  // 有效段开始时刻
+    double end{};  // 有效段结束时刻
+};
+
+/**@struct      SliceEpoch
+ * @brief       窗口解算输出的单个历元结果, 定长数组, 不单独申请内存
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Author      <th>Description
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>Initialize
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>改为定长数组, 增加了姿态
+ * </table>
+ */
+struct SliceEpoch
+{
+    double t{};  // 时间, GPS周秒
+    double xyz[3]{};  // ECEF坐标
+    double v[3]{};  // 速度, 由具体解算定义坐标系
+    double att[3]{};  // 姿态角, 由具体解算定义
+    int status{};  // 解的状态, 由具体解算定义
+};
+
+/**@struct      SliceReport
+ * @brief       相邻两个窗口在重叠段上的一致性统计
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Author      <th>Description
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>Initialize
+ * </table>
+ */
+struct SliceReport
+{
+    int left_id{};  // 前一个窗口编号
+    int right_id{};  // 后一个窗口编号
+    double boundary{};  // 拼接时刻
+    int epoch_num{};  // 参与比较的历元数
+    double max_diff{};  // 最大位置差(m)
+    double rms_diff{};  // 位置差RMS(m)
+    double seam_jump{};  // 拼接处前后两个历元的位置差(m)
+};
+
+/**@class   TimeSlicer
+ * @brief   分时段并行后处理调度器
+ * @details 每个窗口从warm_begin开始解算, 由调用者在回调中创建独立的解算对象(GnssRtk/SinsLooseCoupled等),
+ *          预热段只用于滤波收敛, 不输出。重叠段后半段上比较相邻窗口的解, 作为拼接一致性报告。\n
+ *          一个窗口解算完成且之前的窗口都已输出后, 立即输出它的有效段并释放前一窗口的结果,
+ *          所以内存中只保留正在解算和等待输出的窗口, 与任务总时长无关。
+ *          最大位置差或拼接跳变超过[BASE] window_max_diff时给出警告
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Author      <th>Description
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>Initialize
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>按窗口顺序流式输出, 增加了拼接差阈值
+ * </table>
+ */
+class TimeSlicer
+{
+  public:
+    // 解算一个窗口, 返回[warm_begin, end]内按时间排序的结果
+    using WindowFunc = std::function<std::vector<SliceEpoch>(
+            const TimeWindow &window)>;
+    // 按时间顺序输出拼接后的一个历元
+    using OutputFunc = std::function<void(const SliceEpoch &epoch)>;
+
+    void Init(const Config &config);  // 读取窗口长度、重叠时长、线程数和拼接差阈值
+    std::vector<TimeWindow> Split(const double &t_begin,
+                                  const double &t_end) const;  // 划分时间窗口
+    long Run(const double &t_begin, const double &t_end, const WindowFunc &process,
+             const OutputFunc &output);  // 并行解算, 按顺序拼接输出, 返回输出的历元数
+    int PrintReport() const;  // 打印一致性报告, 返回超过阈值的拼接处个数
+
+    // get
+    double get_window_length() const;
+    double get_overlap() const;
+    int get_thread_num() const;
+    double get_max_diff() const;
+    const std::vector<SliceReport> &get_reports() const;
+
+    // set
+    void set_window(const double &window_length, const double &overlap);
+    void set_thread_num(const int &thread_num);
+    void set_max_diff(const double &max_diff);
+
+  private:
+    long Emit(const std::vector<TimeWindow> &windows,
+              const std::vector<std::vector<SliceEpoch>> &results, const int &index,
+              const OutputFunc &output);  // 输出一个窗口的有效段并统计与前一窗口的一致性
+
+    double window_length_ = 3600.0;  // 有效段长度(s)
+    double overlap_ = 300.0;  // 预热段(重叠段)长度(s)
+    int thread_num_{};  // 工作线程数, 0表示取硬件线程数
+    double max_diff_ = 0.5;  // 重叠段位置差和拼接跳变的警告阈值(m)
+    std::vector<SliceReport> reports_{};  // 各拼接处的一致性报告
+};
+
+
+#endif //LOOSECOUPLED_SRC_BASETK_BASE_TIME_SLICER_H
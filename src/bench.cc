@@ -0,0 +1,627 @@
+/**@file    bench.cc
+ * @brief   性能基准测试
+ * @details 实现了各热点函数的基准测试项以及JSON结果输出
+ * @author  Zing Fong\n
+ *          zing.fong.whu\@outlook.com
+ * @date    2026/10/18
+ * @version V1.0
+ **********************************************************************************
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Version  <th>Author     <th>Description
+ * <tr><td>2026/10/18   <td>1.0      <td>Zing Fong  <td>Initialize
+ * <tr><td>2026/10/18   <td>1.1      <td>Zing Fong  <td>增加了GNSS预处理测试项
+ * <tr><td>2026/10/18   <td>1.2      <td>Zing Fong  <td>增加了矩阵增删行列测试项
+ * <tr><td>2026/10/18   <td>1.3      <td>Zing Fong  <td>增加了原地乘法和协方差传播测试项
+ * <tr><td>2026/10/18   <td>1.4      <td>Zing Fong  <td>增加了子矩阵写入测试项
+ * <tr><td>2026/10/18   <td>1.5      <td>Zing Fong  <td>增加了临时区最小二乘测试项
+ * <tr><td>2026/10/18   <td>1.6      <td>Zing Fong  <td>增加了内置实现与BLAS/LAPACK的对比测试项
+ * <tr><td>2026/10/18   <td>1.7      <td>Zing Fong  <td>增加了混合精度的机械编排和松组合测试项
+ * <tr><td>2026/10/18   <td>1.8      <td>Zing Fong  <td>增加了不同误差状态维数的一步预测测试项
+ * <tr><td>2026/10/18   <td>1.9      <td>Zing Fong  <td>增加了按间隔传播协方差的一步预测测试项
+ * <tr><td>2026/10/18   <td>1.10     <td>Zing Fong  <td>增加了过程噪声离散化测试项
+ * <tr><td>2026/10/18   <td>1.11     <td>Zing Fong  <td>增加了ECEF系机械编排和一步预测测试项
+ * <tr><td>2026/10/18   <td>1.12     <td>Zing Fong  <td>未开启编译优化时给出警告
+ * <tr><td>2026/10/18   <td>1.13     <td>Zing Fong  <td>过程噪声模型的一步预测分为两个命名测试项
+ * <tr><td>2026/10/18   <td>1.14     <td>Zing Fong  <td>NED系和ECEF系的一步预测分为两个命名测试项
+ * </table>
+ **********************************************************************************
+ */
+
+// 本类对应的.h文件
+#include "bench.h"
+// c/c++系统文件
+#include <cstdio>
+#include <ctime>
+// 其他库的 .h 文件
+#include <cmath>
+#include <memory>
+#include <utility>
+
+// 本项目内 .h 文件
+#include "basetk/base_arena.h"
+#include "basetk/base_math.h"
+#include "sinstk/sins_mechanization.h"
+#include "sinstk/sins_loose_coupled.h"
+#include "sinstk/sins_process_noise.h"
+#include "gnsstk/lambda.h"
+#include "gnsstk/gnss_spp.h"
+
+/**@brief       运行所有名称包含filter的测试项, 并将结果写入JSON文件
+ * @details     未开启编译优化时(如未指定构建类型的Debug构建)耗时约为Release的10倍, 运行前给出警告
+ * @param[in]   json_path       JSON文件路径
+ * @param[in]   filter          测试项名称过滤, 为空则运行全部
+ * @return      0为正常, -1为JSON文件写入失败
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int Bench::Run(const std::string &json_path, const std::string &filter)
+{
+    filter_ = filter;
+    results_.clear();
+#ifndef __OPTIMIZE__
+    printf("WARNING: benchmark is built without optimization, timings are not representative!\n"
+           "         Rebuild with -DCMAKE_BUILD_TYPE=Release\n");
+#endif
+    printf("%-40s %12s %14s %14s\n", "benchmark", "iterations", "median(ns)",
+           "min(ns)");
+    BenchBaseMatrix();
+    BenchBackend();
+    BenchBaseMath();
+    BenchSins();
+    BenchLambda();
+    BenchGnss();
+    return WriteJson(json_path);
+}
+
+/**@brief       随机矩阵, 元素服从[-1, 1]均匀分布
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+BaseMatrix Bench::RandomMatrix(const int &row_num, const int &col_num)
+{
+    std::uniform_real_distribution<double> u(-1.0, 1.0);
+    BaseMatrix mat(row_num, col_num);
+    for(int i = 0; i < row_num; ++i)
+        for(int j = 0; j < col_num; ++j)
+            mat.write(i, j, u(engine_));
+    return mat;
+}
+
+/**@brief       随机对称正定矩阵 AAᵀ + nI
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+BaseMatrix Bench::RandomSpdMatrix(const int &n)
+{
+    auto a = RandomMatrix(n, n);
+    return a*a.Trans() + BaseMatrix::eye(n)*static_cast<double>(n);
+}
+
+/**@brief       矩阵乘法、协方差传播、求逆、增删行列, 维数分别为3(姿态), 6, 21(松组合状态), 60(RTK双差)
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void Bench::BenchBaseMatrix()
+{
+    for(int n: {3, 6, 21, 60})
+    {
+        auto a = RandomMatrix(n, n);
+        auto b = RandomMatrix(n, n);
+        Measure("BaseMatrix.Multiply", n, [&a, &b]()
+        {
+            return (a*b).read(0, 0);
+        });
+        BaseMatrix c(n, n);
+        Measure("BaseMatrix.Gemm", n, [&a, &b, &c]()
+        {
+            BaseMatrix::Gemm(1.0, a, false, b, false, 0.0, c);
+            return c.read(0, 0);
+        });
+        // P = Φ·P·Φᵀ + Q, 运算符写法与原地写法
+        auto p = RandomSpdMatrix(n);
+        auto q = RandomSpdMatrix(n);
+        Measure("BaseMatrix.PropagateCovariance", n, [&a, &p, &q]()
+        {
+            return (a*p*a.Trans() + q).read(0, 0);
+        });
+        BaseMatrix phi_p(n, n);
+        Measure("BaseMatrix.PropagateCovarianceInPlace", n, [&a, &p, &q, &phi_p, &c]()
+        {
+            BaseMatrix::Symm(false, 1.0, p, a, 0.0, phi_p);
+            c = q;
+            BaseMatrix::Gemm(1.0, phi_p, false, a, true, 1.0, c);
+            return c.read(0, 0);
+        });
+        auto spd = RandomSpdMatrix(n);
+        Measure("BaseMatrix.Inverse", n, [&spd]()
+        {
+            return spd.Inverse().read(0, 0);
+        });
+        // 按3×3子矩阵写满整个矩阵, 逐元素read/write与子矩阵视图对比
+        if(n%3 == 0)
+        {
+            auto sub = RandomMatrix(3, 3);
+            Measure("BaseMatrix.WriteBlockElementwise", n, [&c, &sub, n]()
+            {
+                for(int row = 0; row < n; row += 3)
+                    for(int col = 0; col < n; col += 3)
+                        for(int i = 0; i < 3; ++i)
+                            for(int j = 0; j < 3; ++j)
+                                c.write(row + i, col + j, sub.read(i, j));
+                return c.read(0, 0);
+            });
+            Measure("BaseMatrix.WriteBlock", n, [&c, &sub, n]()
+            {
+                for(int row = 0; row < n; row += 3)
+                    for(int col = 0; col < n; col += 3)
+                        c.block<3, 3>(row, col) = sub;
+                return c.read(0, 0);
+            });
+        }
+        // 增删中间的一行(一列), 模拟卫星升降时调整设计矩阵和协方差阵
+        auto grow = RandomMatrix(n, n);
+        std::vector<double> vec(n, 0.5);
+        Measure("BaseMatrix.InsertEraseRow", n, [&grow, &vec, n]()
+        {
+            grow.InsertRow(vec, n/2);
+            grow.EraseRow(n/2);
+            return grow.read(0, 0);
+        });
+        Measure("BaseMatrix.InsertEraseCol", n, [&grow, &vec, n]()
+        {
+            grow.InsertCol(vec, n/2);
+            grow.EraseCol(n/2);
+            return grow.read(0, 0);
+        });
+    }
+}
+
+/**@brief       内置实现与BLAS/LAPACK在不同维数下的耗时, 用于确定LOOSECOUPLED_BLAS_THRESHOLD
+ * @details     Builtin项把阈值设得很大, 全部使用内置实现; Blas项把阈值设为1, 只在定义LC_USE_BLAS时运行
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void Bench::BenchBackend()
+{
+    const int threshold = BaseMatrix::get_blas_threshold();
+    std::vector<std::pair<std::string, int>> backends = {{"Builtin", 1 << 20}};
+#ifdef LC_USE_BLAS
+    backends.emplace_back("Blas", 1);
+#endif
+    for(int n: {8, 16, 24, 32, 48, 64, 96, 128, 192, 256})
+    {
+        auto a = RandomMatrix(n, n);
+        auto b = RandomMatrix(n, n);
+        auto spd = RandomSpdMatrix(n);
+        BaseMatrix c(n, n);
+        for(const auto &backend: backends)
+        {
+            BaseMatrix::set_blas_threshold(backend.second);
+            Measure("Backend.Gemm" + backend.first, n, [&a, &b, &c]()
+            {
+                BaseMatrix::Gemm(1.0, a, false, b, false, 0.0, c);
+                return c.read(0, 0);
+            });
+            Measure("Backend.Inverse" + backend.first, n, [&spd]()
+            {
+                return spd.Inverse().read(0, 0);
+            });
+            Measure("Backend.Solve" + backend.first, n, [&spd, &b]()
+            {
+                return spd.Solve(b).read(0, 0);
+            });
+            Measure("Backend.Cholesky" + backend.first, n, [&spd, &c]()
+            {
+                spd.Cholesky(c);
+                return c.read(0, 0);
+            });
+        }
+    }
+    BaseMatrix::set_blas_threshold(threshold);
+}
+
+/**@brief       坐标转换和姿态转换
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void Bench::BenchBaseMath()
+{
+    const double &D2R = BaseSdc::kD2R;
+    std::vector<double> blh = {30.5*D2R, 114.3*D2R, 20.0};
+    auto xyz = BaseMath::Blh2Xyz(blh);
+    Measure("BaseMath.Blh2Xyz", 0, [&blh]()
+    {
+        return BaseMath::Blh2Xyz(blh)[0];
+    });
+    Measure("BaseMath.Xyz2Blh", 0, [&xyz]()
+    {
+        return BaseMath::Xyz2Blh(xyz)[0];
+    });
+
+    std::vector<double> euler = {1.5*D2R, -2.0*D2R, 135.0*D2R};
+    auto q = BaseMath::Euler2Quaternion(euler);
+    auto c_b_n = BaseMath::Quaternion2RotationMat(q);
+    std::vector<double> rotation_vec = {1e-4, -2e-4, 3e-4};
+    Measure("BaseMath.Euler2Quaternion", 0, [&euler]()
+    {
+        return BaseMath::Euler2Quaternion(euler)[0];
+    });
+    Measure("BaseMath.Quaternion2Euler", 0, [&q]()
+    {
+        return BaseMath::Quaternion2Euler(q)[0];
+    });
+    Measure("BaseMath.Quaternion2RotationMat", 0, [&q]()
+    {
+        return BaseMath::Quaternion2RotationMat(q).read(0, 0);
+    });
+    Measure("BaseMath.RotationMat2Quaternion", 0, [&c_b_n]()
+    {
+        return BaseMath::RotationMat2Quaternion(c_b_n)[0];
+    });
+    Measure("BaseMath.RotationVec2Quaternion", 0, [&rotation_vec]()
+    {
+        return BaseMath::RotationVec2Quaternion(rotation_vec)[0];
+    });
+    Measure("BaseMath.QuaternionMul", 0, [&q]()
+    {
+        return BaseMath::QuaternionMul(q, q)[0];
+    });
+}
+
+/**@brief       静止状态下200Hz的机械编排、F阵计算和松组合一步预测, 均为单个历元的耗时
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void Bench::BenchSins()
+{
+    const double &D2R = BaseSdc::kD2R;
+    const double dt = 0.005;
+    StateInfo state{};
+    state.time = 1000.0;
+    state.blh = {30.5*D2R, 114.3*D2R, 20.0};
+    state.xyz = BaseMath::Blh2Xyz(state.blh);
+    state.q = BaseMath::Euler2Quaternion({0.0, 0.0, 0.0});
+    state.c_b_n = BaseMath::Quaternion2RotationMat(state.q);
+
+    // 静止时的理想IMU输出
+    const double &omega_e = BaseSdc::wgs84.kOmega;
+    auto g_n = BaseMath::CalcGn(state.blh);
+    ImuData imu_data{};
+    imu_data.t = state.time;
+    imu_data.acc = {0.0, 0.0, -g_n[2]*dt};
+    imu_data.gyro = {omega_e*cos(state.blh[0])*dt, 0.0,
+                     -omega_e*sin(state.blh[0])*dt};
+
+    SinsMechanization mechanization{};
+    mechanization.Init(state);
+    mechanization.ImuMechanization(imu_data);
+    Measure("SinsMechanization.ImuMechanization", 0,
+            [&mechanization, &imu_data, &dt]()
+            {
+                imu_data.t += dt;
+                mechanization.ImuMechanization(imu_data);
+                return mechanization.get_cur_state().blh[2];
+            });
+
+    Config config{};  // 空配置表, 噪声参数均取默认值
+    SinsLooseCoupled loose_coupled{};
+    imu_data.t = state.time;
+    loose_coupled.Init(config, state);
+    loose_coupled.Predict(imu_data);
+    imu_data.t += dt;
+    loose_coupled.Predict(imu_data);
+    Measure("SinsLooseCoupled.CalcF", 0, [&loose_coupled, &imu_data]()
+    {
+        return loose_coupled.CalcF(imu_data).read(3, 6);
+    });
+    Measure("SinsLooseCoupled.Predict", 0, [&loose_coupled, &imu_data, &dt]()
+    {
+        imu_data.t += dt;
+        loose_coupled.Predict(imu_data);
+        return loose_coupled.get_t();
+    });
+    // GNSS位置取初始位置, 每次量测更新后都会反馈校正
+    const std::vector<double> pos_std = {0.05, 0.05, 0.1};
+    Measure("SinsLooseCoupled.Update", 0, [&loose_coupled, &state, &pos_std]()
+    {
+        loose_coupled.Update(state, pos_std);
+        return loose_coupled.get_state().blh[2];
+    });
+    
+    // 混合精度: 协方差和姿态更新用单精度
+    SinsMechanizationT<float> mechanization_mixed{};
+    imu_data.t = state.time;
+    mechanization_mixed.Init(state);
+    mechanization_mixed.ImuMechanization(imu_data);
+    Measure("SinsMechanization.ImuMechanizationMixed", 0,
+            [&mechanization_mixed, &imu_data, &dt]()
+            {
+                imu_data.t += dt;
+                mechanization_mixed.ImuMechanization(imu_data);
+                return mechanization_mixed.get_cur_state().blh[2];
+            });
+    SinsLooseCoupledMixed loose_coupled_mixed{};
+    imu_data.t = state.time;
+    loose_coupled_mixed.Init(config, state);
+    loose_coupled_mixed.Predict(imu_data);
+    Measure("SinsLooseCoupled.PredictMixed", 0, [&loose_coupled_mixed, &imu_data, &dt]()
+    {
+        imu_data.t += dt;
+        loose_coupled_mixed.Predict(imu_data);
+        return loose_coupled_mixed.get_t();
+    });
+    Measure("SinsLooseCoupled.UpdateMixed", 0, [&loose_coupled_mixed, &state, &pos_std]()
+    {
+        loose_coupled_mixed.Update(state, pos_std);
+        return loose_coupled_mixed.get_state().blh[2];
+    });
+    
+    // 不同误差状态维数的一步预测, n为状态维数
+    auto measure_predict = [this, &state, &config, &imu_data, &dt](auto &filter)
+    {
+        imu_data.t = state.time;
+        filter.Init(config, state);
+        filter.Predict(imu_data);
+        Measure("SinsLooseCoupled.PredictStates", filter.kStateDim, [&filter, &imu_data, &dt]()
+        {
+            imu_data.t += dt;
+            filter.Predict(imu_data);
+            return filter.get_t();
+        });
+    };
+    SinsLooseCoupledT<double, 15> loose_coupled_15{};
+    SinsLooseCoupledT<double, 18> loose_coupled_18{};
+    SinsLooseCoupledT<double, 21> loose_coupled_21{};
+    measure_predict(loose_coupled_15);
+    measure_predict(loose_coupled_18);
+    measure_predict(loose_coupled_21);
+    
+    // 按间隔传播协方差, n为间隔的IMU历元数, 耗时为平均每个历元
+    for(int n: {1, 5, 20, 50})
+    {
+        LooseCoupledParams params{};
+        params.cov_decimation = n;
+        imu_data.t = state.time;
+        loose_coupled.Init(config, state);
+        loose_coupled.SetDecimation(params);
+        loose_coupled.Predict(imu_data);
+        Measure("SinsLooseCoupled.PredictDecimated", n, [&loose_coupled, &imu_data, &dt]()
+        {
+            imu_data.t += dt;
+            loose_coupled.Predict(imu_data);
+            return loose_coupled.get_t();
+        });
+    }
+    
+    // 过程噪声离散化, n为状态维数: QdFirstOrder的Qd取Q·Δt, QdVanLoan用Van Loan法的缓存;
+    // SinsProcessNoise.VanLoan为缓存未命中时的计算量
+    auto measure_qd = [this, &loose_coupled, &state, &config, &imu_data, &dt](const char *name,
+                                                                            const char *qd_model)
+    {
+        LooseCoupledParams params{};
+        params.qd_model = qd_model;
+        imu_data.t = state.time;
+        loose_coupled.Init(config, state);
+        loose_coupled.SetNoise(params);
+        loose_coupled.Predict(imu_data);
+        Measure(name, SinsLooseCoupled::kStateDim, [&loose_coupled, &imu_data, &dt]()
+        {
+            imu_data.t += dt;
+            loose_coupled.Predict(imu_data);
+            return loose_coupled.get_t();
+        });
+    };
+    measure_qd("SinsLooseCoupled.PredictQdFirstOrder", "first_order");
+    measure_qd("SinsLooseCoupled.PredictQdVanLoan", "van_loan");
+    using ProcessNoise = SinsProcessNoise<SinsLooseCoupled::Layout>;
+    ProcessNoise process_noise{};
+    BaseMatrix f, g_q_gt, phi, qd;
+    process_noise.BuildModel(f, g_q_gt);
+    Measure("SinsProcessNoise.VanLoan", SinsLooseCoupled::kStateDim, [&f, &g_q_gt, &dt, &phi, &qd]()
+    {
+        ProcessNoise::VanLoan(f, g_q_gt, dt, phi, qd);
+        return qd.read(0, 0);
+    });
+    
+    // ECEF系机械编排, 以及NED系与ECEF系的一步预测, n为状态维数
+    SinsMechanizationEcef mechanization_ecef{};
+    imu_data.t = state.time;
+    mechanization_ecef.Init(state);
+    mechanization_ecef.ImuMechanization(imu_data);
+    Measure("SinsMechanization.ImuMechanizationEcef", 0,
+            [&mechanization_ecef, &imu_data, &dt]()
+            {
+                imu_data.t += dt;
+                mechanization_ecef.ImuMechanization(imu_data);
+                return mechanization_ecef.get_xyz()[2];
+            });
+    auto measure_frame = [this, &state, &config, &imu_data, &dt](const char *name, auto &filter)
+    {
+        imu_data.t = state.time;
+        filter.Init(config, state);
+        filter.Predict(imu_data);
+        Measure(name, filter.kStateDim, [&filter, &imu_data, &dt]()
+        {
+            imu_data.t += dt;
+            filter.Predict(imu_data);
+            return filter.get_t();
+        });
+    };
+    SinsLooseCoupledT<double, 21, NavFrame::kEcef> loose_coupled_ecef{};
+    measure_frame("SinsLooseCoupled.PredictNed", loose_coupled);
+    measure_frame("SinsLooseCoupled.PredictEcef", loose_coupled_ecef);
+}
+
+/**@brief       模糊度搜索, 协方差阵为随机对称正定阵, 浮点解在整数附近加扰动
+ * @details     协方差阵缩放到对角线约为0.01~0.05周², 与短基线双差宽巷的量级相当
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void Bench::BenchLambda()
+{
+    std::normal_distribution<double> noise(0.0, 0.05);
+    std::uniform_int_distribution<int> integer(-1000, 1000);
+    for(int n: {4, 8, 16, 24})
+    {
+        auto q_mat = RandomSpdMatrix(n)*(0.01/n);
+        std::vector<double> a(n, 0.0), Q(n*n, 0.0), F(n*2, 0.0), s(2, 0.0);
+        for(int i = 0; i < n; ++i)
+        {
+            a[i] = integer(engine_) + noise(engine_);
+            for(int j = 0; j < n; ++j)
+                Q[i + j*n] = q_mat.read(i, j);
+        }
+        Measure("lambda", n, [&]()
+        {
+            lambda(n, 2, a.data(), Q.data(), F.data(), s.data());
+            return s[0];
+        });
+        LambdaSolver solver(n, 2);
+        Measure("LambdaSolver.Solve", n, [&]()
+        {
+            solver.Solve(n, 2, a.data(), Q.data(), F.data(), s.data());
+            return s[0];
+        });
+    }
+}
+
+/**@brief       GNSS预处理与单点定位法方程, GPS和BDS卫星各半
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void Bench::BenchGnss()
+{
+    std::uniform_real_distribution<double> range(2.0e7, 2.6e7);
+    for(int n: {16, 32, 64, 128})
+    {
+        auto raw_data = std::make_unique<RawData>();
+        EpochObs &obs = raw_data->epoch_obs;
+        for(int i = 0; i < n; ++i)
+        {
+            SatObs sat_obs{};
+            bool is_bds = i%2 == 1;
+            sat_obs.sys = is_bds ? Gnss::kBds : Gnss::kGps;
+            sat_obs.prn = i/2 + 1;
+            double rho = range(engine_);
+            sat_obs.P[0] = rho + 3.0;
+            sat_obs.P[1] = rho + 5.0;
+            sat_obs.L[0] = (rho - 3.0)/(is_bds ? BaseSdc::kWavelengthB1 : BaseSdc::kWavelengthL1);
+            sat_obs.L[1] = (rho - 5.0)/(is_bds ? BaseSdc::kWavelengthB3 : BaseSdc::kWavelengthL2);
+            sat_obs.valid = true;
+            obs.AddSatObs(sat_obs);
+        }
+        auto detector = std::make_unique<OutlierDetector>();
+        Measure("OutlierDetector.DetectOutlier", n, [&]()
+        {
+            detector->DetectOutlier(*raw_data);
+            return detector->get_cur_epoch().get_l_mw()[n - 1];
+        });
+    }
+
+    // 单点定位一次迭代: 累加法方程并求解, 与拼出设计矩阵后用BaseMatrix计算比较
+    std::uniform_real_distribution<double> u(-1.0, 1.0);
+    for(int n: {8, 16, 32, 64})
+    {
+        std::vector<double> b(n*3, 0.0), l(n, 0.0), p(n, 0.0);
+        std::vector<Gnss> sys(n, Gnss::kGps);
+        BaseMatrix B(n, 5), P(n, n), L(n, 1);
+        for(int i = 0; i < n; ++i)
+        {
+            for(int j = 0; j < 3; ++j)
+            {
+                b[i*3 + j] = u(engine_);
+                B.write(i, j, b[i*3 + j]);
+            }
+            sys[i] = i%2 == 1 ? Gnss::kBds : Gnss::kGps;
+            B.write(i, i%2 == 1 ? 4 : 3, 1.0);
+            l[i] = 10.0*u(engine_);
+            p[i] = 1.5 + u(engine_);
+            L.write(i, 0, l[i]);
+            P.write(i, i, p[i]);
+        }
+        NormalEquation normal_equation{};
+        double x[NormalEquation::kMaxParamNum]{};
+        double q[NormalEquation::kMaxParamNum*NormalEquation::kMaxParamNum]{};
+        Measure("NormalEquation.Solve", n, [&]()
+        {
+            normal_equation.Reset();
+            for(int i = 0; i < n; ++i)
+                normal_equation.AddObs(&b[i*3], sys[i], l[i], p[i]);
+            normal_equation.Solve(x);
+            normal_equation.Inverse(q);
+            return x[0] + q[0];
+        });
+        Measure("BaseMatrix.NormalEquation", n, [&]()
+        {
+            BaseMatrix BTP = B.Trans()*P;
+            BaseMatrix Q = (BTP*B).Inverse();
+            BaseMatrix X = Q*BTP*L;
+            return X.read(0, 0) + Q.read(0, 0);
+        });
+        // 同样的运算, 设计矩阵等在单历元临时区中, 中间结果随之从临时区分配
+        EpochArena arena{};
+        Measure("BaseMatrix.NormalEquationArena", n, [&]()
+        {
+            BaseMatrix B_arena(B, &arena), P_arena(P, &arena), L_arena(L, &arena);
+            BaseMatrix BTP = B_arena.Trans()*P_arena;
+            BaseMatrix Q = (BTP*B_arena).Inverse();
+            BaseMatrix X = Q*BTP*L_arena;
+            double result = X.read(0, 0) + Q.read(0, 0);
+            arena.Reset();
+            return result;
+        });
+    }
+}
+
+/**@brief       结果写入JSON文件
+ * @param[in]   json_path       JSON文件路径
+ * @return      0为正常, -1为文件打开失败
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int Bench::WriteJson(const std::string &json_path) const
+{
+    FILE *file_ptr = fopen(json_path.c_str(), "w");
+    if(file_ptr == nullptr)
+    {
+        printf("Cannot open json file! file path: %s\n", json_path.c_str());
+        return -1;
+    }
+    char date[32] = "";
+    time_t now = time(nullptr);
+    strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+#ifdef NDEBUG
+    const char *build = "release";
+#else
+    const char *build = "debug";
+#endif
+#ifdef __VERSION__
+    const char *compiler = __VERSION__;
+#else
+    const char *compiler = "unknown";
+#endif
+
+    fprintf(file_ptr, "{\n");
+    fprintf(file_ptr, "  \"schema\": 1,\n");
+    fprintf(file_ptr, "  \"date\": \"%s\",\n", date);
+    fprintf(file_ptr, "  \"compiler\": \"%s\",\n", compiler);
+    fprintf(file_ptr, "  \"build\": \"%s\",\n", build);
+    fprintf(file_ptr, "  \"min_time_s\": %.3f,\n", min_time_);
+    fprintf(file_ptr, "  \"results\": [\n");
+    for(int i = 0; i < static_cast<int>(results_.size()); ++i)
+    {
+        const auto &a_result = results_[i];
+        fprintf(file_ptr, "    {\"name\": \"%s\", \"n\": %d, \"iterations\": %ld, "
+                          "\"repeats\": %d, \"ns_median\": %.3f, \"ns_min\": %.3f, "
+                          "\"ns_max\": %.3f}%s\n", a_result.name.c_str(),
+                a_result.n, a_result.iterations, a_result.repeats,
+                a_result.ns_median, a_result.ns_min, a_result.ns_max,
+                i + 1 < static_cast<int>(results_.size()) ? "," : "");
+    }
+    fprintf(file_ptr, "  ]\n}\n");
+    fclose(file_ptr);
+    printf("%d results written to %s\n", static_cast<int>(results_.size()),
+           json_path.c_str());
+    return 0;
+}
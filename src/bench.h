@@ -0,0 +1,134 @@
+/**@file    bench.h
+ * @brief   性能基准测试
+ * @details 对basetk、sinstk、gnsstk中的热点函数进行可复现的微基准测试, 结果输出为JSON
+ * @author  Zing Fong\n
+ *          zing.fong.whu\@outlook.com
+ * @date    2026/10/18
+ * @version V1.0
+ **********************************************************************************
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Version  <th>Author     <th>Description
+ * <tr><td>2026/10/18   <td>1.0      <td>Zing Fong  <td>Initialize
+ * </table>
+ **********************************************************************************
+ */
+
+#ifndef LOOSECOUPLED_SRC_BENCH_H
+#define LOOSECOUPLED_SRC_BENCH_H
+
+// c/c++系统文件
+#include <chrono>
+// 其他库的 .h 文件
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+// 本项目内 .h 文件
+#include "basetk/base_matrix.h"
+
+/**@struct      BenchResult
+ * @brief       一项基准测试的结果
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Author      <th>Description
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>Initialize
+ * </table>
+ */
+struct BenchResult
+{
+    std::string name{};  // 测试项名称
+    int n{};  // 问题规模, 没有规模的测试项为0
+    long iterations{};  // 每轮调用次数
+    int repeats{};  // 轮数
+    double ns_median{};  // 单次调用耗时中位数(ns)
+    double ns_min{};  // 单次调用耗时最小值(ns)
+    double ns_max{};  // 单次调用耗时最大值(ns)
+};
+
+/**@class   Bench
+ * @brief   基准测试类
+ * @details 每项测试先预热并确定每轮调用次数, 使一轮耗时不少于min_time_, 再重复repeats_轮,
+ *          取每轮平均耗时的中位数。随机输入均由固定种子生成, 不同机器、不同版本之间可以直接比较。
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Author      <th>Description
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>Initialize
+ * </table>
+ */
+class Bench
+{
+  public:
+    int Run(const std::string &json_path, const std::string &filter);  // 运行所有名称包含filter的测试项, 写入JSON
+
+  private:
+    void BenchBaseMatrix();  // 矩阵乘法、协方差传播、求逆、增删行列
+    void BenchBackend();  // 内置实现与BLAS/LAPACK的分界
+    void BenchBaseMath();  // 坐标转换、姿态转换
+    void BenchSins();  // 机械编排、F阵
+    void BenchLambda();  // 模糊度搜索
+    void BenchGnss();  // GNSS预处理、单点定位法方程
+    int WriteJson(const std::string &json_path) const;  // 结果写入JSON文件
+
+    BaseMatrix RandomMatrix(const int &row_num, const int &col_num);  // 随机矩阵
+    BaseMatrix RandomSpdMatrix(const int &n);  // 随机对称正定矩阵
+
+    /**@brief       测量func单次调用的耗时
+     * @param[in]   name        测试项名称
+     * @param[in]   n           问题规模
+     * @param[in]   func        被测函数, 返回值累加到sink_中, 防止被编译器优化掉
+     */
+    template<typename Func>
+    void Measure(const std::string &name, const int &n, Func &&func)
+    {
+        std::string full_name = n > 0 ? name + "/" + std::to_string(n) : name;
+        if(full_name.find(filter_) == std::string::npos)
+            return;
+        using Clock = std::chrono::steady_clock;
+        auto elapsed = [&func, this](const long &iterations)
+        {
+            auto start = Clock::now();
+            for(long i = 0; i < iterations; ++i)
+                sink_ += func();
+            return std::chrono::duration<double, std::nano>(
+                    Clock::now() - start).count();
+        };
+
+        // 预热, 同时确定每轮调用次数
+        long iterations = 1;
+        double ns = elapsed(iterations);
+        while(ns < min_time_*1e9 && iterations < (1L << 30))
+        {
+            iterations *= 2;
+            ns = elapsed(iterations);
+        }
+
+        std::vector<double> ns_per_op(repeats_, 0.0);
+        for(auto &a_ns: ns_per_op)
+            a_ns = elapsed(iterations)/static_cast<double>(iterations);
+        std::sort(ns_per_op.begin(), ns_per_op.end());
+
+        BenchResult result{};
+        result.name = name;
+        result.n = n;
+        result.iterations = iterations;
+        result.repeats = repeats_;
+        result.ns_median = ns_per_op[repeats_/2];
+        result.ns_min = ns_per_op.front();
+        result.ns_max = ns_per_op.back();
+        results_.push_back(result);
+        printf("%-40s %12ld %14.1f %14.1f\n", full_name.c_str(), iterations,
+               result.ns_median, result.ns_min);
+    }
+
+    std::string filter_{};  // 测试项名称过滤
+    double min_time_ = 0.05;  // 每轮最短耗时(s)
+    int repeats_ = 5;  // 轮数
+    std::mt19937 engine_{20221018};  // 固定种子的随机数引擎
+    volatile double sink_{};  // 累加被测函数的返回值
+    std::vector<BenchResult> results_{};  // 测试结果
+};
+
+
+#endif //LOOSECOUPLED_SRC_BENCH_H
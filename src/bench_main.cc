@@ -0,0 +1,26 @@
+/**@file    bench_main.cc
+ * @brief   基准测试程序入口
+ * @details 用法: LooseCoupledBench [JSON文件路径, 默认bench.json] [测试项名称过滤]
+ * @author  Zing Fong\n
+ *          zing.fong.whu\@outlook.com
+ * @date    2026/10/18
+ * @version V1.0
+ **********************************************************************************
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Version  <th>Author     <th>Description
+ * <tr><td>2026/10/18   <td>1.0      <td>Zing Fong  <td>Initialize
+ * </table>
+ **********************************************************************************
+ */
+
+#include <string>
+#include "bench.h"
+
+int main(int argc, char *argv[])
+{
+    std::string json_path = argc > 1 ? argv[1] : "bench.json";
+    std::string filter = argc > 2 ? argv[2] : "";
+    Bench bench{};
+    return bench.Run(json_path, filter) == 0 ? 0 : 1;
+}
@@ -1,5 +1,51 @@
-//
-// Created by Zing Fong on 2022/5/25.
-//
+/**@file    gnss_app.cc
+ * @brief   GNSS应用程序.cc文件
+ * @details 单点定位和RTK解算的入口
+ * @author  Zing Fong\n
+ *          zing.fong.whu\@outlook.com
+ * @date    2022/5/25
+ * @version V1.1
+ **********************************************************************************
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Version  <th>Author     <th>Description
+ * <tr><td>2022/5/25    <td>1.0      <td>Zing Fong  <td>Initialize
+ * <tr><td>2026/10/18   <td>1.1      <td>Zing Fong  <td>增加了解算入口
+ * </table>
+ **********************************************************************************
+ */
 
+// 本类对应的.h文件
 #include "gnss_app.h"
+// c/c++系统文件
+#include <cstdio>
+// 其他库的 .h 文件
+
+// 本项目内 .h 文件
+
+/**@brief       读取配置
+ * @param[in]   config          配置表
+ * @param[in]   mode            解算模式, spp或rtk
+ * @return      0为正常
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int GnssApp::Init(const Config &config, const std::string &mode)
+{
+    config_ = config;
+    mode_ = mode;
+    return 0;
+}
+
+/**@brief       解算
+ * @note        GnssFileStream、GnssSpp和GnssRtk目前只有声明, 实现加入工程后在这里接入GnssRtkPipeline
+ * @return      处理的历元数, 出错返回-1
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+long GnssApp::Run() const
+{
+    printf("Mode \"%s\" is not supported yet: GNSS solver sources are not "
+           "included in this build.\n", mode_.c_str());
+    return -1;
+}
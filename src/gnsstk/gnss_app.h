@@ -1,14 +1,49 @@
-//
-// Created by Zing Fong on 2022/5/25.
-//
+/**@file    gnss_app.h
+ * @brief   GNSS应用程序.h文件
+ * @details 单点定位和RTK解算的入口
+ * @author  Zing Fong\n
+ *          zing.fong.whu\@outlook.com
+ * @date    2022/5/25
+ * @version V1.1
+ **********************************************************************************
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Version  <th>Author     <th>Description
+ * <tr><td>2022/5/25    <td>1.0      <td>Zing Fong  <td>Initialize
+ * <tr><td>2026/10/18   <td>1.1      <td>Zing Fong  <td>增加了解算入口
+ * </table>
+ **********************************************************************************
+ */
 
 #ifndef LOOSECOUPLED_SRC_GNSSTK_GNSS_APP_H
 #define LOOSECOUPLED_SRC_GNSSTK_GNSS_APP_H
 
+// c/c++系统文件
 
+// 其他库的 .h 文件
+#include <string>
+
+// 本项目内 .h 文件
+#include "../basetk/base_app.h"
+
+/**@class   GnssApp
+ * @brief   GNSS应用程序类, 由BaseApp根据解算模式调用
+ * @par     修改日志:
+ * <table>
+ * <tr><th>Date         <th>Author      <th>Description
+ * <tr><td>2022/5/25    <td>Zing Fong   <td>Initialize
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>增加了Init和Run
+ * </table>
+ */
 class GnssApp
 {
-
+  public:
+    int Init(const Config &config, const std::string &mode);  // 读取配置
+    long Run() const;  // 解算, 返回处理的历元数, 出错返回-1
+    
+  private:
+    Config config_{};  // 配置表
+    std::string mode_{};  // spp或rtk
 };
 
 
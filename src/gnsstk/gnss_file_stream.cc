@@ -0,0 +1,162 @@
+/**@file    gnss_file_stream.cc
+ * @brief   GNSS文件读取.cc文件
+ * @details 实现了历元观测值容器EpochObs
+ * @author  Zing Fong\n
+ *          zing.fong.whu\@outlook.com
+ * @date    2026/10/18
+ * @version V1.0
+ **********************************************************************************
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Version  <th>Author     <th>Description
+ * <tr><td>2026/10/18   <td>1.0      <td>Zing Fong  <td>Initialize
+ * </table>
+ **********************************************************************************
+ */
+
+// 本类对应的.h文件
+#include "gnss_file_stream.h"
+// c/c++系统文件
+
+// 其他库的 .h 文件
+#include <cstdio>
+
+// 本项目内 .h 文件
+
+/**@brief       清空观测值, 只重置卫星数, 各列的旧数据由之后的AddSatObs覆盖
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void EpochObs::Clear()
+{
+    sat_num_ = 0;
+}
+
+/**@brief       追加一个卫星的观测值
+ * @param[in]   sat_obs     单个卫星的观测值
+ * @return      返回结果:\n
+ * -  >=0       该卫星的下标
+ * -   -1       已达到最大卫星数
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int EpochObs::AddSatObs(const SatObs &sat_obs)
+{
+    if(sat_num_ >= kCapacity)
+    {
+        printf("Too many satellites in one epoch! max: %d\n", kCapacity);
+        return -1;
+    }
+    int i = sat_num_++;
+    sys_[i] = sat_obs.sys;
+    prn_[i] = sat_obs.prn;
+    for(int f = 0; f < 2; ++f)
+    {
+        p_[f][i] = sat_obs.P[f];
+        l_[f][i] = sat_obs.L[f];
+        d_[f][i] = sat_obs.D[f];
+    }
+    valid_[i] = sat_obs.valid;
+    return i;
+}
+
+/**@brief       搜索某个卫星在本历元观测值中的下标
+ * @param[in]   prn         卫星编号
+ * @param[in]   sys         卫星系统
+ * @return      下标, 没有该卫星时返回-1
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int EpochObs::FindSatObsIndex(const int &prn, const Gnss &sys) const
+{
+    for(int i = 0; i < sat_num_; ++i)
+        if(prn_[i] == prn && sys_[i] == sys)
+            return i;
+    return -1;
+}
+
+/**@brief       组装下标为index的卫星的观测值
+ * @param[in]   index       卫星下标, 需小于卫星数
+ * @return      该卫星的观测值
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+SatObs EpochObs::GetSatObs(const int &index) const
+{
+    SatObs sat_obs{};
+    sat_obs.sys = sys_[index];
+    sat_obs.prn = prn_[index];
+    for(int f = 0; f < 2; ++f)
+    {
+        sat_obs.P[f] = p_[f][index];
+        sat_obs.L[f] = l_[f][index];
+        sat_obs.D[f] = d_[f][index];
+    }
+    sat_obs.valid = valid_[index] != 0;
+    return sat_obs;
+}
+
+GpsTime EpochObs::get_time() const
+{
+    return time_;
+}
+
+int EpochObs::get_sat_num() const
+{
+    return sat_num_;
+}
+
+BaseSpan<const Gnss> EpochObs::get_sys() const
+{
+    return {sys_, sat_num_};
+}
+
+BaseSpan<const int> EpochObs::get_prn() const
+{
+    return {prn_, sat_num_};
+}
+
+BaseSpan<const double> EpochObs::get_p(const int &freq) const
+{
+    return {p_[freq], sat_num_};
+}
+
+BaseSpan<const double> EpochObs::get_l(const int &freq) const
+{
+    return {l_[freq], sat_num_};
+}
+
+BaseSpan<const double> EpochObs::get_d(const int &freq) const
+{
+    return {d_[freq], sat_num_};
+}
+
+BaseSpan<const uint8_t> EpochObs::get_valid() const
+{
+    return {valid_, sat_num_};
+}
+
+BaseSpan<double> EpochObs::get_p(const int &freq)
+{
+    return {p_[freq], sat_num_};
+}
+
+BaseSpan<double> EpochObs::get_l(const int &freq)
+{
+    return {l_[freq], sat_num_};
+}
+
+BaseSpan<double> EpochObs::get_d(const int &freq)
+{
+    return {d_[freq], sat_num_};
+}
+
+BaseSpan<uint8_t> EpochObs::get_valid()
+{
+    return {valid_, sat_num_};
+}
+
+void EpochObs::set_time(const GpsTime &time)
+{
+    time_ = time;
+}
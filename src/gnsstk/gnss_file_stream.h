@@ -10,6 +10,7 @@
  * <table>
  * <tr><th>Date         <th>Version  <th>Author     <th>Description
  * <tr><td>2022/5/29    <td>1.0      <td>Zing Fong  <td>Initialize
+ * <tr><td>2026/10/18   <td>1.1      <td>Zing Fong  <td>EpochObs改为定长的按列存储, get函数改为返回常引用
  * </table>
  **********************************************************************************
  */
@@ -20,9 +21,11 @@
 #include <iostream>
 
 // 其他库的 .h 文件
+#include <cstdint>
 #include <vector>
 
 // 本项目内 .h 文件
+#include "../basetk/base_span.h"
 #include "../basetk/base_time.h"
 #include "../basetk/base_sdc.h"
 #include "../basetk/base_app.h"
@@ -49,28 +52,53 @@ struct SatObs
 
 /**@class       EpochObs
  * @brief       一个历元所有卫星观测值的集合
+ * @details     容量固定为BaseSdc::kMaxChannelNum, 读取时不申请内存。观测值按列存储(SoA), 每一列是一段连续数组,
+ *              get_p/get_l/get_d等返回长度为卫星数的视图, GF/MW组合、单差和残差计算可以直接写成对各列的逐元素循环,
+ *              便于编译器向量化。需要单颗卫星的全部观测值时用GetSatObs组装
  * @par 修改日志:
  * <table>
  * <tr><th>Date         <th>Author      <th>Description
  * <tr><td>2022/5/29    <td>Zing Fong   <td>Initialize
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>改为定长的按列存储, 增加了按列访问的视图
  * </table>
  */
 class EpochObs
 {
   public:
+    static constexpr int kCapacity = BaseSdc::kMaxChannelNum;  // 最大卫星数
     
+    void Clear();  // 清空观测值, 时间不变
+    int AddSatObs(const SatObs &sat_obs);  // 追加一个卫星的观测值, 返回其下标
     int FindSatObsIndex(const int &prn,
-                        const Gnss &sys);  // 搜索某个prn号的卫星在epkObs中的下标
+                        const Gnss &sys) const;  // 搜索某个prn号的卫星在epkObs中的下标
+    SatObs GetSatObs(const int &index) const;  // 组装下标为index的卫星的观测值
     
+    // get
     GpsTime get_time() const;
     int get_sat_num() const;
-    std::vector<SatObs> get_sat_obs() const;
+    BaseSpan<const Gnss> get_sys() const;
+    BaseSpan<const int> get_prn() const;
+    BaseSpan<const double> get_p(const int &freq) const;
+    BaseSpan<const double> get_l(const int &freq) const;
+    BaseSpan<const double> get_d(const int &freq) const;
+    BaseSpan<const uint8_t> get_valid() const;
+    BaseSpan<double> get_p(const int &freq);
+    BaseSpan<double> get_l(const int &freq);
+    BaseSpan<double> get_d(const int &freq);
+    BaseSpan<uint8_t> get_valid();
+    
+    // set
+    void set_time(const GpsTime &time);
   
   private:
     GpsTime time_{};  // 该历元的时间
     int sat_num_{};  // 观测值数目
-    std::vector<SatObs> sat_obs_ = std::vector<SatObs>(BaseSdc::kMaxChannelNum,
-                                                       SatObs{});  // 单个历元所有卫星观测值
+    alignas(64) double p_[2][kCapacity]{};  // 双频伪距观测值, GPS为L1, L2; BDS为B1, B3
+    alignas(64) double l_[2][kCapacity]{};  // 双频载波相位观测值
+    alignas(64) double d_[2][kCapacity]{};  // 多普勒频移
+    Gnss sys_[kCapacity]{};  // 卫星系统
+    int prn_[kCapacity]{};  // 卫星编号
+    uint8_t valid_[kCapacity]{};  // 观测值是否可用(是否双频), 用uint8_t而不是bool以便和其他列一起向量化
 };
 
 /**@struct       Ephemeris
@@ -136,6 +164,7 @@ struct RawData
  * <tr><th>Date         <th>Author      <th>Description
  * <tr><td>2022/5/29    <td>Zing Fong   <td>Initialize
  * <tr><td>2022/5/31    <td>Zing Fong   <td>增加了初始化函数, 更改了部分函数访问权限
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>get_raw_data改为返回常引用
  * </table>
  */
 class GnssFileStream
@@ -148,7 +177,7 @@ class GnssFileStream
     
     // get
     GpsTime get_time() const;
-    RawData get_raw_data() const;
+    const RawData &get_raw_data() const;
   
   private:
     int ReadGpsEphemeris();  // 从当前指针所指位置读取GPS星历
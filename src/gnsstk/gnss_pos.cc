@@ -1,26 +1,88 @@
-//
-// Created by Zing Fong on 2022/6/6.
-//
+/**@file    gnss_pos.cc
+ * @brief   pos文件的读取.cc文件
+ * @details 读取GNSS定位结果文件, 每行格式为: GPS周秒 ECEF坐标XYZ(m) ECEF速度(m/s)
+ * @author  Zing Fong\n
+ *          zing.fong.whu\@outlook.com
+ * @date    2022/6/6
+ * @version V1.0
+ **********************************************************************************
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Version  <th>Author     <th>Description
+ * <tr><td>2022/6/6     <td>1.0      <td>Zing Fong  <td>Initialize
+ * <tr><td>2026/10/18   <td>1.1      <td>Zing Fong  <td>实现了pos文件的逐历元读取
+ * <tr><td>2026/10/18   <td>1.2      <td>Zing Fong  <td>增加了读取耗时统计
+ * </table>
+ **********************************************************************************
+ */
 
+// 本类对应的.h文件
 #include "gnss_pos.h"
+// c/c++系统文件
 
+// 其他库的 .h 文件
+#include <string>
+
+// 本项目内 .h 文件
+#include "../basetk/base_profiler.h"
+
+/**@brief           打开pos文件
+ * @param[in]       config        配置表
+ * @return          返回结果:\n
+ * -     0          打开成功
+ * -    -1          打开失败
+ * @author          Zing Fong
+ * @date            2026/10/18
+ */
 int GnssPos::Init(const Config &config)
 {
-    
+    std::string pos_file_path = config.ReadString("LC", "gnss_file_path",
+                                                  "gnss.pos");
+    file_ptr_ = fopen(pos_file_path.c_str(), "r");
+    if(file_ptr_ == nullptr)
+    {
+        printf("Cannot open pos file! file path: %s\n", pos_file_path.c_str());
+        return -1;
+    }
     return 0;
 }
 
+/**@brief           读取一个历元的定位结果
+ * @return          返回结果:\n
+ * -     0          读取正常
+ * -    -1          到达文件末尾或格式错误
+ * @author          Zing Fong
+ * @date            2026/10/18
+ */
 int GnssPos::ReadOneSec()
 {
+    LC_PROFILE_SCOPE(kGnssRead);
+    if(file_ptr_ == nullptr || feof(file_ptr_))
+        return -1;
+    int ret = fscanf(file_ptr_, "%lf %lf %lf %lf %lf %lf %lf", &t_, &pos_[0],
+                     &pos_[1], &pos_[2], &v_[0], &v_[1], &v_[2]);
+    if(ret != 7)
+        return -1;
     return 0;
 }
 
+GnssPos::~GnssPos()
+{
+    if(file_ptr_ != nullptr)
+        fclose(file_ptr_);
+}
+
 double GnssPos::get_t() const
 {
-    return 0;
+    return t_;
 }
 
 std::vector<double> GnssPos::get_pos() const
 {
-    return std::vector<double>();
+    return pos_;
+}
+
+std::vector<double> GnssPos::get_v() const
+{
+    return v_;
 }
@@ -31,6 +31,7 @@
  * <table>
  * <tr><th>Date         <th>Author      <th>Description
  * <tr><td>2022/6/6     <td>Zing Fong   <td>Initialize
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>增加了速度的读取
  * </table>
  */
 class GnssPos
@@ -39,10 +40,13 @@ class GnssPos
     int Init(const Config &config);  // 初始化, 打开文件等
     
     int ReadOneSec();  // 读取一秒钟的观测值
+    
+    ~GnssPos();
   
     // get
     double get_t() const;
     std::vector<double> get_pos() const;
+    std::vector<double> get_v() const;
     
   private:
     double t_{};  // GPS周秒
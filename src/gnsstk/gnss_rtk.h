@@ -10,6 +10,8 @@
  * <table>
  * <tr><th>Date         <th>Version  <th>Author     <th>Description
  * <tr><td>2022/5/31    <td>1.0      <td>Zing Fong  <td>Initialize
+ * <tr><td>2026/10/18   <td>1.1      <td>Zing Fong  <td>get_sat_sd改为返回常引用
+ * <tr><td>2026/10/18   <td>1.2      <td>Zing Fong  <td>LAMBDA工作区按实际模糊度个数分配
  * </table>
  **********************************************************************************
  */
@@ -28,9 +30,7 @@
 #include "../basetk/base_app.h"
 #include "gnss_file_stream.h"
 #include "gnss_spp.h"
-
-extern int lambda(int n, int m, const double *a, const double *Q, double *F,
-                  double *s);  // lambda模糊度搜索
+#include "lambda.h"
 
 /**@class       SatSd
  * @brief       单个卫星站间单差观测值
@@ -70,6 +70,7 @@ class SatSd
  * <table>
  * <tr><th>Date         <th>Author      <th>Description
  * <tr><td>2022/5/31    <td>Zing Fong   <td>Initialize
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>get_sat_sd改为返回常引用
  * </table>
  */
 struct SdObs  // 站间单差
@@ -81,7 +82,7 @@ struct SdObs  // 站间单差
     // get
     GpsTime get_t() const;
     int get_sd_num() const;
-    std::vector<SatSd> get_sat_sd() const;
+    const std::vector<SatSd> &get_sat_sd() const;
   
   private:
     GpsTime t_{};  // 时间
@@ -137,6 +138,7 @@ struct DdObs
  * <table>
  * <tr><th>Date         <th>Author      <th>Description
  * <tr><td>2022/5/31    <td>Zing Fong   <td>Initialize
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>LAMBDA工作区改为成员复用
  * </table>
  */
 class GnssRtk
@@ -169,6 +171,7 @@ class GnssRtk
     std::vector<GnssSpp> gnss_spp_ = std::vector<GnssSpp>(2,
                                                           GnssSpp{});  // 不同接收机的解算(定位)结果  0:rover 1:base;
     CycleSlipDetector detector_;  // 单差观测值周跳探测
+    LambdaSolver lambda_solver_{};  // 双频双差模糊度解算器, 工作区按出现过的最大模糊度个数分配, 各历元复用
     
 };
 
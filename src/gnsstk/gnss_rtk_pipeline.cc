@@ -0,0 +1,211 @@
+/**@file    gnss_rtk_pipeline.cc
+ * @brief   RTK多线程流水线.cc文件
+ * @details 实现了RTK流水线各阶段线程的调度以及流动站、基站数据的时间同步
+ * @author  Zing Fong\n
+ *          zing.fong.whu\@outlook.com
+ * @date    2026/10/18
+ * @version V1.0
+ **********************************************************************************
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Version  <th>Author     <th>Description
+ * <tr><td>2026/10/18   <td>1.0      <td>Zing Fong  <td>Initialize
+ * <tr><td>2026/10/18   <td>1.1      <td>Zing Fong  <td>增加了预处理和解算耗时统计
+ * <tr><td>2026/10/18   <td>1.2      <td>Zing Fong  <td>各线程在时间线中命名, 增加了输出耗时统计
+ * <tr><td>2026/10/18   <td>1.3      <td>Zing Fong  <td>历元计数用于内存申请统计的稳态判断
+ * <tr><td>2026/10/18   <td>1.4      <td>Zing Fong  <td>预处理和解算线程使用单历元临时区
+ * </table>
+ **********************************************************************************
+ */
+
+// 本类对应的.h文件
+#include "gnss_rtk_pipeline.h"
+// c/c++系统文件
+#include <thread>
+// 其他库的 .h 文件
+#include <cmath>
+#include <utility>
+
+// 本项目内 .h 文件
+#include "../basetk/base_profiler.h"
+
+/**@brief       读取流水线参数
+ * @param[in]   config          配置表
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void GnssRtkPipeline::Init(const Config &config)
+{
+    queue_size_ = config.ReadInt("RTK", "pipeline_queue_size", 8);
+    max_base_age_ = config.ReadFloat("RTK", "max_base_age", 30.0f);
+    int arena_kb = config.ReadInt("RTK", "epoch_arena_kb", 64);
+    if(queue_size_ <= 0)
+    {
+        printf("RTK pipeline queue size error: %d, use 8 instead.\n",
+               queue_size_);
+        queue_size_ = 8;
+    }
+    if(arena_kb < 0)
+    {
+        printf("RTK epoch arena size error: %d KB, use 64 KB instead.\n", arena_kb);
+        arena_kb = 64;
+    }
+    arena_size_ = static_cast<size_t>(arena_kb)*1024;
+}
+
+/**@brief       预处理线程, 不断读取并预处理历元, 直到文件结束或下游关闭
+ * @param[in]   prepare         读取与预处理回调
+ * @param[in]   queue           输出队列
+ * @param[in]   arena_size      临时区初始大小(字节)
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void GnssRtkPipeline::PrepareLoop(const PrepareFunc &prepare, BoundedQueue<RecvEpoch> &queue,
+                                  const size_t &arena_size)
+{
+    EpochArena arena(arena_size);
+    for(long seq = 0;; ++seq)
+    {
+        RecvEpoch recv_epoch{};
+        recv_epoch.seq = seq;
+        {
+            LC_PROFILE_SCOPE(kRtkPrepare);
+            int status = prepare(recv_epoch, arena);
+            arena.Reset();
+            if(status < 0)
+                break;  // 文件结束
+        }
+        if(!queue.Push(std::move(recv_epoch)))
+            break;  // 下游已结束
+    }
+    queue.Close();
+}
+
+/**@brief       解算线程, 流动站与基站时间同步后进行双差解算
+ * @details     对每个流动站历元, 取时刻不晚于它的最新基站历元; 龄期超限则不提供基站数据
+ * @param[in]   solve           双差解算回调
+ * @param[in]   rover_queue     流动站预处理结果队列
+ * @param[in]   base_queue      基站预处理结果队列
+ * @param[in]   result_queue    解算结果队列
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void GnssRtkPipeline::SolveLoop(const SolveFunc &solve,
+                                BoundedQueue<RecvEpoch> &rover_queue,
+                                BoundedQueue<RecvEpoch> &base_queue,
+                                BoundedQueue<RtkResult> &result_queue) const
+{
+    EpochArena arena(arena_size_);
+    RecvEpoch rover{}, base_cur{}, base_next{};
+    bool has_base_cur = false, has_base_next = false, base_end = false;
+    while(rover_queue.Pop(rover))
+    {
+        // 基站追赶到流动站当前时刻
+        while(!base_end)
+        {
+            if(!has_base_next)
+            {
+                if(!base_queue.Pop(base_next))
+                {
+                    base_end = true;
+                    break;
+                }
+                has_base_next = true;
+            }
+            if(base_next.t - rover.t > 1e-3)
+                break;  // 基站下一历元晚于流动站, 留到之后使用
+            base_cur = std::move(base_next);
+            has_base_cur = true;
+            has_base_next = false;
+        }
+
+        RecvEpoch *base = nullptr;
+        if(has_base_cur && base_cur.status == 0 &&
+           fabs(rover.t - base_cur.t) <= max_base_age_)
+            base = &base_cur;
+
+        RtkResult result{};
+        result.seq = rover.seq;
+        result.t = rover.t;
+        if(rover.status == 0)
+        {
+            LC_PROFILE_SCOPE(kRtkSolve);
+            solve(rover, base, result, arena);
+            arena.Reset();
+        }
+        LC_ALLOC_EPOCH();
+        if(!result_queue.Push(std::move(result)))
+            break;
+    }
+    // 通知上游停止, 防止预处理线程阻塞在满队列上
+    rover_queue.Close();
+    base_queue.Close();
+    result_queue.Close();
+}
+
+/**@brief       启动流水线, 在调用线程中按历元顺序输出结果, 所有线程结束后返回
+ * @param[in]   rover_prepare       流动站读取与预处理
+ * @param[in]   base_prepare        基站读取与预处理
+ * @param[in]   solve               双差解算
+ * @param[in]   output              结果输出
+ * @return      输出的历元数
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+long GnssRtkPipeline::Run(const PrepareFunc &rover_prepare,
+                          const PrepareFunc &base_prepare,
+                          const SolveFunc &solve, const OutputFunc &output)
+{
+    BoundedQueue<RecvEpoch> rover_queue(queue_size_);
+    BoundedQueue<RecvEpoch> base_queue(queue_size_);
+    BoundedQueue<RtkResult> result_queue(queue_size_);
+
+    std::thread rover_thread([this, &rover_prepare, &rover_queue]()
+                             {
+                                 LC_PROFILE_THREAD_NAME("rover prepare");
+                                 PrepareLoop(rover_prepare, rover_queue, arena_size_);
+                             });
+    std::thread base_thread([this, &base_prepare, &base_queue]()
+                            {
+                                LC_PROFILE_THREAD_NAME("base prepare");
+                                PrepareLoop(base_prepare, base_queue, arena_size_);
+                            });
+    std::thread solve_thread([this, &solve, &rover_queue, &base_queue,
+                                     &result_queue]()
+                             {
+                                 LC_PROFILE_THREAD_NAME("rtk solve");
+                                 SolveLoop(solve, rover_queue, base_queue,
+                                           result_queue);
+                             });
+
+    long epoch_num = 0;
+    RtkResult result{};
+    while(result_queue.Pop(result))
+    {
+        {
+            LC_PROFILE_SCOPE(kOutput);
+            output(result);
+        }
+        ++epoch_num;
+    }
+
+    solve_thread.join();
+    rover_thread.join();
+    base_thread.join();
+    return epoch_num;
+}
+
+int GnssRtkPipeline::get_queue_size() const
+{
+    return queue_size_;
+}
+
+double GnssRtkPipeline::get_max_base_age() const
+{
+    return max_base_age_;
+}
+
+size_t GnssRtkPipeline::get_arena_size() const
+{
+    return arena_size_;
+}
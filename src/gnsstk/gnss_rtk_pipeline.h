@@ -0,0 +1,125 @@
+/**@file    gnss_rtk_pipeline.h
+ * @brief   RTK多线程流水线.h文件
+ * @details 将RTK解算拆分为流动站预处理、基站预处理、双差解算和结果输出四个阶段,
+ *          各阶段在各自线程中运行, 通过有界队列连接
+ * @author  Zing Fong\n
+ *          zing.fong.whu\@outlook.com
+ * @date    2026/10/18
+ * @version V1.0
+ **********************************************************************************
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Version  <th>Author     <th>Description
+ * <tr><td>2026/10/18   <td>1.0      <td>Zing Fong  <td>Initialize
+ * <tr><td>2026/10/18   <td>1.1      <td>Zing Fong  <td>各线程使用单历元临时区
+ * </table>
+ **********************************************************************************
+ */
+#ifndef LOOSECOUPLED_SRC_GNSSTK_GNSS_RTK_PIPELINE_H
+#define LOOSECOUPLED_SRC_GNSSTK_GNSS_RTK_PIPELINE_H
+
+// c/c++系统文件
+#include <iostream>
+
+// 其他库的 .h 文件
+#include <functional>
+#include <vector>
+
+// 本项目内 .h 文件
+#include "../basetk/base_arena.h"
+#include "../basetk/base_time.h"
+#include "../basetk/base_app.h"
+#include "../basetk/base_pipeline.h"
+#include "gnss_file_stream.h"
+#include "gnss_spp.h"
+
+/**@struct      RecvEpoch
+ * @brief       单个接收机一个历元预处理(粗差探测+单点定位)后的数据
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Author      <th>Description
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>Initialize
+ * </table>
+ */
+struct RecvEpoch
+{
+    long seq{};  // 历元序号, 从0开始
+    GpsTime t{};  // 观测时刻
+    RawData raw_data{};  // 原始观测值和星历
+    EpochGfmw epoch_gfmw{};  // GF和MW组合
+    GnssSpp spp{};  // 单点定位结果
+    int status{};  // 预处理状态, 0为正常
+};
+
+/**@struct      RtkResult
+ * @brief       一个历元的RTK解算结果
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Author      <th>Description
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>Initialize
+ * </table>
+ */
+struct RtkResult
+{
+    long seq{};  // 流动站历元序号, 输出按此严格递增
+    GpsTime t{};  // 时间
+    std::vector<double> pos = std::vector<double>(3, 0.0);  // 流动站坐标
+    int sol{};  // 0:single 1:float 2:fixed
+    double ratio{};  // ratio值
+    bool valid{};  // 是否有解
+};
+
+/**@class       GnssRtkPipeline
+ * @brief       RTK多线程流水线
+ * @details     线程划分:\n
+ * - 流动站线程: 读取流动站观测值, 粗差探测, 单点定位\n
+ * - 基站线程: 读取基站观测值, 粗差探测, 单点定位\n
+ * - 解算线程: 时间同步, 站间单差, 周跳探测, 双差模糊度固定\n
+ * - 调用线程: 按历元顺序输出结果\n
+ * 第k+1个历元的读取和单点定位与第k个历元的模糊度固定并行进行。解算阶段只有一个线程,
+ * 且各队列先进先出, 所以输出顺序与串行处理完全一致。\n
+ * 预处理线程和解算线程各有一个EpochArena, 每个历元处理完后回收。回调中单点定位、双差解算的临时矩阵
+ * 从临时区分配(BaseMatrix构造时传入arena), 维数随卫星数变化也不访问全局堆。
+ * @note        各阶段的具体处理通过回调函数给出, 回调中的状态(如粗差探测器)由各自线程独占。
+ *              写入RecvEpoch、RtkResult的结果会传给其他线程, 不能使用临时区
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Author      <th>Description
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>Initialize
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>回调增加单历元临时区参数
+ * </table>
+ */
+class GnssRtkPipeline
+{
+  public:
+    // 读取一个历元并完成预处理, 返回0为正常, -1为文件结束
+    using PrepareFunc = std::function<int(RecvEpoch &recv_epoch, EpochArena &arena)>;
+    // 双差解算, base为空指针说明没有可用的基站数据
+    using SolveFunc = std::function<int(RecvEpoch &rover, RecvEpoch *base,
+                                        RtkResult &result, EpochArena &arena)>;
+    // 结果输出
+    using OutputFunc = std::function<void(const RtkResult &result)>;
+
+    void Init(const Config &config);  // 读取队列长度、基站数据龄期、临时区大小等参数
+    long Run(const PrepareFunc &rover_prepare, const PrepareFunc &base_prepare,
+             const SolveFunc &solve, const OutputFunc &output);  // 启动流水线, 返回处理的历元数
+
+    // get
+    int get_queue_size() const;
+    double get_max_base_age() const;
+    size_t get_arena_size() const;
+
+  private:
+    static void PrepareLoop(const PrepareFunc &prepare, BoundedQueue<RecvEpoch> &queue,
+                            const size_t &arena_size);  // 预处理线程
+    void SolveLoop(const SolveFunc &solve, BoundedQueue<RecvEpoch> &rover_queue,
+                   BoundedQueue<RecvEpoch> &base_queue,
+                   BoundedQueue<RtkResult> &result_queue) const;  // 解算线程
+
+    int queue_size_ = 8;  // 各阶段间队列长度
+    double max_base_age_ = 30.0;  // 基站数据最大龄期(s)
+    size_t arena_size_ = EpochArena::kDefaultCapacity;  // 各线程临时区的初始大小(字节)
+};
+
+
+#endif //LOOSECOUPLED_SRC_GNSSTK_GNSS_RTK_PIPELINE_H
@@ -0,0 +1,414 @@
+/**@file    gnss_spp.cc
+ * @brief   GNSS单点定位.cc文件
+ * @details 实现了GF、MW、IF组合观测值的计算、粗差探测以及单点定位的法方程
+ * @author  Zing Fong\n
+ *          zing.fong.whu\@outlook.com
+ * @date    2026/10/18
+ * @version V1.0
+ **********************************************************************************
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Version  <th>Author     <th>Description
+ * <tr><td>2026/10/18   <td>1.0      <td>Zing Fong  <td>Initialize
+ * <tr><td>2026/10/18   <td>1.1      <td>Zing Fong  <td>增加了法方程累加器
+ * </table>
+ **********************************************************************************
+ */
+
+// 本类对应的.h文件
+#include "gnss_spp.h"
+// c/c++系统文件
+
+// 其他库的 .h 文件
+#include <algorithm>
+#include <cmath>
+
+// 本项目内 .h 文件
+
+namespace
+{
+/**@struct      CombCoef
+ * @brief       某一卫星系统双频组合观测值的系数, 组合观测值 = c1*第一频点 - c2*第二频点
+ */
+struct CombCoef
+{
+    double lambda1, lambda2;  // 波长(m)
+    double mw_l1, mw_l2;  // MW组合中载波相位(m)的系数, 宽巷
+    double mw_p1, mw_p2;  // MW组合中伪距的系数, 窄巷
+    double if1, if2;  // IF组合的系数
+};
+
+constexpr CombCoef MakeCombCoef(const double &f1, const double &f2,
+                                const double &lambda1, const double &lambda2)
+{
+    return {lambda1, lambda2,
+            f1/(f1 - f2), f2/(f1 - f2),
+            f1/(f1 + f2), f2/(f1 + f2),
+            f1*f1/(f1*f1 - f2*f2), f2*f2/(f1*f1 - f2*f2)};
+}
+
+constexpr CombCoef kGpsCoef = MakeCombCoef(BaseSdc::kFreqL1, BaseSdc::kFreqL2,
+                                           BaseSdc::kWavelengthL1, BaseSdc::kWavelengthL2);  // GPS L1/L2
+constexpr CombCoef kBdsCoef = MakeCombCoef(BaseSdc::kFreqB1, BaseSdc::kFreqB3,
+                                           BaseSdc::kWavelengthB1, BaseSdc::kWavelengthB3);  // BDS B1/B3
+}
+
+int EpochGfmw::FindGfmwIndex(const int &prn, const Gnss &sys) const
+{
+    for(int i = 0; i < sat_num_; ++i)
+        if(prn_[i] == prn && sys_[i] == sys)
+            return i;
+    return -1;
+}
+
+/**@brief       组装下标为index的卫星的组合观测值
+ * @param[in]   index       卫星下标, 需小于卫星数
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+Gfmw EpochGfmw::GetGfmw(const int &index) const
+{
+    Gfmw gfmw{};
+    gfmw.sys = sys_[index];
+    gfmw.prn = prn_[index];
+    gfmw.l_mw = l_mw_[index];
+    gfmw.l_gf = l_gf_[index];
+    gfmw.l_if = l_if_[index];
+    gfmw.p_if = p_if_[index];
+    gfmw.n = n_[index];
+    gfmw.valid = valid_[index] != 0;
+    return gfmw;
+}
+
+int EpochGfmw::get_sat_num() const
+{
+    return sat_num_;
+}
+
+BaseSpan<const Gnss> EpochGfmw::get_sys() const
+{
+    return {sys_, sat_num_};
+}
+
+BaseSpan<const int> EpochGfmw::get_prn() const
+{
+    return {prn_, sat_num_};
+}
+
+BaseSpan<const double> EpochGfmw::get_l_mw() const
+{
+    return {l_mw_, sat_num_};
+}
+
+BaseSpan<const double> EpochGfmw::get_l_gf() const
+{
+    return {l_gf_, sat_num_};
+}
+
+BaseSpan<const double> EpochGfmw::get_l_if() const
+{
+    return {l_if_, sat_num_};
+}
+
+BaseSpan<const double> EpochGfmw::get_p_if() const
+{
+    return {p_if_, sat_num_};
+}
+
+BaseSpan<const int> EpochGfmw::get_n() const
+{
+    return {n_, sat_num_};
+}
+
+BaseSpan<const uint8_t> EpochGfmw::get_valid() const
+{
+    return {valid_, sat_num_};
+}
+
+/**@brief       计算当前历元所有卫星的GF、MW、IF组合并探测粗差
+ * @details     观测值可用(双频齐全)的GPS/BDS卫星才参与判断。上一历元也观测到的卫星, GF组合历元间变化超过kMaxGfDiff
+ *              或MW组合与平滑值之差超过kMaxMwDiff时判为粗差(或周跳), 本历元不可用, 并从本历元重新开始平滑
+ * @param[in]   raw_data    原始观测值
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void OutlierDetector::DetectOutlier(const RawData &raw_data)
+{
+    const EpochObs &obs = raw_data.epoch_obs;
+    const int sat_num = obs.get_sat_num();
+    ++epoch_num_;
+    cur_epoch.sat_num_ = sat_num;
+
+    // 按当前历元的卫星顺序取出上一历元的状态
+    const Gnss *sys = obs.get_sys().data();
+    const int *prn = obs.get_prn().data();
+    for(int i = 0; i < sat_num; ++i)
+    {
+        cur_epoch.sys_[i] = sys[i];
+        cur_epoch.prn_[i] = prn[i];
+        int slot = SatSlot(sys[i], prn[i]);
+        slot_[i] = slot;
+        if(slot >= 0 && last_epoch_[slot] > 0 && last_epoch_[slot] == epoch_num_ - 1)
+        {
+            prev_gf_[i] = last_gf_[slot];
+            prev_mw_[i] = mw_mean_[slot];
+            prev_n_[i] = mw_n_[slot];
+        }
+        else
+        {
+            prev_gf_[i] = 0.0;
+            prev_mw_[i] = 0.0;
+            prev_n_[i] = 0;
+        }
+    }
+
+    // 所有卫星的组合观测值, 按系统选取系数, 循环内没有分支
+    const double *P1 = obs.get_p(0).data(), *P2 = obs.get_p(1).data();
+    const double *L1 = obs.get_l(0).data(), *L2 = obs.get_l(1).data();
+    for(int i = 0; i < sat_num; ++i)
+    {
+        const bool is_bds = sys[i] == Gnss::kBds;
+        const double lambda1 = is_bds ? kBdsCoef.lambda1 : kGpsCoef.lambda1;
+        const double lambda2 = is_bds ? kBdsCoef.lambda2 : kGpsCoef.lambda2;
+        const double mw_l1 = is_bds ? kBdsCoef.mw_l1 : kGpsCoef.mw_l1;
+        const double mw_l2 = is_bds ? kBdsCoef.mw_l2 : kGpsCoef.mw_l2;
+        const double mw_p1 = is_bds ? kBdsCoef.mw_p1 : kGpsCoef.mw_p1;
+        const double mw_p2 = is_bds ? kBdsCoef.mw_p2 : kGpsCoef.mw_p2;
+        const double if1 = is_bds ? kBdsCoef.if1 : kGpsCoef.if1;
+        const double if2 = is_bds ? kBdsCoef.if2 : kGpsCoef.if2;
+
+        const double l1 = lambda1*L1[i], l2 = lambda2*L2[i];
+        cur_epoch.l_gf_[i] = l1 - l2;
+        cur_epoch.l_mw_[i] = mw_l1*l1 - mw_l2*l2 - mw_p1*P1[i] - mw_p2*P2[i];
+        cur_epoch.l_if_[i] = if1*l1 - if2*l2;
+        cur_epoch.p_if_[i] = if1*P1[i] - if2*P2[i];
+    }
+
+    // 粗差判断和MW平滑, 用掩码代替分支(本文件以-fno-trapping-math编译, 否则比较会被当作可能触发浮点异常而无法转换为掩码)
+    const uint8_t *obs_valid = obs.get_valid().data();
+    for(int i = 0; i < sat_num; ++i)
+    {
+        const bool known = (sys[i] == Gnss::kGps) | (sys[i] == Gnss::kBds);
+        const bool usable = (obs_valid[i] != 0) & known;  // valid已表示双频观测值齐全
+        const double gf = cur_epoch.l_gf_[i], mw = cur_epoch.l_mw_[i];
+        const double prev_mw = prev_mw_[i];
+        const int prev_n = prev_n_[i];
+        const bool outlier = (prev_n > 0) &
+                             ((std::fabs(gf - prev_gf_[i]) > kMaxGfDiff) |
+                              (std::fabs(mw - prev_mw) > kMaxMwDiff));
+        const int n = static_cast<int>(usable)*(1 + static_cast<int>(!outlier)*prev_n);
+        const double weight = 1.0/(n > 1 ? n : 1);
+        cur_epoch.l_mw_[i] = n > 1 ? prev_mw + (mw - prev_mw)*weight : mw;
+        cur_epoch.n_[i] = n;
+        cur_epoch.valid_[i] = usable & !outlier;
+    }
+
+    // 写回平滑状态
+    for(int i = 0; i < sat_num; ++i)
+    {
+        int slot = slot_[i];
+        if(slot < 0 || cur_epoch.n_[i] == 0)
+            continue;
+        last_gf_[slot] = cur_epoch.l_gf_[i];
+        mw_mean_[slot] = cur_epoch.l_mw_[i];
+        mw_n_[slot] = cur_epoch.n_[i];
+        last_epoch_[slot] = epoch_num_;
+    }
+}
+
+/**@brief       清空平滑状态, 下一历元所有卫星从头开始平滑
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void OutlierDetector::Reset()
+{
+    epoch_num_ = 0;
+    for(auto &a_last_epoch: last_epoch_)
+        a_last_epoch = 0;
+    cur_epoch.sat_num_ = 0;
+}
+
+/**@brief       卫星在平滑状态数组中的下标
+ * @param[in]   sys         卫星系统
+ * @param[in]   prn         卫星编号, 1~kMaxBdsNum
+ * @return      下标, prn号超出范围时返回-1
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int OutlierDetector::SatSlot(const Gnss &sys, const int &prn)
+{
+    if(prn < 1 || prn > BaseSdc::kMaxBdsNum)
+        return -1;
+    return static_cast<int>(sys)*BaseSdc::kMaxBdsNum + prn - 1;
+}
+
+const EpochGfmw &OutlierDetector::get_cur_epoch() const
+{
+    return cur_epoch;
+}
+
+/**@brief       清零, 开始一次新的平差
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void NormalEquation::Reset()
+{
+    std::fill(&n_[0][0], &n_[0][0] + kMaxParamNum*kMaxParamNum, 0.0);
+    std::fill(w_, w_ + kMaxParamNum, 0.0);
+    std::fill(sys_obs_num_, sys_obs_num_ + kMaxParamNum - kGeoParamNum, 0);
+    ltpl_ = 0.0;
+    obs_num_ = 0;
+    param_num_ = 0;
+    vtpv_ = 0.0;
+}
+
+/**@brief       累加一个观测值, 误差方程为 v = b·x + clk[sys] - l
+ * @param[in]   b       位置(或速度)参数的系数, 3个
+ * @param[in]   sys     卫星系统, 决定钟差所在的列
+ * @param[in]   l       观测值减计算值
+ * @param[in]   p       权
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void NormalEquation::AddObs(const double *b, const Gnss &sys, const double &l,
+                            const double &p)
+{
+    const int clk = kGeoParamNum + static_cast<int>(sys);
+    for(int i = 0; i < kGeoParamNum; ++i)
+    {
+        const double pb = p*b[i];
+        for(int j = i; j < kGeoParamNum; ++j)
+            n_[i][j] += pb*b[j];
+        n_[i][clk] += pb;
+        w_[i] += pb*l;
+    }
+    n_[clk][clk] += p;
+    w_[clk] += p*l;
+    ltpl_ += p*l*l;
+    ++sys_obs_num_[clk - kGeoParamNum];
+    ++obs_num_;
+}
+
+/**@brief       Cholesky分解求解法方程
+ * @param[out]  x       参数估值, 长度为kMaxParamNum, 没有观测值的系统的钟差为0
+ * @return      返回结果:\n
+ * -     0      求解成功
+ * -    -1      观测值个数少于参数个数或法方程不正定
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int NormalEquation::Solve(double *x)
+{
+    param_num_ = 0;
+    for(int i = 0; i < kMaxParamNum; ++i)
+    {
+        x[i] = 0.0;
+        if(i < kGeoParamNum || sys_obs_num_[i - kGeoParamNum] > 0)
+            param_index_[param_num_++] = i;
+    }
+    const int m = param_num_;
+    if(obs_num_ < m)
+    {
+        param_num_ = 0;
+        return -1;
+    }
+
+    // N = L·Lᵀ, param_index_递增, 所以n_[pj][pi]在上三角中
+    for(int i = 0; i < m; ++i)
+    {
+        for(int j = 0; j <= i; ++j)
+        {
+            double sum = n_[param_index_[j]][param_index_[i]];
+            for(int k = 0; k < j; ++k)
+                sum -= l_[i][k]*l_[j][k];
+            if(i == j)
+            {
+                if(sum <= 0.0)
+                {
+                    param_num_ = 0;
+                    return -1;
+                }
+                l_[i][i] = std::sqrt(sum);
+            }
+            else
+                l_[i][j] = sum/l_[j][j];
+        }
+    }
+
+    // L·y = w, Lᵀ·x = y
+    double y[kMaxParamNum];
+    for(int i = 0; i < m; ++i)
+    {
+        double sum = w_[param_index_[i]];
+        for(int k = 0; k < i; ++k)
+            sum -= l_[i][k]*y[k];
+        y[i] = sum/l_[i][i];
+    }
+    vtpv_ = ltpl_;
+    for(int i = m - 1; i >= 0; --i)
+    {
+        double sum = y[i];
+        for(int k = i + 1; k < m; ++k)
+            sum -= l_[k][i]*y[k];
+        y[i] = sum/l_[i][i];
+        x[param_index_[i]] = y[i];
+        vtpv_ -= y[i]*w_[param_index_[i]];
+    }
+    return 0;
+}
+
+/**@brief       参数的协因数阵Q = N⁻¹
+ * @param[out]  q       kMaxParamNum×kMaxParamNum的协因数阵(行优先), 未参与解算的参数对应的行列为0
+ * @return      0为正常, -1为尚未成功求解
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int NormalEquation::Inverse(double *q) const
+{
+    const int m = param_num_;
+    std::fill(q, q + kMaxParamNum*kMaxParamNum, 0.0);
+    if(m == 0)
+        return -1;
+
+    // L⁻¹, 仍为下三角
+    double inv[kMaxParamNum][kMaxParamNum]{};
+    for(int j = 0; j < m; ++j)
+    {
+        inv[j][j] = 1.0/l_[j][j];
+        for(int i = j + 1; i < m; ++i)
+        {
+            double sum = 0.0;
+            for(int k = j; k < i; ++k)
+                sum -= l_[i][k]*inv[k][j];
+            inv[i][j] = sum/l_[i][i];
+        }
+    }
+    // N⁻¹ = L⁻ᵀ·L⁻¹
+    for(int i = 0; i < m; ++i)
+    {
+        for(int j = 0; j <= i; ++j)
+        {
+            double sum = 0.0;
+            for(int k = i; k < m; ++k)
+                sum += inv[k][i]*inv[k][j];
+            q[param_index_[i]*kMaxParamNum + param_index_[j]] = sum;
+            q[param_index_[j]*kMaxParamNum + param_index_[i]] = sum;
+        }
+    }
+    return 0;
+}
+
+int NormalEquation::get_obs_num() const
+{
+    return obs_num_;
+}
+
+int NormalEquation::get_param_num() const
+{
+    return param_num_;
+}
+
+double NormalEquation::get_vtpv() const
+{
+    return vtpv_;
+}
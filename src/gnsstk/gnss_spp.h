@@ -10,6 +10,9 @@
  * <table>
  * <tr><th>Date         <th>Version  <th>Author     <th>Description
  * <tr><td>2022/5/30    <td>1.0      <td>Zing Fong  <td>Initialize
+ * <tr><td>2026/10/18   <td>1.1      <td>Zing Fong  <td>get函数改为返回常引用
+ * <tr><td>2026/10/18   <td>1.2      <td>Zing Fong  <td>粗差探测改为按列计算全部卫星的组合观测值
+ * <tr><td>2026/10/18   <td>1.3      <td>Zing Fong  <td>增加了法方程累加器NormalEquation
  * </table>
  **********************************************************************************
  */
@@ -21,9 +24,11 @@
 #include <iostream>
 
 // 其他库的 .h 文件
+#include <cstdint>
 #include <vector>
 
 // 本项目内 .h 文件
+#include "../basetk/base_span.h"
 #include "../basetk/base_time.h"
 #include "../basetk/base_sdc.h"
 #include "../basetk/base_matrix.h"
@@ -137,6 +142,7 @@ class SatPos
  * <table>
  * <tr><th>Date         <th>Author      <th>Description
  * <tr><td>2022/5/30    <td>Zing Fong   <td>Initialize
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>get_sat_pos改为返回常引用
  * </table>
  */
 class EpochPos
@@ -146,7 +152,7 @@ class EpochPos
     
     // get
     int get_sat_num() const;
-    std::vector<SatPos> get_sat_pos() const;
+    const std::vector<SatPos> &get_sat_pos() const;
   
   private:
     int sat_num_{};  // 卫星数
@@ -176,46 +182,137 @@ struct Gfmw
 
 /**@class       EpochGfmw
  * @brief       某一历元全部卫星的观测值GFMW组合
+ * @details     与EpochObs一样按列存储, 下标与EpochObs中的卫星一一对应
  * @par 修改日志:
  * <table>
  * <tr><th>Date         <th>Author      <th>Description
  * <tr><td>2022/5/30    <td>Zing Fong   <td>Initialize
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>get_gfmw改为返回常引用
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>改为定长的按列存储, 由OutlierDetector整列写入
  * </table>
  */
 class EpochGfmw
 {
+    friend class OutlierDetector;
+  
   public:
+    static constexpr int kCapacity = BaseSdc::kMaxChannelNum;  // 最大卫星数
+    
     int FindGfmwIndex(const int &prn,
-                      const Gnss &sys);  // 搜索某个prn号的卫星在epkGfmw中的下标
+                      const Gnss &sys) const;  // 搜索某个prn号的卫星在epkGfmw中的下标
+    Gfmw GetGfmw(const int &index) const;  // 组装下标为index的卫星的组合观测值
     
     // get
-    std::vector<Gfmw> get_gfmw() const;
+    int get_sat_num() const;
+    BaseSpan<const Gnss> get_sys() const;
+    BaseSpan<const int> get_prn() const;
+    BaseSpan<const double> get_l_mw() const;
+    BaseSpan<const double> get_l_gf() const;
+    BaseSpan<const double> get_l_if() const;
+    BaseSpan<const double> get_p_if() const;
+    BaseSpan<const int> get_n() const;
+    BaseSpan<const uint8_t> get_valid() const;
   
   private:
-    std::vector<Gfmw> gfmw_ = std::vector<Gfmw>(BaseSdc::kMaxChannelNum,
-                                                Gfmw{});  // 单个历元所有GFMW组合观测值
-    
+    int sat_num_{};  // 卫星数
+    alignas(64) double l_mw_[kCapacity]{};  // MW组合平滑值(m)
+    alignas(64) double l_gf_[kCapacity]{};  // 载波相位GF组合(m)
+    alignas(64) double l_if_[kCapacity]{};  // 载波相位IF组合(m)
+    alignas(64) double p_if_[kCapacity]{};  // 伪距IF组合(m)
+    int n_[kCapacity]{};  // 平滑历元数, 1表示第一个历元
+    Gnss sys_[kCapacity]{};  // 卫星系统
+    int prn_[kCapacity]{};  // 卫星编号
+    uint8_t valid_[kCapacity]{};  // 可用情况, 是否有粗差等等
 };
 
 /**@class       OutlierDetector
  * @brief       粗差探测器, 放入原始数据即可检测观测值粗差
+ * @details     一次遍历EpochObs的各列, 同时算出所有卫星的GF、MW、IF组合, 再用掩码判断历元间GF变化和
+ *              MW相对平滑值的偏差是否超限, 整个过程没有按卫星的分支, 编译器可以向量化。
+
+ *              平滑状态按卫星(系统, prn)存放在定长数组中, 每个历元先按当前卫星顺序取出上一历元的状态,
+ *              判断完毕后再写回; 上一历元没有观测到的卫星从头开始平滑。目前只有GPS和BDS有频率定义,
+ *              其他系统的卫星标记为不可用
  * @par 修改日志:
  * <table>
  * <tr><th>Date         <th>Author      <th>Description
  * <tr><td>2022/5/30    <td>Zing Fong   <td>Initialize
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>get_cur_epoch改为返回常引用
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>改为按列一次计算全部卫星的组合观测值, 平滑状态改为按卫星存放的数组
  * </table>
  */
 class OutlierDetector
 {
   public:
-    void DetectOutlier(RawData raw_data);
+    static constexpr double kMaxGfDiff = 0.05;  // 历元间GF组合变化阈值(m)
+    static constexpr double kMaxMwDiff = 3.0;  // MW组合与平滑值之差的阈值(m)
+    static constexpr int kSlotNum = 4*BaseSdc::kMaxBdsNum;  // 平滑状态数组长度, 每个系统按最大prn号预留
+    
+    void DetectOutlier(const RawData &raw_data);  // 计算组合观测值并探测粗差
+    void Reset();  // 清空平滑状态
     
     // get
-    EpochGfmw get_cur_epoch() const;
+    const EpochGfmw &get_cur_epoch() const;
   
   private:
-    EpochGfmw last_epoch{};  // 上一历元GF和MW组合
+    static int SatSlot(const Gnss &sys, const int &prn);  // 卫星在平滑状态数组中的下标, 无效时返回-1
+    
     EpochGfmw cur_epoch{};  // 当前历元GF和MW组合
+    long epoch_num_{};  // 已处理的历元数
+    
+    // 按卫星存放的平滑状态
+    double last_gf_[kSlotNum]{};  // 上一历元的GF组合
+    double mw_mean_[kSlotNum]{};  // MW组合平滑值
+    int mw_n_[kSlotNum]{};  // MW平滑历元数
+    long last_epoch_[kSlotNum]{};  // 最后一次观测到的历元序号, 0为从未观测到
+    
+    // 按当前历元卫星顺序取出的状态
+    int slot_[EpochGfmw::kCapacity]{};  // 卫星在平滑状态数组中的下标
+    alignas(64) double prev_gf_[EpochGfmw::kCapacity]{};  // 上一历元的GF组合
+    alignas(64) double prev_mw_[EpochGfmw::kCapacity]{};  // MW组合平滑值
+    int prev_n_[EpochGfmw::kCapacity]{};  // MW平滑历元数, 0为上一历元没有观测到
+};
+
+/**@class       NormalEquation
+ * @brief       单点定位/测速的法方程累加器
+ * @details     参数为3个位置(或速度)改正数加每个卫星系统一个钟差(或钟速), 钟差列按Gnss枚举值编号, 即第3+sys列。
+ *              每个观测值只在对应系统的钟差列上有系数1, 所以逐行直接累加BᵀPB(只存上三角)和BᵀPl,
+ *              不需要先拼出设计矩阵, 也不需要按系统数增删行列。没有观测值的系统不参与解算, 其钟差解为0。\n
+ *              存储全部为定长数组, 迭代时用Reset清零后重复使用, 不申请内存
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Author      <th>Description
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>Initialize
+ * </table>
+ */
+class NormalEquation
+{
+  public:
+    static constexpr int kGeoParamNum = 3;  // 位置(或速度)参数个数
+    static constexpr int kMaxParamNum = kGeoParamNum + 4;  // 最大参数个数, 每个卫星系统一个钟差
+    
+    void Reset();  // 清零, 开始一次新的平差
+    void AddObs(const double *b, const Gnss &sys, const double &l,
+                const double &p);  // 累加一个观测值
+    int Solve(double *x);  // Cholesky分解求解
+    int Inverse(double *q) const;  // 协因数阵, 需在Solve成功后调用
+    
+    // get
+    int get_obs_num() const;
+    int get_param_num() const;
+    double get_vtpv() const;
+  
+  private:
+    double n_[kMaxParamNum][kMaxParamNum]{};  // 法方程系数阵BᵀPB, 只用上三角
+    double w_[kMaxParamNum]{};  // BᵀPl
+    double ltpl_{};  // lᵀPl
+    int sys_obs_num_[kMaxParamNum - kGeoParamNum]{};  // 各系统观测值个数
+    int obs_num_{};  // 观测值个数
+    
+    int param_num_{};  // 参与解算的参数个数, 求解失败时为0
+    int param_index_[kMaxParamNum]{};  // 参与解算的参数在法方程中的列号
+    double l_[kMaxParamNum][kMaxParamNum]{};  // Cholesky分解的下三角阵, 只含参与解算的参数
+    double vtpv_{};  // 残差平方和vᵀPv
 };
 
 /**@class       GnssSpp
@@ -224,15 +321,13 @@ class OutlierDetector
  * <table>
  * <tr><th>Date         <th>Author      <th>Description
  * <tr><td>2022/5/30    <td>Zing Fong   <td>Initialize
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>get_epoch_pos改为返回常引用
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>设计矩阵扩展改为法方程累加器
  * </table>
  */
 class GnssSpp
 {
   public:
-    void ExtendMatB(BaseMatrix &B,
-                    const int total);  // 将设计矩阵B根据GPS以及BDS卫星数目情况进行扩展
-    void ExtendDeltaX(BaseMatrix &deltaX);  // 将deltaX根据GPS以及BDS卫星数目情况进行扩展
-    
     int StdPointPositioning(RawData &raw_data, EpochGfmw &epk_efmw,
                             const Config &config);  // 单点定位
     void CalcPointVelocity(RawData &raw_data, EpochGfmw &epk_efmw,
@@ -249,7 +344,7 @@ class GnssSpp
     std::vector<double> get_station_v() const;
     std::vector<double> get_sigma_v() const;
     std::vector<int> get_sys_num() const;
-    EpochPos get_epoch_pos() const;
+    const EpochPos &get_epoch_pos() const;
   
   private:
     GpsTime t_{};  // 信号发射时刻
@@ -13,13 +13,21 @@
 * version : $Revision: 1.1 $ $Date: 2008/07/17 21:48:06 $
 * history : 2007/01/13 1.0 new
 *           2015/05/31 1.1 add api lambda_reduction(), lambda_search()
+*           2026/10/18 1.2 add LambdaSolver, workspace is allocated only once
+*           2026/10/18 1.3 add profiling scope and search node counter
+*           2026/10/18 1.4 workspace grows on demand instead of being sized
+*                          for the maximum channel number up front
 *-----------------------------------------------------------------------------*/
+#include "lambda.h"
+#include "../basetk/base_profiler.h"
+
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <memory.h>
 
 // 矩阵乘法
-void MatrixMulti(const int m, const int n, const int k, const double *a, const double *b, double *multi)
+static void MatrixMulti(const int m, const int n, const int k, const double *a, const double *b, double *multi)
 {
     // 矩阵相乘，m×n的矩阵a，n×k的矩阵b
     int i, j, t;
@@ -41,13 +49,15 @@ void MatrixMulti(const int m, const int n, const int k, const double *a, const d
   n      M1的行数和列数
   a      输入矩阵
   b      输出矩阵   b=inv(a)
+  is, js 主元行号和列号工作区, 长度不小于n
   返回值：1=正常，0=无法求逆
 
 ****************************************************************************/
 
-int MatrixInv(int n/*矩阵维数*/, const double a[], double b[])
+static int MatrixInv(int n/*矩阵维数*/, const double a[], double b[],
+                     int is[], int js[])
 {
-    int i, j, k, l, u, v, is[250], js[250];   /* matrix dimension <= 10 */
+    int i, j, k, l, u, v;
     double d, p;
     
     /* 将输入矩阵赋值给输出矩阵b，下面对b矩阵求逆，a矩阵不变 */
@@ -172,12 +182,11 @@ int MatrixInv(int n/*矩阵维数*/, const double a[], double b[])
 #define SWAP(x, y)   do {double tmp_; tmp_=x; x=y; y=tmp_;} while (0)
 
 /* LD factorization (Q=L'*diag(D)*L) -----------------------------------------*/
-static int LD(int n, const double *Q, double *L, double *D)
+static int LD(int n, const double *Q, double *L, double *D, double *A)
 {
     int i, j, k, info = 0;
-    double a, *A;
+    double a;
     
-    A = new double[n * n];
     memcpy(A, Q, sizeof(double) * n * n);
     for (i = n - 1; i >= 0; i--)
     {
@@ -192,12 +201,11 @@ static int LD(int n, const double *Q, double *L, double *D)
         for (j = 0; j <= i; j++) L[i + j * n] /= L[i + i * n];
     }
     
-    delete[]A;
     return info;
 }
 
 /* integer gauss transformation ----------------------------------------------*/
-void gauss(int n, double *L, double *Z, int i, int j)
+static void gauss(int n, double *L, double *Z, int i, int j)
 {
     int k, mu;
     
@@ -209,7 +217,7 @@ void gauss(int n, double *L, double *Z, int i, int j)
 }
 
 /* permutations --------------------------------------------------------------*/
-void perm(int n, double *L, double *D, int j, double del, double *Z)
+static void perm(int n, double *L, double *D, int j, double del, double *Z)
 {
     int k;
     double eta, lam, a0, a1;
@@ -231,7 +239,7 @@ void perm(int n, double *L, double *D, int j, double del, double *Z)
 }
 
 /* lambda reduction (z=Z'*a, Qz=Z'*Q*Z=L'*diag(D)*L) (ref.[1]) ---------------*/
-void reduction(int n, double *L, double *D, double *Z)
+static void reduction(int n, double *L, double *D, double *Z)
 {
     int i, j, k;
     double del;
@@ -252,18 +260,16 @@ void reduction(int n, double *L, double *D, double *Z)
 }
 
 /* modified lambda (mlambda) search (ref. [2]) -------------------------------*/
-int search(int n, int m, const double *L, const double *D,
-           const double *zs, double *zn, double *s)
+/* ld is the leading dimension of L, so a trailing block of a larger L can be
+ * searched in place (partial ambiguity resolution) */
+static int search(int n, int ld, int m, const double *L, const double *D,
+                  const double *zs, double *zn, double *s, double *S,
+                  double *dist, double *zb, double *z, double *step,
+                  long *nodes)
 {
     int i, j, k, c, nn = 0, imax = 0;
     double newdist, maxdist = 1E99, y;
-    double *S, *dist, *zb, *z, *step;
     
-    S = new double[n * n];
-    dist = new double[n];
-    zb = new double[n];
-    z = new double[n];
-    step = new double[n];
     memset(S, 0, n * n * sizeof(double));
     
     k = n - 1;
@@ -281,7 +287,7 @@ int search(int n, int m, const double *L, const double *D,
             {
                 dist[--k] = newdist;
                 for (i = 0; i <= k; ++i)
-                    S[k + i * n] = S[k + 1 + i * n] + (z[k + 1] - zb[k + 1]) * L[k + 1 + i * n];
+                    S[k + i * n] = S[k + 1 + i * n] + (z[k + 1] - zb[k + 1]) * L[k + 1 + i * ld];
                 zb[k] = zs[k] + S[k + k * n];
                 z[k] = ROUND(zb[k]);
                 y = zb[k] - z[k];
@@ -329,21 +335,8 @@ int search(int n, int m, const double *L, const double *D,
         }
     }
     
-    if (c >= LOOPMAX)
-    {
-        delete[]S;
-        delete[]dist;
-        delete[]zb;
-        delete[]z;
-        delete[]step;
-        return -1;
-    }
-    
-    delete[]S;
-    delete[]dist;
-    delete[]zb;
-    delete[]z;
-    delete[]step;
+    *nodes = c;
+    if (c >= LOOPMAX) return -1;
     return 0;
 }
 
@@ -358,47 +351,269 @@ int search(int n, int m, const double *L, const double *D,
 *          double *s     O  sum of squared residulas of fixed solutions (1 x m)
 * return : status (0:ok,other:error)
 * notes  : matrix stored by column-major order (fortran convension)
+*          workspace is allocated on every call, use LambdaSolver in loops
 *-----------------------------------------------------------------------------*/
 int lambda(int n, int m, const double *a, const double *Q, double *F, double *s)
 {
-    int i, info;
-    double *L, *D, *Z, *ZT, *z, *E;
-    
     if (n <= 0 || m <= 0) return -1;
-    L = new double[n * n];
-    D = new double[n];
-    Z = new double[n * n];
-    ZT = new double[n * n];
-    z = new double[n];
-    E = new double[n * 2];
+    LambdaSolver solver(n, m);
+    return solver.Solve(n, m, a, Q, F, s);
+}
+
+/**@brief       构造函数, 按最大维数分配工作区
+ * @param[in]   max_n       最大模糊度维数
+ * @param[in]   max_m       最大备选解个数, 默认为2(最优和次优)
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+LambdaSolver::LambdaSolver(const int &max_n, const int &max_m)
+{
+    Init(max_n, max_m);
+}
+
+/**@brief       保证工作区至少能容纳给定维数, 只增不减
+ * @details     只有在这里申请内存。维数不超过已有工作区时直接返回, 所以模糊度个数稳定后
+ *              Solve/PartialSolve/Reduction均不再申请内存; 超过时按新的最大维数重新分配
+ * @param[in]   max_n       最大模糊度维数
+ * @param[in]   max_m       最大备选解个数
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void LambdaSolver::Init(const int &max_n, const int &max_m)
+{
+    if (max_n <= 0 || max_m <= 0)
+    {
+        printf("LambdaSolver init error! max_n: %d, max_m: %d\n", max_n, max_m);
+        return;
+    }
+    if (max_n <= max_n_ && max_m <= max_m_) return;
+    max_n_ = std::max(max_n, max_n_);
+    max_m_ = std::max(max_m, max_m_);
+    L_.assign(max_n_ * max_n_, 0.0);
+    D_.assign(max_n_, 0.0);
+    Z_.assign(max_n_ * max_n_, 0.0);
+    ZT_.assign(max_n_ * max_n_, 0.0);
+    z_.assign(max_n_, 0.0);
+    E_.assign(max_n_ * max_m_, 0.0);
+    A_.assign(max_n_ * max_n_, 0.0);
+    S_.assign(max_n_ * max_n_, 0.0);
+    dist_.assign(max_n_, 0.0);
+    zb_.assign(max_n_, 0.0);
+    zc_.assign(max_n_, 0.0);
+    step_.assign(max_n_, 0.0);
+    is_.assign(max_n_, 0);
+    js_.assign(max_n_, 0);
+}
+
+/**@brief       LD分解以及降相关
+ * @param[in]   n       模糊度维数, 大于max_n时先扩大工作区
+ * @param[in]   Q       浮点模糊度协方差阵(n×n, 列优先)
+ * @return      返回结果\n
+ * -  0         成功, L, D, Z中保存降相关结果\n
+ * - -1         维数错误或协方差阵非正定\n
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int LambdaSolver::Reduction(const int &n, const double *Q)
+{
+    if (n <= 0)
+    {
+        printf("LambdaSolver reduction error! n: %d\n", n);
+        return -1;
+    }
+    Init(n, max_m_ > 0 ? max_m_ : 2);
+    memset(L_.data(), 0, n * n * sizeof(double));
+    memset(Z_.data(), 0, n * n * sizeof(double));
+    for (int i = 0; i < n; ++i) Z_[i * (n + 1)] = 1.0;
     
-    memset(L, 0, n * n * sizeof(double));
-    memset(Z, 0, n * n * sizeof(double));
-    for (i = 0; i < n; ++i) Z[i * (n + 1)] = 1.0;
+    int info = LD(n, Q, L_.data(), D_.data(), A_.data());
+    if (info) return info;
+    reduction(n, L_.data(), D_.data(), Z_.data());
+    return 0;
+}
+
+/**@brief       在当前L, D上进行mlambda搜索
+ * @param[in]   n       模糊度维数, 与Reduction一致
+ * @param[in]   m       备选解个数, 不大于max_m
+ * @param[in]   zs      降相关后的浮点模糊度(n×1)
+ * @param[out]  zn      降相关空间的整数解(n×m)
+ * @param[out]  s       各备选解的残差平方和(1×m)
+ * @return      返回结果\n
+ * -  0         成功\n
+ * - -1         维数错误或搜索次数超限\n
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int LambdaSolver::Search(const int &n, const int &m, const double *zs,
+                         double *zn, double *s)
+{
+    if (n <= 0 || n > max_n_ || m <= 0 || m > max_m_)
+    {
+        printf("LambdaSolver search error! n: %d, m: %d\n", n, m);
+        return -1;
+    }
+    int info = search(n, n, m, L_.data(), D_.data(), zs, zn, s, S_.data(),
+                      dist_.data(), zb_.data(), zc_.data(), step_.data(),
+                      &node_num_);
+    total_node_num_ += node_num_;
+    LC_PROFILE_COUNT(kLambdaNode, node_num_);
+    return info;
+}
+
+/**@brief       整周模糊度求解, 与lambda()结果一致, 维数不超过已有工作区时不申请内存
+ * @param[in]   n       模糊度维数
+ * @param[in]   m       备选解个数
+ * @param[in]   a       浮点模糊度(n×1)
+ * @param[in]   Q       浮点模糊度协方差阵(n×n, 列优先)
+ * @param[out]  F       固定解(n×m)
+ * @param[out]  s       各固定解的残差平方和(1×m)
+ * @return      0为成功, 其他为失败
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int LambdaSolver::Solve(const int &n, const int &m, const double *a,
+                        const double *Q, double *F, double *s)
+{
+    LC_PROFILE_SCOPE(kLambda);
+    int info;
+    if (n <= 0 || m <= 0)
+    {
+        printf("LambdaSolver solve error! n: %d, m: %d\n", n, m);
+        return -1;
+    }
+    Init(n, m);
+    if ((info = Reduction(n, Q))) return info;
+    
+    MatrixMulti(n, n, 1, Z_.data(), a, z_.data());
+    if ((info = Search(n, m, z_.data(), E_.data(), s))) return info;
     
-    /* LD factorization */
-    if (!(info = LD(n, Q, L, D)))
+    if (!MatrixInv(n, Z_.data(), ZT_.data(), is_.data(), js_.data()))
+        return -1;
+    for (int i = 0; i < m; ++i)
+        MatrixMulti(n, n, 1, ZT_.data(), E_.data() + i * n, F + i * n);
+    return 0;
+}
+
+/**@brief       部分模糊度固定
+ * @details     只做一次LD分解和降相关, 然后按降相关后条件方差从大到小的顺序
+ *              (即L'DL分解中下标从小到大)逐个剔除模糊度, 在L, D的右下角子块上重新搜索,
+ *              直到ratio通过检验或者剩余模糊度数小于min_fixed_num。
+ *              未固定的模糊度取其在已固定子集条件下的估值。
+ * @param[in]   n                   模糊度维数
+ * @param[in]   a                   浮点模糊度(n×1)
+ * @param[in]   Q                   浮点模糊度协方差阵(n×n, 列优先)
+ * @param[in]   ratio_threshold     ratio检验阈值
+ * @param[in]   min_fixed_num       至少固定的模糊度个数
+ * @param[out]  F                   部分固定后的模糊度(n×1)
+ * @param[out]  s                   所选子集最优和次优解的残差平方和(1×2)
+ * @return      返回结果\n
+ * -  >0        固定成功, 返回固定的模糊度个数\n
+ * -   0        所有子集均未通过ratio检验\n
+ * -  <0        降相关或搜索失败\n
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int LambdaSolver::PartialSolve(const int &n, const double *a, const double *Q,
+                               const double &ratio_threshold,
+                               const int &min_fixed_num, double *F, double *s)
+{
+    LC_PROFILE_SCOPE(kLambda);
+    int info;
+    ratio_ = 0.0;
+    fixed_num_ = 0;
+    if (n <= 0)
     {
-        /* lambda reduction */
-        reduction(n, L, D, Z);
-        MatrixMulti(n, n, 1, Z, a, z);
-        
-        /* mlambda search */
-        if (!(info = search(n, m, L, D, z, E, s)))
+        printf("LambdaSolver partial solve error! n: %d\n", n);
+        return -1;
+    }
+    Init(n, 2);  // 需要最优和次优两个解
+    if ((info = Reduction(n, Q))) return info;
+    MatrixMulti(n, n, 1, Z_.data(), a, z_.data());
+    
+    int min_num = min_fixed_num > 0 ? min_fixed_num : 1;
+    int head = 0;  // 被剔除(不固定)的模糊度个数
+    for (; n - head >= min_num; ++head)
+    {
+        int sub_n = n - head;
+        info = search(sub_n, n, 2, L_.data() + head + head * n, D_.data() + head,
+                      z_.data() + head, E_.data(), s, S_.data(), dist_.data(),
+                      zb_.data(), zc_.data(), step_.data(), &node_num_);
+        total_node_num_ += node_num_;
+        LC_PROFILE_COUNT(kLambdaNode, node_num_);
+        if (info) continue;  // 搜索次数超限, 继续缩小子集
+        ratio_ = s[0] > 0.0 ? s[1] / s[0] : 0.0;
+        if (ratio_ >= ratio_threshold) break;
+    }
+    if (n - head < min_num) return 0;
+    
+    // 已固定子集的白化残差 w = L'^-1 (z_fix - z), 存在zb_中
+    double *w = zb_.data();
+    for (int j = n - 1; j >= head; --j)
+    {
+        w[j] = E_[j - head] - z_[j];
+        for (int l = j + 1; l < n; ++l) w[j] -= L_[l + j * n] * w[l];
+    }
+    // 整个降相关空间的解, 固定部分取整数解, 其余取条件估值, 存在zc_中
+    double *zc = zc_.data();
+    for (int i = 0; i < n; ++i)
+    {
+        if (i >= head)
         {
-            MatrixInv(n, Z, ZT);
-            MatrixMulti(n, n, 1, ZT, E, F);
-            MatrixMulti(n, n, 1, ZT, E + n, F + n);
+            zc[i] = E_[i - head];
+            continue;
         }
+        zc[i] = z_[i];
+        for (int l = head; l < n; ++l) zc[i] += L_[l + i * n] * w[l];
     }
     
-    delete[] L;
-    delete[] D;
-    delete[] Z;
-    delete[] ZT;
-    delete[] z;
-    delete[] E;
-    return info;
+    if (!MatrixInv(n, Z_.data(), ZT_.data(), is_.data(), js_.data()))
+        return -1;
+    MatrixMulti(n, n, 1, ZT_.data(), zc, F);
+    fixed_num_ = n - head;
+    return fixed_num_;
+}
+
+int LambdaSolver::get_max_n() const
+{
+    return max_n_;
+}
+
+int LambdaSolver::get_max_m() const
+{
+    return max_m_;
 }
 
+long LambdaSolver::get_node_num() const
+{
+    return node_num_;
+}
+
+int LambdaSolver::get_fixed_num() const
+{
+    return fixed_num_;
+}
 
+double LambdaSolver::get_ratio() const
+{
+    return ratio_;
+}
+
+long LambdaSolver::get_total_node_num() const
+{
+    return total_node_num_;
+}
+
+const double *LambdaSolver::get_L() const
+{
+    return L_.data();
+}
+
+const double *LambdaSolver::get_D() const
+{
+    return D_.data();
+}
+
+const double *LambdaSolver::get_Z() const
+{
+    return Z_.data();
+}
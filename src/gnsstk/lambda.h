@@ -0,0 +1,94 @@
+/**@file    lambda.h
+ * @brief   LAMBDA整周模糊度解算.h文件
+ * @details 声明了lambda()接口以及可复用工作区的LambdaSolver类
+ * @author  Zing Fong\n
+ *          zing.fong.whu\@outlook.com
+ * @date    2026/10/18
+ * @version V1.0
+ **********************************************************************************
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Version  <th>Author     <th>Description
+ * <tr><td>2026/10/18   <td>1.0      <td>Zing Fong  <td>Initialize
+ * <tr><td>2026/10/18   <td>1.1      <td>Zing Fong  <td>工作区按实际维数增长
+ * </table>
+ **********************************************************************************
+ */
+#ifndef LOOSECOUPLED_SRC_GNSSTK_LAMBDA_H
+#define LOOSECOUPLED_SRC_GNSSTK_LAMBDA_H
+
+// c/c++系统文件
+
+// 其他库的 .h 文件
+#include <vector>
+
+// 本项目内 .h 文件
+
+extern int lambda(int n, int m, const double *a, const double *Q, double *F,
+                  double *s);  // lambda模糊度搜索
+
+/**@class   LambdaSolver
+ * @brief   LAMBDA模糊度解算器, 工作区只增不减, 模糊度个数稳定后每个历元的解算不再申请内存
+ * @details 矩阵均按列优先存储, 与lambda()保持一致。工作区可以由构造函数或Init预先分配,
+ *          也可以默认构造, 由Solve/PartialSolve按遇到的最大维数扩大
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Author      <th>Description
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>Initialize
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>增加了部分模糊度固定
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>Init改为只增不减, Solve/PartialSolve按需扩大工作区
+ * </table>
+ */
+class LambdaSolver
+{
+  public:
+    LambdaSolver() = default;  // 默认构造函数, 不分配工作区, 首次解算时按维数分配
+    explicit LambdaSolver(const int &max_n, const int &max_m = 2);  // 构造并分配工作区
+
+    void Init(const int &max_n, const int &max_m = 2);  // 保证工作区能容纳给定维数, 只增不减
+    int Solve(const int &n, const int &m, const double *a, const double *Q,
+              double *F, double *s);  // 降相关 + 搜索, 等价于lambda()
+    int Reduction(const int &n, const double *Q);  // LD分解以及降相关, 结果保存在L, D, Z中
+    int Search(const int &n, const int &m, const double *zs, double *zn,
+               double *s);  // 在当前L, D上进行mlambda搜索
+    int PartialSolve(const int &n, const double *a, const double *Q,
+                     const double &ratio_threshold, const int &min_fixed_num,
+                     double *F, double *s);  // 部分模糊度固定
+
+    // get
+    int get_max_n() const;
+    int get_max_m() const;
+    long get_node_num() const;
+    long get_total_node_num() const;
+    int get_fixed_num() const;
+    double get_ratio() const;
+    const double *get_L() const;
+    const double *get_D() const;
+    const double *get_Z() const;
+
+  private:
+    int max_n_{};  // 最大模糊度维数
+    int max_m_{};  // 最大备选解个数
+    long node_num_{};  // 最近一次搜索访问的节点数
+    long total_node_num_{};  // 累计搜索节点数
+    int fixed_num_{};  // 部分固定时实际固定的模糊度个数
+    double ratio_{};  // 部分固定时所选子集的ratio值
+
+    std::vector<double> L_{};  // 下三角阵L, n×n
+    std::vector<double> D_{};  // 对角阵D, n×1
+    std::vector<double> Z_{};  // 整数变换矩阵Z, n×n
+    std::vector<double> ZT_{};  // Z转置的逆, n×n
+    std::vector<double> z_{};  // 降相关后的浮点模糊度, n×1
+    std::vector<double> E_{};  // 降相关空间的整数解, n×m
+    std::vector<double> A_{};  // LD分解工作区, n×n
+    std::vector<double> S_{};  // 搜索工作区, n×n
+    std::vector<double> dist_{};  // 搜索工作区, n×1
+    std::vector<double> zb_{};  // 搜索工作区, n×1
+    std::vector<double> zc_{};  // 搜索工作区, n×1
+    std::vector<double> step_{};  // 搜索工作区, n×1
+    std::vector<int> is_{};  // 求逆主元行号, n×1
+    std::vector<int> js_{};  // 求逆主元列号, n×1
+};
+
+
+#endif //LOOSECOUPLED_SRC_GNSSTK_LAMBDA_H
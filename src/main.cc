@@ -19,6 +19,7 @@
  * <table>
  * <tr><th>Date         <th>Version         <th>Author      <th>Description </tr>
  * <tr><td>2022/6/7     <td>1.0             <td>Zing Fong   <td>创建初始版本  </tr>
+ * <tr><td>2026/10/18   <td>1.1             <td>Zing Fong   <td>接入BaseApp::run  </tr>
  * </table>
  **********************************************************************************
  */
@@ -32,22 +33,6 @@
 
 int main()
 {
-    
-//    Config config{};
-//    bool ret = config.ReadConfig("config.ini");
-//    if (!ret)
-//    {
-//        return 1;
-//    }
-//    std::string HostName = config.ReadString("MYSQL", "HostName", "");
-//    int Port = config.ReadInt("MYSQL", "Port", 0);
-//    std::string UserName = config.ReadString("MYSQL", "UserName", "");
-//
-//    std::cout << "HostName=" << HostName << std::endl;
-//    std::cout << "Port=" << Port << std::endl;
-//    std::cout << "UserName=" << UserName << std::endl;
-//
-//    system("Pause");
-    return 0;
+    BaseApp app{};
+    return app.run();
 }
-
@@ -1,18 +1,627 @@
-//
-// Created by Zing Fong on 2022/5/25.
-//
+/**@file    sins_app.cc
+ * @brief   惯导应用程序.cc文件
+ * @details 实现了纯惯导和GNSS/INS松组合的流式解算, 以及供分时段并行后处理调用的单窗口解算
+ * @author  Zing Fong\n
+ *          zing.fong.whu\@outlook.com
+ * @date    2022/6/15
+ * @version V1.1
+ **********************************************************************************
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Version  <th>Author     <th>Description
+ * <tr><td>2022/6/15    <td>1.0      <td>Zing Fong  <td>Initialize
+ * <tr><td>2026/10/18   <td>1.1      <td>Zing Fong  <td>实现了流式解算驱动
+ * <tr><td>2026/10/18   <td>1.2      <td>Zing Fong  <td>增加了单历元耗时统计
+ * <tr><td>2026/10/18   <td>1.3      <td>Zing Fong  <td>增加了结果输出耗时统计
+ * <tr><td>2026/10/18   <td>1.4      <td>Zing Fong  <td>历元计数用于内存申请统计的稳态判断
+ * <tr><td>2026/10/18   <td>1.5      <td>Zing Fong  <td>参数改为按双精度读取
+ * <tr><td>2026/10/18   <td>1.6      <td>Zing Fong  <td>松组合在历元间隙应用热更新的噪声参数
+ * <tr><td>2026/10/18   <td>1.7      <td>Zing Fong  <td>增加了混合精度解算
+ * <tr><td>2026/10/18   <td>1.8      <td>Zing Fong  <td>按[LC] state_dim选择误差状态维数
+ * <tr><td>2026/10/18   <td>1.9      <td>Zing Fong  <td>热更新时同时应用协方差传播间隔
+ * <tr><td>2026/10/18   <td>1.10     <td>Zing Fong  <td>按[SINS] frame选择NED或ECEF系机械编排
+ * <tr><td>2026/10/18   <td>1.11     <td>Zing Fong  <td>窗口用运动中对准初始化, IMU文件按时刻定位, 分时段结果按窗口顺序写出10列
+ * </table>
+ **********************************************************************************
+ */
 
+// 本类对应的.h文件
 #include "sins_app.h"
+// c/c++系统文件
+#include <cstdio>
+// 其他库的 .h 文件
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
 
-void SinsApp::SinsMechanizationDemo()
+// 本项目内 .h 文件
+#include "../basetk/base_profiler.h"
+
+namespace
+{
+/**@brief       写一行结果, 流式解算和分时段解算共用
+ * @details     每行格式: 时间 纬度(°) 经度(°) 高程(m) 北东地速度(m/s) 横滚 俯仰 航向(°)
+ */
+void WriteLine(FILE *file_ptr, const double &t, const std::vector<double> &blh,
+               const double *v_ned, const double *euler)
+{
+    const double &R2D = BaseSdc::kR2D;
+    fprintf(file_ptr, "%.4f %.10f %.10f %.4f %.4f %.4f %.4f %.6f %.6f %.6f\n",
+            t, blh[0]*R2D, blh[1]*R2D, blh[2], v_ned[0], v_ned[1], v_ned[2],
+            euler[0]*R2D, euler[1]*R2D, euler[2]*R2D);
+}
+}
+
+/**@brief       读取初始状态、GNSS量测噪声、解算精度、导航坐标系、状态维数和结果文件路径
+ * @details     初始位置、速度和姿态只在纯惯导模式下全部使用,
+ *              松组合模式下位置和速度取自第一个GNSS历元, 航向由GNSS速度确定。
+ *              [SINS] precision为mixed时协方差和姿态更新用单精度, 缺省为double;
+ *              [SINS] frame为ecef时在地心地固系下机械编排和建立误差模型, 缺省为ned;
+ *              [LC] state_dim为松组合误差状态维数, 15不估计比例因子, 18只估计陀螺比例因子, 缺省为21
+ * @param[in]   config          配置表
+ * @param[in]   coupled         true为松组合, false为纯惯导
+ * @return      0为正常
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int SinsApp::Init(const Config &config, const bool &coupled)
+{
+    config_ = config;
+    coupled_ = coupled;
+    init_state_ = ReadInitState(config);
+
+    gnss_pos_std_ = config.ReadDouble("LC", "gnss_pos_std", 0.05);
+    gnss_hgt_std_ = config.ReadDouble("LC", "gnss_hgt_std", 0.1);
+    align_speed_ = config.ReadDouble("LC", "align_speed", 1.0);
+    auto precision = config.ReadString("SINS", "precision", "double");
+    mixed_precision_ = precision == "mixed";
+    if(!mixed_precision_ && precision != "double")
+        printf("Unknown precision %s, use double\n", precision.c_str());
+    auto frame = config.ReadString("SINS", "frame", "ned");
+    frame_ = frame == "ecef" ? NavFrame::kEcef : NavFrame::kNed;
+    if(frame != "ecef" && frame != "ned")
+        printf("Unknown frame %s, use ned\n", frame.c_str());
+    state_dim_ = config.ReadInt("LC", "state_dim", 21);
+    if(state_dim_ != 15 && state_dim_ != 18 && state_dim_ != 21)
+    {
+        printf("Unsupported state dimension %d, use 21\n", state_dim_);
+        state_dim_ = 21;
+    }
+    result_file_path_ = config.ReadString("OUTPUT", "result_file_path",
+                                          "result.txt");
+    return 0;
+}
+
+/**@brief       读取配置文件中的初始状态
+ * @details     [SINS]中的init_time(周秒), init_lat/init_lon(°), init_h(m),
+ *              init_vn/init_ve/init_vd(m/s), init_roll/init_pitch/init_yaw(°), 缺省为0
+ * @param[in]   config          配置表
+ * @return      初始状态
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+StateInfo SinsApp::ReadInitState(const Config &config)
+{
+    const double &D2R = BaseSdc::kD2R;
+    // 经纬度需要双精度, 所以不用ReadFloat
+    auto read_double = [&config](const char *item)
+    {
+        return config.ReadDouble("SINS", item, 0.0);
+    };
+    StateInfo state{};
+    state.time = read_double("init_time");
+    state.blh[0] = read_double("init_lat")*D2R;
+    state.blh[1] = read_double("init_lon")*D2R;
+    state.blh[2] = read_double("init_h");
+    state.v_ned[0] = read_double("init_vn");
+    state.v_ned[1] = read_double("init_ve");
+    state.v_ned[2] = read_double("init_vd");
+    std::vector<double> euler(3, 0.0);
+    euler[0] = read_double("init_roll")*D2R;
+    euler[1] = read_double("init_pitch")*D2R;
+    euler[2] = read_double("init_yaw")*D2R;
+    state.q = BaseMath::Euler2Quaternion(euler);
+    state.c_b_n = BaseMath::Quaternion2RotationMat(state.q);
+    state.xyz = BaseMath::Blh2Xyz(state.blh);
+    state.v_enu = BaseMath::Ned2Enu(state.v_ned);
+    return state;
+}
+
+/**@brief       由GNSS位置速度计算初始状态
+ * @details     横滚和俯仰取配置值; 速度大于align_speed_时航向取速度方向, 否则取配置值
+ * @param[in]   t               初始时刻
+ * @param[in]   xyz             GNSS位置(ECEF)
+ * @param[in]   v_ecef          GNSS速度(ECEF)
+ * @return      初始状态
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+StateInfo SinsApp::InitState(const double &t, const std::vector<double> &xyz,
+                             const std::vector<double> &v_ecef) const
 {
-    Config config{};  // 配置表
-    bool ret = config.ReadConfig("config.ini");
-    if (!ret)
+    StateInfo state = init_state_;
+    state.time = t;
+    state.xyz = xyz;
+    state.blh = BaseMath::Xyz2Blh(xyz);
+    state.v_ecef = v_ecef;
+    state.v_enu = BaseMath::CalcDenu(xyz, BaseMath::XyzAdd(xyz, v_ecef));
+    state.v_ned = BaseMath::Enu2Ned(state.v_enu);
+
+    auto euler = BaseMath::Quaternion2Euler(init_state_.q);
+    if(hypot(state.v_ned[0], state.v_ned[1]) > align_speed_)
+        euler[2] = atan2(state.v_ned[1], state.v_ned[0]);
+    state.q = BaseMath::Euler2Quaternion(euler);
+    state.c_b_n = BaseMath::Quaternion2RotationMat(state.q);
+    return state;
+}
+
+/**@brief       运动中对准, 由GNSS速度和IMU比力确定初始姿态
+ * @details     从gnss_pos的当前历元开始, 逐个GNSS历元累加相邻两历元间的IMU速度增量, 得到b系平均比力f_b;
+ *              相邻两历元的GNSS速度差分减去重力并补偿哥氏加速度, 得到n系平均比力f_n。
+ *              第一个水平速度大于align_speed_的历元处, 航向取速度方向, 横滚和俯仰由f_n = C_b^n·f_b求解:
+ *              记u = R_z(ψ_m)ᵀ·f_n(ψ_m为两历元平均速度的方向), 横滚满足(R_x(φ)·f_b)_y = u_y, 两个解中取接近静止时
+ *              atan2(-f_by, -f_bz)的一个; 俯仰为R_x(φ)·f_b与u在x-z平面内的夹角。
+ *              比力取间隔内的平均值, 加减速和转弯时的水平加速度也参与求解, 不需要假设载体匀速。
+ * @param[in]   imu_stream      IMU文件流, 当前历元为gnss_pos当前历元时刻的IMU历元, 返回时为对准历元
+ * @param[in]   gnss_pos        GNSS结果文件流, 返回时为对准历元
+ * @param[in]   t_end           对准的最晚时刻
+ * @param[out]  state           初始状态, 位置和速度取对准历元的GNSS结果
+ * @return      0为正常, -1为t_end之前没有满足条件的历元
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int SinsApp::AlignInMotion(SinsFileStream &imu_stream, GnssPos &gnss_pos,
+                           const double &t_end, StateInfo &state) const
+{
+    const double kTimeEps = 1e-6;  // 时间比较容差(s)
+    const double &omega_e = BaseSdc::wgs84.kOmega;
+    double t_prev = imu_stream.get_raw_data().t;
+    auto v_prev = InitState(t_prev, gnss_pos.get_pos(), gnss_pos.get_v()).v_ned;
+    while(gnss_pos.ReadOneSec() == 0 && gnss_pos.get_t() <= t_end + kTimeEps)
+    {
+        // 累加到当前GNSS历元为止的速度增量
+        double sum_acc[3] = {0.0, 0.0, 0.0};
+        while(imu_stream.get_raw_data().t < gnss_pos.get_t() - kTimeEps)
+        {
+            if(imu_stream.ReadImuFile() != 0)
+                return -1;
+            for(int i = 0; i < 3; ++i)
+                sum_acc[i] += imu_stream.get_raw_data().acc[i];
+        }
+        double t_cur = imu_stream.get_raw_data().t;
+        auto cur = InitState(t_cur, gnss_pos.get_pos(), gnss_pos.get_v());
+        double dt = t_cur - t_prev;
+        if(dt > kTimeEps && hypot(cur.v_ned[0], cur.v_ned[1]) > align_speed_)
+        {
+            double f_b[3], f_n[3], v_mid[3];
+            auto g_n = BaseMath::CalcGn(cur.blh);
+            double omega_ie_n[3] = {omega_e*cos(cur.blh[0]), 0.0, -omega_e*sin(cur.blh[0])};
+            for(int i = 0; i < 3; ++i)
+            {
+                f_b[i] = sum_acc[i]/dt;
+                v_mid[i] = 0.5*(v_prev[i] + cur.v_ned[i]);
+            }
+            // f_n = v̇ - g + 2ω_ie×v, 牵连角速度ω_en的影响比ω_ie小得多, 不计
+            double coriolis[3] = {omega_ie_n[1]*v_mid[2] - omega_ie_n[2]*v_mid[1],
+                                  omega_ie_n[2]*v_mid[0] - omega_ie_n[0]*v_mid[2],
+                                  omega_ie_n[0]*v_mid[1] - omega_ie_n[1]*v_mid[0]};
+            for(int i = 0; i < 3; ++i)
+                f_n[i] = (cur.v_ned[i] - v_prev[i])/dt - g_n[i] + 2*coriolis[i];
+            
+            // 比力是间隔内的平均值, 对应间隔中点的航向
+            double yaw_mid = atan2(v_mid[1], v_mid[0]);
+            double u[3] = {cos(yaw_mid)*f_n[0] + sin(yaw_mid)*f_n[1],
+                           -sin(yaw_mid)*f_n[0] + cos(yaw_mid)*f_n[1], f_n[2]};
+            double r = hypot(f_b[1], f_b[2]);
+            double alpha = atan2(f_b[2], f_b[1]);
+            double beta = acos(std::max(-1.0, std::min(1.0, u[1]/r)));
+            double roll_static = atan2(-f_b[1], -f_b[2]);
+            double roll = beta - alpha;
+            double roll_other = -beta - alpha;
+            auto angle_diff = [](const double &a, const double &b)
+            {
+                return fabs(remainder(a - b, 2*BaseSdc::kPi));
+            };
+            if(angle_diff(roll_other, roll_static) < angle_diff(roll, roll_static))
+                roll = roll_other;
+            roll = remainder(roll, 2*BaseSdc::kPi);
+            // R_x(φ)·f_b的x、z分量
+            double x_x = f_b[0];
+            double x_z = sin(roll)*f_b[1] + cos(roll)*f_b[2];
+            double pitch = remainder(atan2(x_z, x_x) - atan2(u[2], u[0]), 2*BaseSdc::kPi);
+            
+            std::vector<double> euler = {roll, pitch,
+                                         atan2(cur.v_ned[1], cur.v_ned[0])};
+            cur.q = BaseMath::Euler2Quaternion(euler);
+            cur.c_b_n = BaseMath::Quaternion2RotationMat(cur.q);
+            state = cur;
+            return 0;
+        }
+        t_prev = t_cur;
+        v_prev = cur.v_ned;
+    }
+    return -1;
+}
+
+/**@brief       将IMU文件移动到t之前不远处, 之后顺序读取跳过早于t的历元即可
+ * @details     二进制格式按时刻二分查找; 文本格式用GetTimeSpan建立的索引, 没有索引时不移动
+ * @param[in]   imu_stream      IMU文件流, 刚打开
+ * @param[in]   t               时刻(s)
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void SinsApp::SeekImu(SinsFileStream &imu_stream, const double &t) const
+{
+    const double kTimeEps = 1e-6;  // 时间比较容差(s)
+    if(imu_stream.get_binary())
+    {
+        imu_stream.SeekTime(t - kTimeEps);
         return;
-    sins_file_stream_.Init(config);  // 文件流初始化
-    
-    
-    
-    
+    }
+    // 最后一个早于t的索引项
+    auto it = std::lower_bound(imu_index_.begin(), imu_index_.end(), t - kTimeEps,
+                               [](const std::pair<double, long> &item, const double &value)
+                               {
+                                   return item.first < value;
+                               });
+    if(it != imu_index_.begin())
+        imu_stream.Seek((it - 1)->second);
+}
+
+/**@brief       按配置的导航坐标系、精度和状态维数逐历元解算[t_begin, t_end]内的数据
+ * @param[in]   t_begin         解算开始时刻, 松组合模式下从此后第一个GNSS历元开始
+ * @param[in]   t_end           解算结束时刻
+ * @param[in]   t_output        从此时刻开始输出结果
+ * @param[in]   align           松组合是否用运动中对准初始化, 否则横滚和俯仰取配置值
+ * @param[in]   output          结果输出回调
+ * @return      处理的IMU历元数, 出错返回-1
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+long SinsApp::Process(const double &t_begin, const double &t_end,
+                      const double &t_output, const bool &align,
+                      const OutputFunc &output) const
+{
+    if(frame_ == NavFrame::kEcef)
+        return ProcessFrame<NavFrame::kEcef>(t_begin, t_end, t_output, align, output);
+    return ProcessFrame<NavFrame::kNed>(t_begin, t_end, t_output, align, output);
+}
+
+/**@brief       按配置的精度和状态维数逐历元解算[t_begin, t_end]内的数据
+ * @tparam      Frame           导航坐标系
+ * @param[in]   t_begin         解算开始时刻, 松组合模式下从此后第一个GNSS历元开始
+ * @param[in]   t_end           解算结束时刻
+ * @param[in]   t_output        从此时刻开始输出结果
+ * @param[in]   align           松组合是否用运动中对准初始化
+ * @param[in]   output          结果输出回调
+ * @return      处理的IMU历元数, 出错返回-1
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<NavFrame Frame>
+long SinsApp::ProcessFrame(const double &t_begin, const double &t_end,
+                           const double &t_output, const bool &align,
+                           const OutputFunc &output) const
+{
+    if(mixed_precision_)
+    {
+        if(state_dim_ == 15)
+            return ProcessT<float, 15, Frame>(t_begin, t_end, t_output, align, output);
+        if(state_dim_ == 18)
+            return ProcessT<float, 18, Frame>(t_begin, t_end, t_output, align, output);
+        return ProcessT<float, 21, Frame>(t_begin, t_end, t_output, align, output);
+    }
+    if(state_dim_ == 15)
+        return ProcessT<double, 15, Frame>(t_begin, t_end, t_output, align, output);
+    if(state_dim_ == 18)
+        return ProcessT<double, 18, Frame>(t_begin, t_end, t_output, align, output);
+    return ProcessT<double, 21, Frame>(t_begin, t_end, t_output, align, output);
+}
+
+/**@brief       逐历元解算[t_begin, t_end]内的数据
+ * @details     IMU和GNSS文件各自顺序读取, 每次只保存当前历元。GNSS历元在最近的IMU历元处进行量测更新。
+ *              IMU文件先定位到开始时刻附近, 不从头读取。
+ *              align为true时从第一个速度大于align_speed_的GNSS历元开始, 用运动中对准的姿态初始化,
+ *              供分时段解算的非首个窗口使用, 窗口起点可能在任意航向的静止段。
+ * @tparam      T               协方差和姿态更新的精度, 只在本文件中实例化double和float
+ * @tparam      N               松组合误差状态维数, 15、18或21
+ * @tparam      Frame           导航坐标系, 纯惯导和松组合使用同一坐标系的机械编排
+ * @param[in]   t_begin         解算开始时刻, 松组合模式下从此后第一个GNSS历元开始
+ * @param[in]   t_end           解算结束时刻
+ * @param[in]   t_output        从此时刻开始输出结果
+ * @param[in]   align           松组合是否用运动中对准初始化
+ * @param[in]   output          结果输出回调
+ * @return      处理的IMU历元数, 出错返回-1
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename T, int N, NavFrame Frame>
+long SinsApp::ProcessT(const double &t_begin, const double &t_end,
+                       const double &t_output, const bool &align,
+                       const OutputFunc &output) const
+{
+    const double kTimeEps = 1e-6;  // 时间比较容差(s)
+    SinsFileStream imu_stream{};
+    imu_stream.Init(config_);
+    GnssPos gnss_pos{};
+
+    StateInfo state = init_state_;
+    double t_start = fmax(t_begin, init_state_.time);
+    bool has_gnss = false;
+    if(coupled_)
+    {
+        if(gnss_pos.Init(config_) != 0)
+            return -1;
+        // 找到第一个不早于t_begin的GNSS历元, 作为初始位置和速度
+        while((has_gnss = gnss_pos.ReadOneSec() == 0) &&
+              gnss_pos.get_t() < t_begin - kTimeEps);
+        if(!has_gnss)
+        {
+            printf("No GNSS epoch after %.3f!\n", t_begin);
+            return -1;
+        }
+        t_start = gnss_pos.get_t();
+    }
+
+    // 定位到初始时刻附近, 再跳过之前的IMU数据
+    SeekImu(imu_stream, t_start);
+    int ret;
+    while((ret = imu_stream.ReadImuFile()) == 0 &&
+          imu_stream.get_raw_data().t < t_start - kTimeEps);
+    if(ret != 0)
+        return 0;
+    if(coupled_ && align)
+    {
+        if(AlignInMotion(imu_stream, gnss_pos, t_end, state) != 0)
+        {
+            printf("Warning! No GNSS epoch faster than %.2fm/s in [%.3f, %.3f], "
+                   "cannot align!\n", align_speed_, t_begin, t_end);
+            return 0;
+        }
+    }
+    else if(coupled_)
+        state = InitState(imu_stream.get_raw_data().t, gnss_pos.get_pos(),
+                          gnss_pos.get_v());
+    else
+        state.time = imu_stream.get_raw_data().t;
+    ImuData imu_data = imu_stream.get_raw_data();
+
+    using LooseCoupled = SinsLooseCoupledT<T, N, Frame>;
+    typename LooseCoupled::Mechanization mechanization{};
+    LooseCoupled loose_coupled{};
+    if(coupled_)
+    {
+        loose_coupled.Init(config_, state);
+        loose_coupled.Predict(imu_data);
+        has_gnss = gnss_pos.ReadOneSec() == 0;  // 第一个GNSS历元已用于初始化
+    }
+    else
+    {
+        mechanization.Init(state);
+        mechanization.ImuMechanization(imu_data);
+    }
+    if(imu_data.t >= t_output - kTimeEps)
+        output(state);
+
+    std::vector<double> pos_std = {gnss_pos_std_, gnss_pos_std_,
+                                   gnss_hgt_std_};
+    StateInfo gnss_state{};
+    uint64_t config_version = config_watcher_ != nullptr ?
+                              config_watcher_->get_version() : 0;
+    long epoch_num = 1;
+    while(imu_stream.ReadImuFile() == 0)
+    {
+        imu_data = imu_stream.get_raw_data();
+        if(imu_data.t > t_end + kTimeEps)
+            break;
+        ++epoch_num;
+        LC_ALLOC_EPOCH();
+        LC_PROFILE_SCOPE(kEpoch);
+        if(!coupled_)
+        {
+            mechanization.ImuMechanization(imu_data);
+            if(imu_data.t >= t_output - kTimeEps)
+                output(mechanization.get_cur_state());
+            continue;
+        }
+
+        // 配置文件有更新时, 在历元间隙换用新的噪声参数和协方差传播间隔, 不重新初始化滤波器
+        if(config_watcher_ != nullptr &&
+           config_watcher_->get_version() != config_version)
+        {
+            config_version = config_watcher_->get_version();
+            const Config &config = *config_watcher_->get_config();
+            LooseCoupledParams params{};
+            params.Read(config);
+            loose_coupled.SetNoise(params);
+            loose_coupled.SetDecimation(params);
+            pos_std = {config.ReadDouble("LC", "gnss_pos_std", gnss_pos_std_),
+                       config.ReadDouble("LC", "gnss_pos_std", gnss_pos_std_),
+                       config.ReadDouble("LC", "gnss_hgt_std", gnss_hgt_std_)};
+            printf("%.3f: filter parameters updated, gnss std %.3f/%.3f m\n",
+                   imu_data.t, pos_std[0], pos_std[2]);
+        }
+        double half_dt = 0.5*(imu_data.t - loose_coupled.get_t());
+        loose_coupled.Predict(imu_data);
+        // 落在当前IMU历元前后半个采样间隔内的GNSS历元进行量测更新, 更早的直接跳过
+        while(has_gnss && gnss_pos.get_t() <= imu_data.t + half_dt)
+        {
+            if(gnss_pos.get_t() > imu_data.t - half_dt)
+            {
+                gnss_state.xyz = gnss_pos.get_pos();
+                gnss_state.blh = BaseMath::Xyz2Blh(gnss_state.xyz);
+                loose_coupled.Update(gnss_state, pos_std);
+            }
+            has_gnss = gnss_pos.ReadOneSec() == 0;
+        }
+        if(imu_data.t >= t_output - kTimeEps)
+            output(loose_coupled.get_state());
+    }
+    return epoch_num;
+}
+
+/**@brief       流式解算, 结果逐历元写入结果文件
+ * @details     每行格式: 时间 纬度(°) 经度(°) 高程(m) 北东地速度(m/s) 横滚 俯仰 航向(°)
+ * @return      处理的IMU历元数, 出错返回-1
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+long SinsApp::Run() const
+{
+    FILE *file_ptr = fopen(result_file_path_.c_str(), "w");
+    if(file_ptr == nullptr)
+    {
+        printf("Cannot open result file! file path: %s\n",
+               result_file_path_.c_str());
+        return -1;
+    }
+    auto write_result = [file_ptr](const StateInfo &state)
+    {
+        LC_PROFILE_SCOPE(kOutput);
+        auto euler = BaseMath::Quaternion2Euler(state.q);
+        WriteLine(file_ptr, state.time, state.blh, state.v_ned.data(), euler.data());
+    };
+    long epoch_num = Process(0.0, 1e10, 0.0, false, write_result);
+    fclose(file_ptr);
+    return epoch_num;
+}
+
+/**@brief       分时段并行解算, 结果按窗口顺序写入结果文件
+ * @details     前面的窗口都已写出后, 一个窗口解算完成即写出其有效段, 不缓存整个任务的结果。
+ *              行格式与Run相同
+ * @param[in]   time_slicer     已读取窗口参数的调度器, 返回后可以取一致性报告
+ * @return      输出的历元数, 出错返回-1
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+long SinsApp::RunSliced(TimeSlicer &time_slicer)
+{
+    double t_begin{}, t_end{};
+    if(GetTimeSpan(t_begin, t_end) != 0)
+    {
+        printf("No IMU data!\n");
+        return -1;
+    }
+    FILE *file_ptr = fopen(result_file_path_.c_str(), "w");
+    if(file_ptr == nullptr)
+    {
+        printf("Cannot open result file! file path: %s\n",
+               result_file_path_.c_str());
+        return -1;
+    }
+    long epoch_num = time_slicer.Run(
+            t_begin, t_end,
+            [this](const TimeWindow &window)
+            {
+                return RunWindow(window);
+            },
+            [file_ptr](const SliceEpoch &epoch)
+            {
+                LC_PROFILE_SCOPE(kOutput);
+                auto blh = BaseMath::Xyz2Blh({epoch.xyz[0], epoch.xyz[1], epoch.xyz[2]});
+                WriteLine(file_ptr, epoch.t, blh, epoch.v, epoch.att);
+            });
+    fclose(file_ptr);
+    return epoch_num;
+}
+
+/**@brief       解算一个时间窗口
+ * @details     从warm_begin开始解算, 预热段的结果也一并返回, 由TimeSlicer比较重叠段一致性后丢弃。
+ *              第一个窗口与Run相同地初始化, 之后的窗口用运动中对准初始化, 不使用配置的姿态。
+ *              各窗口独立打开文件, 可以在多个线程中同时调用。
+ * @param[in]   window          时间窗口
+ * @return      按时间排序的结果, xyz为ECEF坐标, v为NED速度, att为横滚、俯仰、航向(rad)
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+std::vector<SliceEpoch> SinsApp::RunWindow(const TimeWindow &window) const
+{
+    std::vector<SliceEpoch> result;
+    Process(window.warm_begin, window.end, window.warm_begin, window.id > 0,
+            [&result](const StateInfo &state)
+            {
+                SliceEpoch epoch{};
+                epoch.t = state.time;
+                auto euler = BaseMath::Quaternion2Euler(state.q);
+                for(int i = 0; i < 3; ++i)
+                {
+                    epoch.xyz[i] = state.xyz[i];
+                    epoch.v[i] = state.v_ned[i];
+                    epoch.att[i] = euler[i];
+                }
+                result.push_back(epoch);
+            });
+    // 重叠段内一直静止时在有效段内才能对准, 之前的有效段没有结果
+    const double kTimeEps = 1e-6;  // 时间比较容差(s)
+    if(window.id > 0 && (result.empty() || result.front().t > window.begin + kTimeEps))
+        printf("Warning! Window %d aligned at %.3f, no result from %.3f\n", window.id,
+               result.empty() ? window.end : result.front().t, window.begin);
+    return result;
+}
+
+/**@brief       得到IMU数据起止时刻
+ * @details     二进制格式只读第一个和最后一个历元; 文本格式顺序扫描一遍,
+ *              每kIndexStep个历元记录一次时刻和文件偏移, 各窗口由此直接定位, 不再从头读取
+ * @param[out]  t_begin         第一个历元时刻
+ * @param[out]  t_end           最后一个历元时刻
+ * @return      0为正常, -1为文件中没有数据
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int SinsApp::GetTimeSpan(double &t_begin, double &t_end)
+{
+    SinsFileStream imu_stream{};
+    imu_stream.Init(config_);
+    imu_index_.clear();
+    if(imu_stream.get_binary())
+    {
+        long record_num = imu_stream.GetRecordNum();
+        if(record_num <= 0 || imu_stream.ReadImuFile() != 0)
+            return -1;
+        t_begin = imu_stream.get_raw_data().t;
+        if(imu_stream.SeekRecord(record_num - 1) != 0 || imu_stream.ReadImuFile() != 0)
+            return -1;
+        t_end = imu_stream.get_raw_data().t;
+        return 0;
+    }
+    long offset = imu_stream.Tell();
+    if(imu_stream.ReadImuFile() != 0)
+        return -1;
+    t_begin = t_end = imu_stream.get_raw_data().t;
+    imu_index_.emplace_back(t_begin, offset);
+    for(long i = 1;; ++i)
+    {
+        offset = imu_stream.Tell();
+        if(imu_stream.ReadImuFile() != 0)
+            break;
+        t_end = imu_stream.get_raw_data().t;
+        if(i%kIndexStep == 0)
+            imu_index_.emplace_back(t_end, offset);
+    }
+    return 0;
+}
+
+bool SinsApp::get_coupled() const
+{
+    return coupled_;
+}
+
+bool SinsApp::get_mixed_precision() const
+{
+    return mixed_precision_;
+}
+
+int SinsApp::get_state_dim() const
+{
+    return state_dim_;
+}
+
+NavFrame SinsApp::get_frame() const
+{
+    return frame_;
+}
+
+void SinsApp::set_config_watcher(const ConfigWatcher *config_watcher)
+{
+    config_watcher_ = config_watcher;
 }
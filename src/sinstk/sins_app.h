@@ -1,15 +1,21 @@
 /**@file    sins_app.h
  * @brief   惯导应用程序.h文件
- * @details 提供了惯导机械编排算法的demo
+ * @details 纯惯导和GNSS/INS松组合的流式解算驱动, 逐历元读取、解算并输出, 不缓存整个文件
  * @author  Zing Fong\n
  *          zing.fong.whu\@outlook.com
  * @date    2022/6/15
- * @version V1.0
+ * @version V1.1
  **********************************************************************************
  * @par 修改日志:
  * <table>
  * <tr><th>Date         <th>Version  <th>Author     <th>Description
  * <tr><td>2022/6/15    <td>1.0      <td>Zing Fong  <td>Initialize
+ * <tr><td>2026/10/18   <td>1.1      <td>Zing Fong  <td>实现了纯惯导和松组合的流式解算及分时段并行解算
+ * <tr><td>2026/10/18   <td>1.2      <td>Zing Fong  <td>流式解算支持配置文件热更新
+ * <tr><td>2026/10/18   <td>1.3      <td>Zing Fong  <td>可以选择混合精度解算
+ * <tr><td>2026/10/18   <td>1.4      <td>Zing Fong  <td>可以选择松组合的误差状态维数
+ * <tr><td>2026/10/18   <td>1.5      <td>Zing Fong  <td>可以选择机械编排的导航坐标系
+ * <tr><td>2026/10/18   <td>1.6      <td>Zing Fong  <td>分时段解算的窗口运动中对准、IMU文件定位和流式输出
  * </table>
  **********************************************************************************
  */
@@ -19,23 +25,91 @@
 
 // c/c++系统文件
 // 其他库的 .h 文件
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
 
 // 本项目内 .h 文件
+#include "../basetk/base_config_watcher.h"
 #include "../basetk/base_math.h"
 #include "../basetk/base_time.h"
+#include "../basetk/base_time_slicer.h"
 #include "sins_file_stream.h"
 #include "sins_mechanization.h"
+#include "sins_loose_coupled.h"
+#include "../gnsstk/gnss_pos.h"
 
+/**@class   SinsApp
+ * @brief   惯导应用程序类, 由BaseApp根据解算模式调用
+ * @details 数据流: IMU文件流/GNSS结果文件流 -> 机械编排或松组合滤波 -> 结果文件。\n
+ *          每次只保存当前历元, 内存占用与数据时长无关。
+ * @par     修改日志:
+ * <table>
+ * <tr><th>Date         <th>Author      <th>Description
+ * <tr><td>2022/6/15    <td>Zing Fong   <td>Initialize
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>增加了流式解算驱动
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>增加了配置文件热更新
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>增加了混合精度, 由[SINS] precision选择
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>误差状态维数由[LC] state_dim选择
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>导航坐标系由[SINS] frame选择
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>窗口用运动中对准初始化, 按时刻定位IMU文件, 结果按窗口顺序写出
+ * </table>
+ */
 class SinsApp
 {
   public:
-    void SinsMechanizationDemo();  // 测试用例
-  
+    // 输出一个历元的解算结果
+    using OutputFunc = std::function<void(const StateInfo &state)>;
+    
+    int Init(const Config &config, const bool &coupled);  // 读取初始状态和文件路径
+    long Run() const;  // 流式解算并输出到结果文件, 返回处理的IMU历元数, 出错返回-1
+    long RunSliced(TimeSlicer &time_slicer);  // 分时段并行解算, 按窗口顺序写入结果文件, 返回输出的历元数, 出错返回-1
+    std::vector<SliceEpoch> RunWindow(const TimeWindow &window) const;  // 解算一个时间窗口, 供TimeSlicer并行调用
+    int GetTimeSpan(double &t_begin, double &t_end);  // 得到IMU数据起止时刻, 文本格式同时建立定位索引
+    static StateInfo ReadInitState(const Config &config);  // 读取配置文件中的初始状态
+    
+    // get
+    bool get_coupled() const;
+    bool get_mixed_precision() const;
+    int get_state_dim() const;
+    NavFrame get_frame() const;
+    
+    // set
+    void set_config_watcher(const ConfigWatcher *config_watcher);
+    
   private:
+    static constexpr int kIndexStep = 1000;  // 文本格式IMU文件每隔多少个历元记录一个索引
     
-    SinsFileStream sins_file_stream_{};  // IMU文件流对象
-    SinsMechanization sins_mechanization_{};  // IMU机械编排对象
+    long Process(const double &t_begin, const double &t_end,
+                 const double &t_output, const bool &align,
+                 const OutputFunc &output) const;  // 按配置的坐标系、精度和状态维数逐历元解算[t_begin, t_end]内的数据
+    template<NavFrame Frame>
+    long ProcessFrame(const double &t_begin, const double &t_end,
+                      const double &t_output, const bool &align,
+                      const OutputFunc &output) const;  // 按配置的精度和状态维数选择ProcessT
+    template<typename T, int N, NavFrame Frame>
+    long ProcessT(const double &t_begin, const double &t_end,
+                  const double &t_output, const bool &align,
+                  const OutputFunc &output) const;  // 逐历元解算, T为协方差和姿态更新的精度, N为误差状态维数, Frame为导航坐标系
+    StateInfo InitState(const double &t, const std::vector<double> &xyz,
+                        const std::vector<double> &v_ecef) const;  // 由GNSS位置速度计算初始状态
+    int AlignInMotion(SinsFileStream &imu_stream, GnssPos &gnss_pos,
+                      const double &t_end, StateInfo &state) const;  // 运动中由GNSS速度和IMU比力对准
+    void SeekImu(SinsFileStream &imu_stream, const double &t) const;  // 将IMU文件移动到t之前不远处
     
+    Config config_{};  // 配置表, 各窗口解算时需要重新打开文件
+    bool coupled_{};  // 是否进行松组合, 否则为纯惯导
+    bool mixed_precision_{};  // 协方差和姿态更新是否用单精度, 位置始终为双精度
+    int state_dim_ = 21;  // 松组合误差状态维数, 15、18或21
+    NavFrame frame_ = NavFrame::kNed;  // 机械编排和误差状态所在的坐标系
+    StateInfo init_state_{};  // 配置文件给出的初始状态
+    double gnss_pos_std_ = 0.05;  // GNSS水平位置标准差(m)
+    double gnss_hgt_std_ = 0.1;  // GNSS高程标准差(m)
+    double align_speed_ = 1.0;  // 用GNSS速度确定航向的最小速度(m/s)
+    std::string result_file_path_{};  // 结果文件路径
+    std::vector<std::pair<double, long>> imu_index_{};  // 文本格式IMU文件的时刻和文件偏移, 由GetTimeSpan建立, 之后只读
+    const ConfigWatcher *config_watcher_ = nullptr;  // 配置文件监视器, 不为空时在历元间隙应用新参数
 };
 
 
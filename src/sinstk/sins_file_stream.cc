@@ -1,6 +1,6 @@
 /**@file    sins_file_stream.cc
  * @brief   捷联惯导输出文件读取.cc文件
- * @details 支持对txt格式的imu输出文件的读取
+ * @details 支持对txt格式和二进制格式的imu输出文件的读取
  * @author  Zing Fong\n
  *          zing.fong.whu\@outlook.com
  * @date    2022/6/7
@@ -10,6 +10,10 @@
  * <table>
  * <tr><th>Date         <th>Version  <th>Author     <th>Description
  * <tr><td>2022/6/7     <td>1.0      <td>Zing Fong  <td>Initialize
+ * <tr><td>2026/10/18   <td>1.1      <td>Zing Fong  <td>修正了fscanf参数错误, 按返回值判断文件结束
+ * <tr><td>2026/10/18   <td>1.2      <td>Zing Fong  <td>增加了二进制格式的读取
+ * <tr><td>2026/10/18   <td>1.3      <td>Zing Fong  <td>增加了读取耗时统计
+ * <tr><td>2026/10/18   <td>1.4      <td>Zing Fong  <td>增加了按文件偏移和按时刻定位
  * </table>
  **********************************************************************************
  */
@@ -23,6 +27,7 @@
 #include <string>
 
 // 本项目内 .h 文件
+#include "../basetk/base_profiler.h"
 
 /**@brief           读取一行, 并对一行进行分析
  * @param[in]       config        配置表
@@ -34,7 +39,8 @@ int SinsFileStream::Init(const Config &config)
 {
     std::string imu_file_path = config.ReadString("SINS", "imu_file_path",
                                                   "imu.txt");
-    file_ptr_ = fopen(imu_file_path.c_str(), "r");
+    binary_ = config.ReadString("SINS", "imu_file_format", "text") == "binary";
+    file_ptr_ = fopen(imu_file_path.c_str(), binary_ ? "rb" : "r");
     if(file_ptr_ == nullptr)
     {
         // 这里不用fopen_s的异常返回值, 而是通过判断file_ptr是否为空指针的方式判断是否打开成功
@@ -44,28 +50,127 @@ int SinsFileStream::Init(const Config &config)
     return 0;
 }
 
-/**@brief           读取一行, 并对一行进行分析
- * @param[in]       config        配置表
+/**@brief           读取一个历元的IMU数据
+ * @details         每行格式为: 时间 三轴加表输出 三轴陀螺输出, 二进制格式为相同顺序的7个double
  * @return          返回结果:\n
  * -     0          读取正常
- * -    -1          到达文件末尾
+ * -    -1          到达文件末尾或格式错误
  * @author          Zing Fong
  * @date            2022/6/7
  */
 int SinsFileStream::ReadImuFile()
 {
-    if(feof(file_ptr_))  // 已到达文件末尾
+    LC_PROFILE_SCOPE(kImuRead);
+    if(file_ptr_ == nullptr || feof(file_ptr_))  // 已到达文件末尾
         return -1;
+    if(binary_)
+    {
+        double record[7];
+        if(fread(record, sizeof(double), 7, file_ptr_) != 7)
+            return -1;
+        raw_data_.t = record[0];
+        for(int i = 0; i < 3; ++i)
+        {
+            raw_data_.acc[i] = record[1 + i];
+            raw_data_.gyro[i] = record[4 + i];
+        }
+        time_.sec_of_week_ = raw_data_.t;
+        return 0;
+    }
     // 读取一行
-    fscanf(file_ptr_, "%f %f %f %f %f %f %f", time_, raw_data_.acc[0],
-           raw_data_.acc[1], raw_data_.acc[2], raw_data_.gyro[0],
-           raw_data_.gyro[1], raw_data_.gyro[2]);
+    int ret = fscanf(file_ptr_, "%lf %lf %lf %lf %lf %lf %lf", &raw_data_.t,
+                     &raw_data_.acc[0], &raw_data_.acc[1], &raw_data_.acc[2],
+                     &raw_data_.gyro[0], &raw_data_.gyro[1],
+                     &raw_data_.gyro[2]);
+    if(ret != 7)
+        return -1;
+    time_.sec_of_week_ = raw_data_.t;
+    return 0;
+}
+
+/**@brief           移动到文件偏移处
+ * @param[in]       offset      文件偏移(字节), 应为某个历元的开始, 可由Tell得到
+ * @return          0为正常, -1为文件未打开或定位失败
+ * @author          Zing Fong
+ * @date            2026/10/18
+ */
+int SinsFileStream::Seek(const long &offset)
+{
+    if(file_ptr_ == nullptr || fseek(file_ptr_, offset, SEEK_SET) != 0)
+        return -1;
     return 0;
 }
 
+/**@brief           下一次读取的文件偏移
+ * @return          文件偏移(字节), 文件未打开时为-1
+ * @author          Zing Fong
+ * @date            2026/10/18
+ */
+long SinsFileStream::Tell() const
+{
+    return file_ptr_ != nullptr ? ftell(file_ptr_) : -1;
+}
+
+/**@brief           二进制格式的历元数, 由文件长度得到, 不改变读取位置
+ * @return          历元数, 文本格式或文件未打开时为-1
+ * @author          Zing Fong
+ * @date            2026/10/18
+ */
+long SinsFileStream::GetRecordNum() const
+{
+    if(!binary_ || file_ptr_ == nullptr)
+        return -1;
+    long offset = ftell(file_ptr_);
+    fseek(file_ptr_, 0, SEEK_END);
+    long record_num = ftell(file_ptr_)/kRecordSize;
+    fseek(file_ptr_, offset, SEEK_SET);
+    return record_num;
+}
+
+/**@brief           二进制格式: 移动到第index个历元
+ * @param[in]       index       历元序号, 从0开始
+ * @return          0为正常, -1为文本格式或定位失败
+ * @author          Zing Fong
+ * @date            2026/10/18
+ */
+int SinsFileStream::SeekRecord(const long &index)
+{
+    if(!binary_ || index < 0)
+        return -1;
+    return Seek(index*kRecordSize);
+}
+
+/**@brief           二进制格式: 按时刻二分查找, 移动到第一个不早于t的历元
+ * @details         只读每个候选历元的时间, 要求文件按时间排序。所有历元都早于t时移动到文件末尾
+ * @param[in]       t           时刻(s)
+ * @return          0为正常, -1为文本格式或读取失败
+ * @author          Zing Fong
+ * @date            2026/10/18
+ */
+int SinsFileStream::SeekTime(const double &t)
+{
+    long record_num = GetRecordNum();
+    if(record_num < 0)
+        return -1;
+    long low = 0, high = record_num;  // 结果在[low, high]内
+    while(low < high)
+    {
+        long mid = low + (high - low)/2;
+        double t_mid;
+        if(SeekRecord(mid) != 0 || fread(&t_mid, sizeof(double), 1, file_ptr_) != 1)
+            return -1;
+        if(t_mid < t)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    return SeekRecord(low);
+}
+
 SinsFileStream::~SinsFileStream()
 {
-    fclose(file_ptr_);
+    if(file_ptr_ != nullptr)
+        fclose(file_ptr_);
 }
 
 GpsTime SinsFileStream::get_time() const
@@ -77,3 +182,8 @@ ImuData SinsFileStream::get_raw_data() const
 {
     return raw_data_;
 }
+
+bool SinsFileStream::get_binary() const
+{
+    return binary_;
+}
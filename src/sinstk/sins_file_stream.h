@@ -1,6 +1,6 @@
 /**@file    sins_file_stream.h
  * @brief   捷联惯导输出文件读取
- * @details 支持对txt格式的imu输出文件的读取
+ * @details 支持对txt格式和二进制格式的imu输出文件的读取
  * @author  Zing Fong\n
  *          zing.fong.whu\@outlook.com
  * @date    2022/5/31
@@ -10,6 +10,8 @@
  * <table>
  * <tr><th>Date         <th>Version  <th>Author     <th>Description
  * <tr><td>2022/5/31    <td>1.0      <td>Zing Fong  <td>Initialize
+ * <tr><td>2026/10/18   <td>1.1      <td>Zing Fong  <td>增加了二进制格式
+ * <tr><td>2026/10/18   <td>1.2      <td>Zing Fong  <td>增加了按文件偏移和按时刻定位
  * </table>
  **********************************************************************************
  */
@@ -44,10 +46,14 @@ struct ImuData
 
 /**@class   SinsFileStream
  * @brief   捷联惯导输出文件流, 实现了imu文件的读取操作
+ * @details 文本格式每行为: 时间 三轴加表输出 三轴陀螺输出;
+ *          二进制格式每个历元为相同顺序的7个double(本机字节序), 没有文件头
  * @par     修改日志:
  * <table>
  * <tr><th>Date         <th>Author      <th>Description
  * <tr><td>2022/5/31    <td>Zing Fong   <td>Initialize
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>增加了二进制格式, 由[SINS] imu_file_format选择
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>增加了Seek、SeekRecord和SeekTime, 分时段解算时不必从头读取
  * </table>
  */
 class SinsFileStream
@@ -55,15 +61,24 @@ class SinsFileStream
   public:
     int Init(const Config &config);  // 打开文件, 初始化
     int ReadImuFile();  // 读一个历元的IMU数据
+    int Seek(const long &offset);  // 移动到文件偏移处, 下一次从此读取
+    long Tell() const;  // 下一次读取的文件偏移
+    long GetRecordNum() const;  // 二进制格式的历元数
+    int SeekRecord(const long &index);  // 二进制格式: 移动到第index个历元
+    int SeekTime(const double &t);  // 二进制格式: 移动到第一个不早于t的历元
     
     ~SinsFileStream();
     
     // get
     GpsTime get_time() const;
     ImuData get_raw_data() const;
+    bool get_binary() const;
+    
+    static constexpr long kRecordSize = 7*sizeof(double);  // 二进制格式每个历元的字节数
     
   private:
     FILE *file_ptr_{};  // imu文件指针
+    bool binary_{};  // 是否为二进制格式
     GpsTime time_{};  // 时间
     ImuData raw_data_{};  // imu原始数据 b系右前上(ENU)
     
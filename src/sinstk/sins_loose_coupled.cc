@@ -10,6 +10,18 @@
  * <table>
  * <tr><th>Date         <th>Version  <th>Author     <th>Description
  * <tr><td>2022/6/15    <td>1.0      <td>Zing Fong  <td>Initialize
+ * <tr><td>2026/10/18   <td>1.1      <td>Zing Fong  <td>实现了一步预测和量测更新, 修正了F阵中比力和Fvv的错误
+ * <tr><td>2026/10/18   <td>1.2      <td>Zing Fong  <td>增加了预测、F阵计算和量测更新的耗时统计
+ * <tr><td>2026/10/18   <td>1.3      <td>Zing Fong  <td>噪声参数改为通过LooseCoupledParams读取
+ * <tr><td>2026/10/18   <td>1.4      <td>Zing Fong  <td>增加了SetNoise
+ * <tr><td>2026/10/18   <td>1.5      <td>Zing Fong  <td>协方差传播和量测更新改用Gemm、Symm原地运算
+ * <tr><td>2026/10/18   <td>1.6      <td>Zing Fong  <td>F阵改为按3×3子矩阵视图写入
+ * <tr><td>2026/10/18   <td>1.7      <td>Zing Fong  <td>改为模板实现, 滤波矩阵可以用单精度
+ * <tr><td>2026/10/18   <td>1.8      <td>Zing Fong  <td>F阵、过程噪声和反馈校正按StateLayout只处理所选的状态
+ * <tr><td>2026/10/18   <td>1.9      <td>Zing Fong  <td>协方差改为按间隔传播, 间隔内累乘Φ
+ * <tr><td>2026/10/18   <td>1.10     <td>Zing Fong  <td>过程噪声可以用Van Loan法离散化
+ * <tr><td>2026/10/18   <td>1.11     <td>Zing Fong  <td>增加了ECEF系的F阵、量测更新和反馈校正
+ * <tr><td>2026/10/18   <td>1.12     <td>Zing Fong  <td>F阵的马尔科夫项使用配置的相关时间
  * </table>
  **********************************************************************************
  */
@@ -17,114 +29,562 @@
 // 本类对应的.h文件
 #include "sins_loose_coupled.h"
 // c/c++系统文件
+#include <cstdio>
 #include <iostream>
+#ifdef __SSE__
+#include <xmmintrin.h>
+#endif
 // 其他库的 .h 文件
 #include <vector>
 #include <cmath>
+#include <type_traits>
+#include <utility>
 
 // 本项目内 .h 文件
+#include "../basetk/base_profiler.h"
 
-void SinsLooseCoupled::Predict(const ImuData &imu_data)
+namespace
 {
+/**@class   DenormalGuard
+ * @brief   在作用域内将非规格化数置零(x86的FTZ和DAZ), 析构时恢复
+ * @details 单精度的协方差阵中很小的互相关项会落入非规格化数, 运算要慢几十倍, 只在单精度滤波时启用
+ */
+class DenormalGuard
+{
+  public:
+    explicit DenormalGuard(const bool &enable)
+    {
+#ifdef __SSE__
+        if(!enable)
+            return;
+        csr_ = _mm_getcsr();
+        _mm_setcsr(csr_ | 0x8040);  // FTZ | DAZ
+        enabled_ = true;
+#endif
+    }
+    ~DenormalGuard()
+    {
+#ifdef __SSE__
+        if(enabled_)
+            _mm_setcsr(csr_);
+#endif
+    }
+    DenormalGuard(const DenormalGuard &) = delete;
+    DenormalGuard &operator=(const DenormalGuard &) = delete;
+  
+  private:
+    unsigned int csr_{};  // 原有的MXCSR
+    bool enabled_{};  // 是否修改了MXCSR
+};
+}
 
+/**@brief       从配置表读取[LC]块中的滤波参数
+ * @param[in]   config          配置表
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void LooseCoupledParams::Read(const Config &config)
+{
+    using P = LooseCoupledParams;
+    config.Resolve(*this,
+                   ConfigBinding<P, double>("LC", "arw", &P::arw),
+                   ConfigBinding<P, double>("LC", "vrw", &P::vrw),
+                   ConfigBinding<P, double>("LC", "gyro_bias_std", &P::gyro_bias_std),
+                   ConfigBinding<P, double>("LC", "acc_bias_std", &P::acc_bias_std),
+                   ConfigBinding<P, double>("LC", "gyro_scale_std", &P::gyro_scale_std),
+                   ConfigBinding<P, double>("LC", "acc_scale_std", &P::acc_scale_std),
+                   ConfigBinding<P, double>("LC", "corr_time", &P::corr_time),
+                   ConfigBinding<P, double>("LC", "init_pos_std", &P::init_pos_std),
+                   ConfigBinding<P, double>("LC", "init_vel_std", &P::init_vel_std),
+                   ConfigBinding<P, double>("LC", "init_att_std", &P::init_att_std),
+                   ConfigBinding<P, int>("LC", "cov_decimation", &P::cov_decimation),
+                   ConfigBinding<P, double>("LC", "cov_max_angle", &P::cov_max_angle),
+                   ConfigBinding<P, std::string>("LC", "qd_model", &P::qd_model));
 }
 
-void SinsLooseCoupled::Update(const ImuData &imu_data,
-                              const StateInfo &gnss_state)
+/**@brief       初始化, 读取IMU噪声参数并设置初始状态和初始协方差
+ * @param[in]   config          配置表
+ * @param[in]   initial_state   初始位置、速度、姿态
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename T, int N, NavFrame Frame>
+void SinsLooseCoupledT<T, N, Frame>::Init(const Config &config, const StateInfo &initial_state)
 {
+    const double &D2R = BaseSdc::kD2R;
+    LooseCoupledParams params{};
+    params.Read(config);
+    SetNoise(params);
+    cov_epoch_num_ = 0;
+    cov_angle_ = 0.0;
+    SetDecimation(params);
+    double pos_std = params.init_pos_std;
+    double vel_std = params.init_vel_std;
+    double att_std = params.init_att_std*D2R;
+    
+    sins_mechanization_ = Mechanization();
+    sins_mechanization_.Init(initial_state);
+    gyro_bias_ = acc_bias_ = gyro_scale_ = acc_scale_ =
+            std::vector<double>(3, 0.0);
+    
+    // 初始协方差阵
+    using L = Layout;
+    std::vector<T> std_list(kStateDim, 0.0);
+    for(int i = 0; i < 3; ++i)
+    {
+        std_list[L::kPos + i] = pos_std;
+        std_list[L::kVel + i] = vel_std;
+        std_list[L::kAtt + i] = att_std;
+        std_list[L::kGyroBias + i] = gyro_bias_std_;
+        std_list[L::kAccBias + i] = acc_bias_std_;
+        if constexpr(L::kGyroScale >= 0)
+            std_list[L::kGyroScale + i] = gyro_scale_std_;
+        if constexpr(L::kAccScale >= 0)
+            std_list[L::kAccScale + i] = acc_scale_std_;
+    }
+    for(auto &a_std: std_list)
+        a_std *= a_std;
+    p_k_ = BaseMatrixT<T>::Diag(std_list);
+    x_k_ = BaseMatrixT<T>(kStateDim, 1);
+}
+
+/**@brief       设置IMU噪声参数和过程噪声离散化方法, 噪声换算为国际单位, 只影响之后的一步预测
+ * @param[in]   params          滤波参数, 单位与配置文件相同
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename T, int N, NavFrame Frame>
+void SinsLooseCoupledT<T, N, Frame>::SetNoise(const LooseCoupledParams &params)
+{
+    const double &D2R = BaseSdc::kD2R;
+    arw_ = params.arw*D2R/60.0;
+    vrw_ = params.vrw/60.0;
+    gyro_bias_std_ = params.gyro_bias_std*D2R/3600.0;
+    acc_bias_std_ = params.acc_bias_std*1e-5;
+    gyro_scale_std_ = params.gyro_scale_std*1e-6;
+    acc_scale_std_ = params.acc_scale_std*1e-6;
+    corr_time_ = params.corr_time*3600.0;
+    van_loan_ = params.qd_model == "van_loan";
+    if(!van_loan_ && params.qd_model != "first_order")
+        printf("Unknown qd_model %s, use first_order\n", params.qd_model.c_str());
+    process_noise_.SetNoise({arw_, vrw_, gyro_bias_std_, acc_bias_std_,
+                             gyro_scale_std_, acc_scale_std_, corr_time_});
+}
 
+/**@brief       设置协方差传播间隔, 已累积的Φ和Qd先按原间隔传播
+ * @param[in]   params          滤波参数, 使用cov_decimation和cov_max_angle
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename T, int N, NavFrame Frame>
+void SinsLooseCoupledT<T, N, Frame>::SetDecimation(const LooseCoupledParams &params)
+{
+    PropagateCovariance();
+    cov_decimation_ = params.cov_decimation > 1 ? params.cov_decimation : 1;
+    cov_max_angle_ = params.cov_max_angle > 0 ? params.cov_max_angle*BaseSdc::kD2R : 0.0;
+}
+
+/**@brief       零偏和比例因子补偿
+ * @param[in]   imu_data        原始IMU增量输出
+ * @return      补偿后的IMU增量
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename T, int N, NavFrame Frame>
+ImuData SinsLooseCoupledT<T, N, Frame>::CompensateImu(const ImuData &imu_data) const
+{
+    ImuData result = imu_data;
+    double dt = imu_data.t - sins_mechanization_.get_t();
+    if(dt <= 0)
+        return result;
+    for(int i = 0; i < 3; ++i)
+    {
+        result.gyro[i] = (imu_data.gyro[i] - gyro_bias_[i]*dt)/
+                         (1.0 + gyro_scale_[i]);
+        result.acc[i] = (imu_data.acc[i] - acc_bias_[i]*dt)/
+                        (1.0 + acc_scale_[i]);
+    }
+    return result;
+}
+
+/**@brief       一步预测: 机械编排, 并累积状态转移矩阵和系统噪声, 间隔结束时传播协方差阵
+ * @details     间隔第一个历元Φ = I + FΔt, 之后Φ = (I + FΔt)·Φ, F为稀疏阵, Gemm跳过其中的零元素。
+ *              Qd = diag(q)Δt在间隔内累加, 传播时与P = Φ·P·Φᵀ + Qd一样加在末端。
+ *              噪声各轴相同, 所以C_b_n·Q·C_b_nᵀ = Q, 不必旋转。
+ *              间隔为1个历元时与逐历元传播完全相同。单精度时运算期间将非规格化数置零
+ * @param[in]   imu_data        当前历元原始IMU增量输出
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename T, int N, NavFrame Frame>
+void SinsLooseCoupledT<T, N, Frame>::Predict(const ImuData &imu_data)
+{
+    LC_PROFILE_SCOPE(kPredict);
+    DenormalGuard denormal_guard(std::is_same_v<T, float>);
+    ImuData imu = CompensateImu(imu_data);
+    sins_mechanization_.ImuMechanization(imu);
+    double dt = sins_mechanization_.get_delta_t();
+    if(dt <= 0)
+        return;  // 第一个历元, 只做初始化
+    
+    // F阵按双精度计算, 单精度时再转换为滤波矩阵的元素类型
+    auto f = CalcF(imu);
+    if(cov_epoch_num_ == 0)
+    {
+        if constexpr(std::is_same_v<T, double>)
+            phi_k_ksub1_ = std::move(f);
+        else
+            phi_k_ksub1_ = f.template Cast<T>();
+        BaseMatrixT<T>::Scale(dt, phi_k_ksub1_);
+        for(int i = 0; i < kStateDim; ++i)
+            phi_k_ksub1_.write(i, i, phi_k_ksub1_.read(i, i) + 1.0);
+    }
+    else
+    {
+        if constexpr(std::is_same_v<T, double>)
+        {
+            BaseMatrixT<T>::Gemm(dt, f, false, phi_k_ksub1_, false, 0.0, f_phi_);
+        }
+        else
+        {
+            f_k_ = f.template Cast<T>();
+            BaseMatrixT<T>::Gemm(dt, f_k_, false, phi_k_ksub1_, false, 0.0, f_phi_);
+        }
+        BaseMatrixT<T>::Axpy(1.0, f_phi_, phi_k_ksub1_);
+    }
+    
+    if(q_k_.get_row_num() != kStateDim || q_k_.get_col_num() != kStateDim)
+        q_k_ = BaseMatrixT<T>(kStateDim, kStateDim);
+    if(van_loan_)
+    {
+        q_k_.block(0, 0, kStateDim, kStateDim) +=
+                process_noise_.CalcQd(dt, GetCbNav());
+    }
+    else
+    {
+        auto add_q = [this](const int &i, const double &q)
+        {
+            q_k_.write(i, i, q_k_.read(i, i) + q);
+        };
+        using L = Layout;
+        for(int i = 0; i < 3; ++i)
+        {
+            add_q(L::kVel + i, vrw_*vrw_*dt);
+            add_q(L::kAtt + i, arw_*arw_*dt);
+            add_q(L::kGyroBias + i, 2*gyro_bias_std_*gyro_bias_std_/corr_time_*dt);
+            add_q(L::kAccBias + i, 2*acc_bias_std_*acc_bias_std_/corr_time_*dt);
+            if constexpr(L::kGyroScale >= 0)
+                add_q(L::kGyroScale + i, 2*gyro_scale_std_*gyro_scale_std_/corr_time_*dt);
+            if constexpr(L::kAccScale >= 0)
+                add_q(L::kAccScale + i, 2*acc_scale_std_*acc_scale_std_/corr_time_*dt);
+        }
+    }
+    
+    ++cov_epoch_num_;
+    cov_angle_ += BaseMath::Norm(imu.gyro);
+    if(cov_epoch_num_ >= cov_decimation_ ||
+       (cov_max_angle_ > 0 && cov_angle_ >= cov_max_angle_))
+        PropagateCovariance();
+}
+
+/**@brief       用当前间隔累积的Φ和Qd传播协方差阵, 然后开始新的间隔
+ * @details     P = Φ·P·Φᵀ + Qd, 结果写入已有矩阵。间隔内没有历元时不做任何事
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename T, int N, NavFrame Frame>
+void SinsLooseCoupledT<T, N, Frame>::PropagateCovariance()
+{
+    if(cov_epoch_num_ == 0)
+        return;
+    BaseMatrixT<T>::Symm(false, 1.0, p_k_, phi_k_ksub1_, 0.0, phi_p_);
+    p_k_ksub1_ = q_k_;
+    BaseMatrixT<T>::Gemm(1.0, phi_p_, false, phi_k_ksub1_, true, 1.0, p_k_ksub1_);
+    p_k_ = p_k_ksub1_;
+    q_k_.setZero();
+    cov_epoch_num_ = 0;
+    cov_angle_ = 0.0;
+}
+
+/**@brief       GNSS位置量测更新, 更新后进行反馈校正
+ * @details     NED系时观测为INS与GNSS的BLH之差换算成的NED距离, R为对角阵;
+ *              ECEF系时观测直接为XYZ之差, R = C_n^e·diag(σ²)·C_e^n, 旋转矩阵取INS位置处的值
+ * @param[in]   gnss_state      GNSS位置, NED系时使用其中的blh, ECEF系时使用xyz
+ * @param[in]   pos_std         GNSS位置NED三个方向的标准差(m)
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename T, int N, NavFrame Frame>
+void SinsLooseCoupledT<T, N, Frame>::Update(const StateInfo &gnss_state,
+                                     const std::vector<double> &pos_std)
+{
+    LC_PROFILE_SCOPE(kUpdate);
+    LC_PROFILE_COUNT(kGnssUpdate, 1);
+    DenormalGuard denormal_guard(std::is_same_v<T, float>);
+    PropagateCovariance();  // 先把协方差阵传播到当前历元
+    std::vector<T> z(3, 0.0);
+    std::vector<double> r_list(3, 0.0);
+    for(int i = 0; i < 3; ++i)
+        r_list[i] = pos_std[i]*pos_std[i];
+    if constexpr(Frame == NavFrame::kEcef)
+    {
+        // 观测向量, INS位置减GNSS位置, 在双精度下作差
+        const auto &xyz = sins_mechanization_.get_xyz();
+        for(int i = 0; i < 3; ++i)
+            z[i] = xyz[i] - gnss_state.xyz[i];
+        auto c_n_e = BaseMath::CalcCne(BaseMath::Xyz2Blh(xyz));
+        BaseMatrix r_e = c_n_e*BaseMatrix::Diag(r_list)*c_n_e.Trans();
+        if constexpr(std::is_same_v<T, double>)
+            r_k_ = std::move(r_e);
+        else
+            r_k_ = r_e.template Cast<T>();
+    }
+    else
+    {
+        auto state = sins_mechanization_.get_cur_state();
+        const double &b = state.blh[0], &h = state.blh[2];
+        const double &a = BaseSdc::wgs84.kA;
+        const double &e_2 = BaseSdc::wgs84.kESquare;
+        double rm = a*(1 - e_2)/sqrt(pow(1 - e_2*sin(b)*sin(b), 3));
+        double rn = a/sqrt(1 - e_2*sin(b)*sin(b));
+        
+        // 观测向量, INS位置减GNSS位置, 转换为NED方向上的距离, 在双精度下作差后再转换
+        z[0] = (state.blh[0] - gnss_state.blh[0])*(rm + h);
+        z[1] = (state.blh[1] - gnss_state.blh[1])*(rn + h)*cos(b);
+        z[2] = -(state.blh[2] - gnss_state.blh[2]);
+        r_k_ = BaseMatrixT<T>::Diag(std::vector<T>(r_list.begin(), r_list.end()));
+    }
+    z_k_ = BaseMatrixT<T>(z, 3, 1);
+    
+    h_k_ = BaseMatrixT<T>(3, kStateDim);
+    for(int i = 0; i < 3; ++i)
+        h_k_.write(i, Layout::kPos + i, 1.0);
+    
+    // K = P·Hᵀ·(H·P·Hᵀ + R)⁻¹
+    BaseMatrixT<T>::Gemm(1.0, p_k_, false, h_k_, true, 0.0, p_ht_);
+    s_k_ = r_k_;
+    BaseMatrixT<T>::Gemm(1.0, h_k_, false, p_ht_, false, 1.0, s_k_);
+    BaseMatrixT<T>::Gemm(1.0, p_ht_, false, s_k_.Inverse(), false, 0.0, K_k_);
+    BaseMatrixT<T>::Gemm(1.0, K_k_, false, z_k_, false, 0.0, x_k_);
+    
+    // Joseph形式, 保证对称正定: P = (I - K·H)·P·(I - K·H)ᵀ + K·R·Kᵀ
+    BaseMatrixT<T>::Gemm(-1.0, K_k_, false, h_k_, false, 0.0, i_kh_);
+    for(int i = 0; i < kStateDim; ++i)
+        i_kh_.write(i, i, i_kh_.read(i, i) + 1.0);
+    BaseMatrixT<T>::Symm(false, 1.0, p_k_, i_kh_, 0.0, i_kh_p_);
+    BaseMatrixT<T>::Gemm(1.0, i_kh_p_, false, i_kh_, true, 0.0, p_k_);
+    BaseMatrixT<T>::Gemm(1.0, K_k_, false, r_k_, false, 0.0, k_r_);
+    BaseMatrixT<T>::Gemm(1.0, k_r_, false, K_k_, true, 1.0, p_k_);
+    
+    Feedback();
+}
+
+/**@brief       反馈校正, 用误差状态修正机械编排结果和惯性器件误差, 然后将误差状态置零
+ * @details     姿态误差定义为C_b_n(计算) = (I - φ×)C_b_n(真), 所以q(真) = q(φ)⊗q(计算);
+ *              ECEF系时φ在e系下表示, 对q_b^e做同样的修正, 位置和速度直接减去e系下的误差
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename T, int N, NavFrame Frame>
+void SinsLooseCoupledT<T, N, Frame>::Feedback()
+{
+    using L = Layout;
+    std::vector<double> phi = {x_k_.read(L::kAtt, 0), x_k_.read(L::kAtt + 1, 0),
+                               x_k_.read(L::kAtt + 2, 0)};
+    if constexpr(Frame == NavFrame::kEcef)
+    {
+        auto xyz = sins_mechanization_.get_xyz();
+        auto v_ecef = sins_mechanization_.get_v_ecef();
+        for(int i = 0; i < 3; ++i)
+        {
+            xyz[i] -= x_k_.read(L::kPos + i, 0);
+            v_ecef[i] -= x_k_.read(L::kVel + i, 0);
+        }
+        auto q_b_e = BaseMath::QuaternionMul(BaseMath::RotationVec2Quaternion(phi),
+                                             sins_mechanization_.get_q_b_e());
+        BaseMath::QuaternionNormalize(q_b_e);
+        sins_mechanization_.set_ecef_state(xyz, v_ecef, q_b_e);
+    }
+    else
+    {
+        auto state = sins_mechanization_.get_cur_state();
+        const double &a = BaseSdc::wgs84.kA;
+        const double &e_2 = BaseSdc::wgs84.kESquare;
+        double b = state.blh[0], h = state.blh[2];
+        double rm = a*(1 - e_2)/sqrt(pow(1 - e_2*sin(b)*sin(b), 3));
+        double rn = a/sqrt(1 - e_2*sin(b)*sin(b));
+        
+        // 位置
+        state.blh[0] -= x_k_.read(L::kPos, 0)/(rm + h);
+        state.blh[1] -= x_k_.read(L::kPos + 1, 0)/((rn + h)*cos(b));
+        state.blh[2] += x_k_.read(L::kPos + 2, 0);
+        state.xyz = BaseMath::Blh2Xyz(state.blh);
+        // 速度
+        for(int i = 0; i < 3; ++i)
+            state.v_ned[i] -= x_k_.read(L::kVel + i, 0);
+        state.v_enu = BaseMath::Ned2Enu(state.v_ned);
+        // 姿态
+        state.q = BaseMath::QuaternionMul(BaseMath::RotationVec2Quaternion(phi),
+                                          state.q);
+        BaseMath::QuaternionNormalize(state.q);
+        state.c_b_n = BaseMath::Quaternion2RotationMat(state.q);
+        sins_mechanization_.set_cur_state(state);
+    }
+    // 惯性器件误差, 不估计的比例因子保持为零
+    for(int i = 0; i < 3; ++i)
+    {
+        gyro_bias_[i] += x_k_.read(L::kGyroBias + i, 0);
+        acc_bias_[i] += x_k_.read(L::kAccBias + i, 0);
+        if constexpr(L::kGyroScale >= 0)
+            gyro_scale_[i] += x_k_.read(L::kGyroScale + i, 0);
+        if constexpr(L::kAccScale >= 0)
+            acc_scale_[i] += x_k_.read(L::kAccScale + i, 0);
+    }
+    x_k_.setZero();
+}
+
+template<typename T, int N, NavFrame Frame>
+StateInfo SinsLooseCoupledT<T, N, Frame>::get_state() const
+{
+    return sins_mechanization_.get_cur_state();
+}
+
+template<typename T, int N, NavFrame Frame>
+double SinsLooseCoupledT<T, N, Frame>::get_t() const
+{
+    return sins_mechanization_.get_t();
+}
+
+template<typename T, int N, NavFrame Frame>
+BaseMatrix SinsLooseCoupledT<T, N, Frame>::get_p() const
+{
+    if constexpr(std::is_same_v<T, double>)
+        return p_k_;
+    else
+        return p_k_.template Cast<double>();
+}
+
+/**@brief       导航坐标系下的姿态矩阵
+ * @return      NED系时为C_b^n, ECEF系时为C_b^e
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename T, int N, NavFrame Frame>
+BaseMatrix SinsLooseCoupledT<T, N, Frame>::GetCbNav() const
+{
+    if constexpr(Frame == NavFrame::kEcef)
+        return sins_mechanization_.get_c_b_e();
+    else
+        return sins_mechanization_.get_cur_state().c_b_n;
 }
 
 /**@brief       F阵的计算
+ * @details     与比力、角速度和器件误差有关的子矩阵两种坐标系形式相同, 只是C_b^n换为C_b^e;
+ *              ECEF系时δṙ = δv, δv̇ = Γ·δr - 2ω_ie×δv + ..., φ̇ = -ω_ie×φ + ..., Γ为重力梯度
  * @param[in]   imu_data        惯性传感器读数
  * @return      F矩阵
  * @author      Zing Fong
  * @date        2022/6/18
  */
-BaseMatrix SinsLooseCoupled::CalcF(const ImuData &imu_data)
+template<typename T, int N, NavFrame Frame>
+BaseMatrix SinsLooseCoupledT<T, N, Frame>::CalcF(const ImuData &imu_data)
 {
-    BaseMatrix F(21, 21);  // 21×21维矩阵, 因为状态是21×1维
-    auto frr = CalcFrr();  // Frr阵, 3×3维
-    auto fvr = CalcFvr();  // Fvr阵, 3×3维
-    auto fphir = CalcFphir();  // Fφr阵, 3×3维
-    auto fvv = CalcFvv();  // Fvv阵, 3×3维
-    auto fphiv = CalcFphiv();  // Fφr阵, 3×3维
-    
-    const auto &c_b_n = sins_mechanization_.get_cur_state().c_b_n;
-    const auto &f_b = imu_data.acc;
+    LC_PROFILE_SCOPE(kCalcF);
+    using L = Layout;
+    BaseMatrix F(kStateDim, kStateDim);  // 维数与误差状态相同
+    
+    const auto c_b_n = GetCbNav();
+    auto f_b = imu_data.acc;  // f_b = acc / delta_t
     auto omega_ib_b = imu_data.gyro;  // omega_ib_b = gyro / delta_t
+    for(auto &a_f: f_b)
+        a_f /= sins_mechanization_.get_delta_t();
     for(auto &a_omega: omega_ib_b)
         a_omega /= sins_mechanization_.get_delta_t();
     
     BaseMatrix mat_fb(f_b, 3, 1);
-    const auto &omega_in_n = sins_mechanization_.get_omega_in_n();
     
-    // 向F矩阵中写入3×3矩阵的函数
-    auto WriteF = [&F](int row_begin, int col_begin, const BaseMatrix &sub_mat)
+    if constexpr(Frame == NavFrame::kEcef)
     {
-        for(int i = 0; i < 3; ++i)
-            for(int j = 0; j < 3; ++j)
-                F.write(row_begin + i, col_begin + j, sub_mat.read(i, j));
-    };
-    
-    // (0:2, 0:2) Frr
-    WriteF(0, 0, frr);
-    // (0:2, 3:5) I3×3
-    WriteF(0, 3, BaseMatrix::eye(3));
-    // (3:5, 0:2) Fvr
-    WriteF(3, 0, fvr);
-    // (3:5, 3:5) Fvv
-    WriteF(3, 3, fvv);
-    // (3:5, 6:8) (Cbn*fb)×, Cbn和fb相乘的反对称阵
-    auto product_cbn_fb = c_b_n*mat_fb;
-    auto antisymmetry_cbn_fb = BaseMatrix::CalcAntisymmetryMat(
-            product_cbn_fb.get_mat());
-    WriteF(3, 6, antisymmetry_cbn_fb);
-    
-    // (3:5, 12:14) Cbn
-    WriteF(3, 12, c_b_n);
-    // (3:5, 18:20) Cbn*diag(fb)
-    auto product_cbn_diagfb = c_b_n*BaseMatrix::Diag(f_b);
-    WriteF(3, 18, product_cbn_diagfb);
-    // (6:8, 0:2) Fφr
-    WriteF(6, 0, fphir);
-    // (6:8, 3:5) Fφv
-    WriteF(6, 3, fphiv);
-    // (6:8, 6:8) -(omega_in_n×)
-    auto neg_antisymmetry_omega =
-            BaseMatrix::CalcAntisymmetryMat(omega_in_n)*-1.0;
-    WriteF(6, 6, neg_antisymmetry_omega);
-    // (6:8, 9:11) -Cbn
-    WriteF(6, 9, c_b_n*-1.0);
-    // (6:8, 15:17) -Cbn*diag(omega_ib_b)
-    auto neg_product_cbn_diag_omega = c_b_n*BaseMatrix::Diag(omega_ib_b)*-1.0;
-    
-    // Tgb, Tab, Tgs, Tas 一阶高斯马尔科夫过程相关事件, 都设为3600s
-    double t_gb = 3600.0, t_ab = 3600.0, t_gs = 3600.0, t_as = 3600.0;
-    // (9:11, 9:11) (12:14, 12:14) (15:17, 15:17) (18:20, 18:20)
-    WriteF(9, 9, BaseMatrix::eye(3)*(-1.0/t_gb));
-    WriteF(12, 12, BaseMatrix::eye(3)*(-1.0/t_ab));
-    WriteF(15, 15, BaseMatrix::eye(3)*(-1.0/t_gs));
-    WriteF(18, 18, BaseMatrix::eye(3)*(-1.0/t_as));
+        const double &omega_e = BaseSdc::wgs84.kOmega;
+        const std::vector<double> omega_ie_e = {0.0, 0.0, omega_e};
+        F.block<3, 3>(L::kVel, L::kPos) = CalcFvrEcef(sins_mechanization_.get_xyz());
+        F.block<3, 3>(L::kVel, L::kVel) -= BaseMatrix::CalcAntisymmetryMat(omega_ie_e)*2.0;
+        F.block<3, 3>(L::kAtt, L::kAtt) -= BaseMatrix::CalcAntisymmetryMat(omega_ie_e);
+    }
+    else
+    {
+        // Frr, Fvr, Fvv, Fφr, Fφv, -(omega_in_n×)
+        F.block<3, 3>(L::kPos, L::kPos) = CalcFrr(sins_mechanization_);
+        F.block<3, 3>(L::kVel, L::kPos) = CalcFvr(sins_mechanization_);
+        F.block<3, 3>(L::kVel, L::kVel) = CalcFvv(sins_mechanization_);
+        F.block<3, 3>(L::kAtt, L::kPos) = CalcFphir(sins_mechanization_);
+        F.block<3, 3>(L::kAtt, L::kVel) = CalcFphiv(sins_mechanization_);
+        F.block<3, 3>(L::kAtt, L::kAtt) -= BaseMatrix::CalcAntisymmetryMat(sins_mechanization_.get_omega_in_n());
+    }
+    
+    // 位置误差
+    F.block<3, 3>(L::kPos, L::kVel).setIdentity();
+    // 速度误差: (Cbn*fb)×, Cbn, Cbn*diag(fb)
+    F.block<3, 3>(L::kVel, L::kAtt) = BaseMatrix::CalcAntisymmetryMat((c_b_n*mat_fb).get_mat());
+    F.block<3, 3>(L::kVel, L::kAccBias) = c_b_n;
+    if constexpr(L::kAccScale >= 0)
+        F.block<3, 3>(L::kVel, L::kAccScale) = c_b_n*BaseMatrix::Diag(f_b);
+    // 姿态误差: -Cbn, -Cbn*diag(omega_ib_b), F初始为零, 取负的子矩阵用-=写入
+    F.block<3, 3>(L::kAtt, L::kGyroBias) -= c_b_n;
+    if constexpr(L::kGyroScale >= 0)
+        F.block<3, 3>(L::kAtt, L::kGyroScale) -= c_b_n*BaseMatrix::Diag(omega_ib_b);
+    
+    // 零偏和比例因子都是一阶高斯马尔科夫过程, 相关时间取配置的corr_time_, 与过程噪声一致
+    for(int k = 0; k < L::kMarkovNum; ++k)
+    {
+        auto f_markov = F.block<3, 3>(L::kGyroBias + 3*k, L::kGyroBias + 3*k);
+        f_markov.setIdentity();
+        f_markov *= -1.0/corr_time_;
+    }
     
     return F;
 }
 
+/**@brief       e系下的重力梯度Γ = ∂g/∂r
+ * @details     引力取中心引力项-μ/r³·(I - 3r̂r̂ᵀ), 离心力为ω_ie²·diag(1, 1, 0), J2项的梯度小三个量级, 不计入
+ * @param[in]   xyz             ECEF坐标(m)
+ * @return      Γ, 3×3维
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename T, int N, NavFrame Frame>
+BaseMatrix SinsLooseCoupledT<T, N, Frame>::CalcFvrEcef(const std::vector<double> &xyz)
+{
+    BaseMatrix fvr(3, 3);
+    const double &gm = BaseSdc::wgs84.kGm;
+    const double &omega_e = BaseSdc::wgs84.kOmega;
+    double r2 = xyz[0]*xyz[0] + xyz[1]*xyz[1] + xyz[2]*xyz[2];
+    double mu_r3 = gm/(r2*sqrt(r2));
+    for(int i = 0; i < 3; ++i)
+        for(int j = 0; j < 3; ++j)
+            fvr.write(i, j, mu_r3*(3*xyz[i]*xyz[j]/r2 - (i == j ? 1.0 : 0.0)));
+    fvr.write(0, 0, fvr.read(0, 0) + omega_e*omega_e);
+    fvr.write(1, 1, fvr.read(1, 1) + omega_e*omega_e);
+    return fvr;
+}
+
 /**@brief       Frr阵的计算
+ * @param[in]   mech            NED系机械编排
  * @author      Zing Fong
  * @date        2022/6/16
  */
-BaseMatrix SinsLooseCoupled::CalcFrr()
+template<typename T, int N, NavFrame Frame>
+BaseMatrix SinsLooseCoupledT<T, N, Frame>::CalcFrr(const SinsMechanizationT<T> &mech)
 {
     BaseMatrix frr(3, 3);
     // 需要用到的量
-    auto state = sins_mechanization_.get_cur_state();
+    auto state = mech.get_cur_state();
     auto v_ned = state.v_ned;
     const double &vn = v_ned[0], &ve = v_ned[1], &vd = v_ned[2];
     auto blh = state.blh;
     const double &b = blh[0], &l = blh[1], &h = blh[2];
-    auto rm = sins_mechanization_.get_r_m();
-    auto rn = sins_mechanization_.get_r_n();
+    auto rm = mech.get_r_m();
+    auto rn = mech.get_r_n();
     const double &omega_e = BaseSdc::wgs84.kOmega;
     
     frr.write(0, 0, -vd/(rm + h));
@@ -140,22 +600,24 @@ BaseMatrix SinsLooseCoupled::CalcFrr()
 }
 
 /**@brief       Fvr阵的计算
+ * @param[in]   mech            NED系机械编排
  * @return      Fvr矩阵
  * @author      Zing Fong
  * @date        2022/6/16
  */
-BaseMatrix SinsLooseCoupled::CalcFvr()
+template<typename T, int N, NavFrame Frame>
+BaseMatrix SinsLooseCoupledT<T, N, Frame>::CalcFvr(const SinsMechanizationT<T> &mech)
 {
     BaseMatrix fvr(3, 3);
     // 需要用到的量
-    auto state = sins_mechanization_.get_cur_state();
+    auto state = mech.get_cur_state();
     auto v_ned = state.v_ned;
     const double &vn = v_ned[0], &ve = v_ned[1], &vd = v_ned[2];
     auto blh = state.blh;
     const double &b = blh[0], &l = blh[1], &h = blh[2];
-    auto rm = sins_mechanization_.get_r_m();
-    auto rn = sins_mechanization_.get_r_n();
-    auto g_n = sins_mechanization_.get_g_n();
+    auto rm = mech.get_r_m();
+    auto rn = mech.get_r_n();
+    auto g_n = mech.get_g_n();
     const double &gp = g_n[2];
     const double &omega_e = BaseSdc::wgs84.kOmega;
     
@@ -179,21 +641,23 @@ BaseMatrix SinsLooseCoupled::CalcFvr()
 }
 
 /**@brief       F阵的计算
+ * @param[in]   mech            NED系机械编排
  * @return      Fφv矩阵
  * @author      Zing Fong
  * @date        2022/6/16
  */
-BaseMatrix SinsLooseCoupled::CalcFphir()
+template<typename T, int N, NavFrame Frame>
+BaseMatrix SinsLooseCoupledT<T, N, Frame>::CalcFphir(const SinsMechanizationT<T> &mech)
 {
     BaseMatrix fphir(3, 3);
     // 需要用到的量
-    auto state = sins_mechanization_.get_cur_state();
+    auto state = mech.get_cur_state();
     auto v_ned = state.v_ned;
     const double &vn = v_ned[0], &ve = v_ned[1], &vd = v_ned[2];
     auto blh = state.blh;
     const double &b = blh[0], &l = blh[1], &h = blh[2];
-    auto rm = sins_mechanization_.get_r_m();
-    auto rn = sins_mechanization_.get_r_n();
+    auto rm = mech.get_r_m();
+    auto rn = mech.get_r_n();
     const double &omega_e = BaseSdc::wgs84.kOmega;
     
     // 写入矩阵
@@ -214,21 +678,23 @@ BaseMatrix SinsLooseCoupled::CalcFphir()
 }
 
 /**@brief       Fvv阵的计算
+ * @param[in]   mech            NED系机械编排
  * @return      Fvv矩阵
  * @author      Zing Fong
  * @date        2022/6/16
  */
-BaseMatrix SinsLooseCoupled::CalcFvv()
+template<typename T, int N, NavFrame Frame>
+BaseMatrix SinsLooseCoupledT<T, N, Frame>::CalcFvv(const SinsMechanizationT<T> &mech)
 {
     BaseMatrix fvv(3, 3);
     // 需要用到的量
-    auto state = sins_mechanization_.get_cur_state();
+    auto state = mech.get_cur_state();
     auto v_ned = state.v_ned;
     const double &vn = v_ned[0], &ve = v_ned[1], &vd = v_ned[2];
     auto blh = state.blh;
     const double &b = blh[0], &l = blh[1], &h = blh[2];
-    auto rm = sins_mechanization_.get_r_m();
-    auto rn = sins_mechanization_.get_r_n();
+    auto rm = mech.get_r_m();
+    auto rn = mech.get_r_n();
     const double &omega_e = BaseSdc::wgs84.kOmega;
     
     // 写矩阵
@@ -236,7 +702,7 @@ BaseMatrix SinsLooseCoupled::CalcFvv()
     fvv.write(0, 1, -2*(omega_e*sin(b) + ve*tan(b)/(rn + h)));
     fvv.write(0, 2, vn/(rm + h));
     
-    fvv.write(1, 0, 2*omega_e*sin(b) + ve*tan(b)*(rn + h));
+    fvv.write(1, 0, 2*omega_e*sin(b) + ve*tan(b)/(rn + h));
     fvv.write(1, 1, (vd + vn*tan(b))/(rn + h));
     fvv.write(1, 2, 2*omega_e*cos(b) + ve/(rn + h));
     
@@ -248,22 +714,24 @@ BaseMatrix SinsLooseCoupled::CalcFvv()
 }
 
 /**@brief       Fphiv阵的计算
+ * @param[in]   mech            NED系机械编排
  * @return      Fphiv矩阵
  * @author      Zing Fong
  * @date        2022/6/16
  */
-BaseMatrix SinsLooseCoupled::CalcFphiv()
+template<typename T, int N, NavFrame Frame>
+BaseMatrix SinsLooseCoupledT<T, N, Frame>::CalcFphiv(const SinsMechanizationT<T> &mech)
 {
     BaseMatrix fphiv(3, 3);
     
     // 需要用到的量
-    auto state = sins_mechanization_.get_cur_state();
+    auto state = mech.get_cur_state();
     auto v_ned = state.v_ned;
     const double &vn = v_ned[0], &ve = v_ned[1], &vd = v_ned[2];
     auto blh = state.blh;
     const double &b = blh[0], &l = blh[1], &h = blh[2];
-    auto rm = sins_mechanization_.get_r_m();
-    auto rn = sins_mechanization_.get_r_n();
+    auto rm = mech.get_r_m();
+    auto rn = mech.get_r_n();
     const double &omega_e = BaseSdc::wgs84.kOmega;
     
     // 写入矩阵
@@ -281,3 +749,16 @@ BaseMatrix SinsLooseCoupled::CalcFphiv()
     
     return fphiv;
 }
+
+template class SinsLooseCoupledT<double, 15>;
+template class SinsLooseCoupledT<double, 18>;
+template class SinsLooseCoupledT<double, 21>;
+template class SinsLooseCoupledT<float, 15>;
+template class SinsLooseCoupledT<float, 18>;
+template class SinsLooseCoupledT<float, 21>;
+template class SinsLooseCoupledT<double, 15, NavFrame::kEcef>;
+template class SinsLooseCoupledT<double, 18, NavFrame::kEcef>;
+template class SinsLooseCoupledT<double, 21, NavFrame::kEcef>;
+template class SinsLooseCoupledT<float, 15, NavFrame::kEcef>;
+template class SinsLooseCoupledT<float, 18, NavFrame::kEcef>;
+template class SinsLooseCoupledT<float, 21, NavFrame::kEcef>;
@@ -10,6 +10,13 @@
  * <table>
  * <tr><th>Date         <th>Version  <th>Author     <th>Description
  * <tr><td>2022/5/31    <td>1.0      <td>Zing Fong  <td>Initialize
+ * <tr><td>2026/10/18   <td>1.1      <td>Zing Fong  <td>增加了LooseCoupledParams
+ * <tr><td>2026/10/18   <td>1.2      <td>Zing Fong  <td>增加了预测和量测更新用的工作矩阵
+ * <tr><td>2026/10/18   <td>1.3      <td>Zing Fong  <td>改为协方差精度的模板SinsLooseCoupledT, 增加了混合精度的实例
+ * <tr><td>2026/10/18   <td>1.4      <td>Zing Fong  <td>增加了StateLayout, 状态维数可选15、18、21
+ * <tr><td>2026/10/18   <td>1.5      <td>Zing Fong  <td>协方差可以每隔多个IMU历元传播一次
+ * <tr><td>2026/10/18   <td>1.6      <td>Zing Fong  <td>过程噪声可以用Van Loan法离散化
+ * <tr><td>2026/10/18   <td>1.7      <td>Zing Fong  <td>可以选择在ECEF系下进行机械编排和误差状态建模
  * </table>
  **********************************************************************************
  */
@@ -20,6 +27,8 @@
 #include <iostream>
 
 // 其他库的 .h 文件
+#include <string>
+#include <type_traits>
 #include <vector>
 
 // 本项目内 .h 文件
@@ -29,44 +38,199 @@
 #include "../gnsstk/gnss_pos.h"
 #include "sins_file_stream.h"
 #include "sins_mechanization.h"
+#include "sins_mechanization_ecef.h"
+#include "sins_process_noise.h"
 
-// TODO: 完成松组合算法设计
-class SinsLooseCoupled
+/**@struct      LooseCoupledParams
+ * @brief       松组合滤波参数, 对应配置文件[LC]块, 单位与配置文件相同
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Author      <th>Description
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>Initialize
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>增加了协方差传播间隔
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>增加了过程噪声离散化方法
+ * </table>
+ */
+struct LooseCoupledParams
+{
+    double arw = 0.1;  // 角度随机游走(deg/√h)
+    double vrw = 0.1;  // 速度随机游走(m/s/√h)
+    double gyro_bias_std = 50.0;  // 陀螺零偏标准差(deg/h)
+    double acc_bias_std = 250.0;  // 加表零偏标准差(mGal)
+    double gyro_scale_std = 1000.0;  // 陀螺比例因子标准差(ppm)
+    double acc_scale_std = 1000.0;  // 加表比例因子标准差(ppm)
+    double corr_time = 1.0;  // 一阶高斯马尔科夫过程相关时间(h)
+    double init_pos_std = 1.0;  // 初始位置标准差(m)
+    double init_vel_std = 0.1;  // 初始速度标准差(m/s)
+    double init_att_std = 1.0;  // 初始姿态标准差(deg)
+    int cov_decimation = 1;  // 协方差传播间隔的最大IMU历元数, 1为每个历元传播
+    double cov_max_angle = 0.0;  // 一个传播间隔内允许的最大转角(deg), 超过时提前传播, 0为不限制
+    std::string qd_model = "first_order";  // 过程噪声离散化: first_order为Q·Δt, van_loan见SinsProcessNoise
+    
+    void Read(const Config &config);  // 从配置表读取, 缺省的参数保持默认值
+};
+
+/**@struct      StateLayout
+ * @brief       松组合误差状态的排列, N为状态维数
+ * @details     前15维依次为位置误差(m)、速度误差、姿态误差φ、陀螺零偏、加表零偏, 位置、速度和姿态误差在导航坐标系
+ *              (NED或ECEF)下表示;
+ *              18维增加陀螺比例因子, 21维再增加加表比例因子。不估计的比例因子没有对应的行列, 起始下标为-1
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Author      <th>Description
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>Initialize
+ * </table>
+ */
+template<int N>
+struct StateLayout
 {
+    static_assert(N == 15 || N == 18 || N == 21, "state dimension must be 15, 18 or 21");
+    static constexpr int kDim = N;  // 状态维数
+    static constexpr int kPos = 0;  // 位置误差
+    static constexpr int kVel = 3;  // 速度误差
+    static constexpr int kAtt = 6;  // 姿态误差
+    static constexpr int kGyroBias = 9;  // 陀螺零偏
+    static constexpr int kAccBias = 12;  // 加表零偏
+    static constexpr int kGyroScale = N >= 18 ? 15 : -1;  // 陀螺比例因子
+    static constexpr int kAccScale = N >= 21 ? 18 : -1;  // 加表比例因子
+    static constexpr int kMarkovNum = (N - kGyroBias)/3;  // 按一阶高斯马尔科夫过程建模的器件误差组数
+};
+
+/**@class   SinsLooseCoupledT
+ * @brief   GNSS/INS松组合卡尔曼滤波, T为协方差和姿态更新的计算精度, N为误差状态维数(15、18、21),
+ *          Frame为导航坐标系
+ * @details 状态排列见StateLayout。F阵、过程噪声和初始协方差只包含所选维数的状态, 没有空行空列;
+ *          不估计的比例因子保持为零。量测为GNSS位置, 每次量测更新后反馈校正并将误差状态置零。\n
+ *          机械编排每个IMU历元都进行, 协方差可以每隔多个历元传播一次: 间隔内累乘Φ = Π(I + F·Δt),
+ *          累加Qd, 间隔结束或量测更新前再计算P = Φ·P·Φᵀ + Qd。间隔在达到最大历元数或转角超过阈值时结束。\n
+ *          每个历元的Qd缺省取对角阵Q·Δt; qd_model为van_loan时由SinsProcessNoise按名义间隔缓存的精确解旋转得到,
+ *          包含位置、速度、姿态与零偏之间的互相关。\n
+ *          F阵、新息和反馈校正按双精度计算, Φ、P、K等滤波矩阵和机械编排的姿态更新按T计算,
+ *          位置始终为双精度。\n
+ *          Frame为kEcef时用SinsMechanizationEcefT, 位置、速度、姿态误差都在e系下表示: F阵中没有曲率半径和纬度的
+ *          三角函数, δv̇对δr只有重力梯度, 对δv只有-2ω_ie×, φ̇对φ只有-ω_ie×; 量测为INS与GNSS的XYZ之差,
+ *          GNSS的NED标准差旋转到e系。NED下的Frr等子矩阵只在Frame为kNed时计算。\n
+ *          T实例化了double和float, N实例化了15、18、21, Frame实例化了kNed和kEcef;
+ *          SinsLooseCoupled和SinsLooseCoupledMixed为NED系下21维的双精度和单精度滤波
+ * @par     修改日志:
+ * <table>
+ * <tr><th>Date         <th>Author      <th>Description
+ * <tr><td>2022/5/31    <td>Zing Fong   <td>Initialize
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>实现了一步预测、量测更新和反馈校正
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>增加了SetNoise, 用于运行中更新噪声参数
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>协方差传播和量测更新改为原地运算, 不再产生临时矩阵
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>滤波矩阵的元素类型改为模板参数
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>误差状态维数改为模板参数
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>增加了按间隔的协方差传播
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>过程噪声可以用Van Loan法离散化
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>导航坐标系改为模板参数, 增加了ECEF系的误差模型
+ * </table>
+ */
+template<typename T, int N = 21, NavFrame Frame = NavFrame::kNed>
+class SinsLooseCoupledT
+{
+    friend class Bench;  // 基准测试需要单独调用CalcF
+    friend class SinsTester;  // 测试器需要比较CalcF与过程噪声模型
+    
   public:
-//    void Alignment(const Config &config);  // 初始对准, 初始对准函数不应该在这里
+    using Layout = StateLayout<N>;
+    using Mechanization = std::conditional_t<Frame == NavFrame::kEcef, SinsMechanizationEcefT<T>,
+                                             SinsMechanizationT<T>>;  // 对应坐标系的机械编排
+    static constexpr int kStateDim = N;  // 误差状态维数
+    static constexpr NavFrame kFrame = Frame;  // 导航坐标系
     
+    void Init(const Config &config, const StateInfo &initial_state);  // 读取噪声参数, 设置初始状态和协方差
+    void SetNoise(const LooseCoupledParams &params);  // 设置IMU噪声参数, 不改变状态和协方差
+    void SetDecimation(const LooseCoupledParams &params);  // 设置协方差传播间隔, 先传播已累积的部分
     void Predict(const ImuData &imu_data);  // 一步预测(状态更新)
-    void Update(const ImuData &imu_data, const StateInfo &gnss_state);  // 测量更新(在有GPS输入的情况下)
+    void Update(const StateInfo &gnss_state,
+                const std::vector<double> &pos_std);  // 测量更新(在有GPS输入的情况下), ECEF系时使用gnss_state.xyz
+    
+    // get
+    StateInfo get_state() const;
+    double get_t() const;
+    BaseMatrix get_p() const;  // 最近一次传播或量测更新后的协方差阵
     
   private:
+    ImuData CompensateImu(const ImuData &imu_data) const;  // 零偏和比例因子补偿
+    void Feedback();  // 反馈校正
+    void PropagateCovariance();  // 用累积的Φ和Qd传播协方差阵
+    BaseMatrix GetCbNav() const;  // 导航坐标系下的姿态矩阵, C_b^n或C_b^e
     BaseMatrix CalcF(const ImuData &imu_data);  // 计算F矩阵
-    BaseMatrix CalcFrr();  // 计算Frr矩阵
-    BaseMatrix CalcFvr();  // 计算Fvr矩阵
-    BaseMatrix CalcFphir();  // 计算Fφr矩阵
-    BaseMatrix CalcFvv();  // 计算Fvv矩阵
-    BaseMatrix CalcFphiv();  // 计算Fφv矩阵
+    static BaseMatrix CalcFrr(const SinsMechanizationT<T> &mech);  // 计算Frr矩阵
+    static BaseMatrix CalcFvr(const SinsMechanizationT<T> &mech);  // 计算Fvr矩阵
+    static BaseMatrix CalcFphir(const SinsMechanizationT<T> &mech);  // 计算Fφr矩阵
+    static BaseMatrix CalcFvv(const SinsMechanizationT<T> &mech);  // 计算Fvv矩阵
+    static BaseMatrix CalcFphiv(const SinsMechanizationT<T> &mech);  // 计算Fφv矩阵
+    static BaseMatrix CalcFvrEcef(const std::vector<double> &xyz);  // 计算e系下的重力梯度
+    
+    Mechanization sins_mechanization_{};  // 机械编排对象, 包含位置、速度、姿态等信息, 量测更新后输出结果
     
-    SinsMechanization sins_mechanization_{};  // 机械编排对象, 包含位置、速度、姿态等信息, 量测更新后输出结果
+    // 惯性器件误差估值
+    std::vector<double> gyro_bias_ = std::vector<double>(3, 0.0);  // 陀螺零偏(rad/s)
+    std::vector<double> acc_bias_ = std::vector<double>(3, 0.0);  // 加表零偏(m/s²)
+    std::vector<double> gyro_scale_ = std::vector<double>(3, 0.0);  // 陀螺比例因子
+    std::vector<double> acc_scale_ = std::vector<double>(3, 0.0);  // 加表比例因子
     
-    BaseMatrix x_k_{};  // k时刻系统状态
-    BaseMatrix x_ksub1_{};  // k-1时刻系统状态
-    BaseMatrix q_k_{};  // 协因数阵
-    BaseMatrix p_k_{};  // 协方差阵
-    BaseMatrix q_ksub1_{};  // k-1时刻协因数阵
-    BaseMatrix p_ksub1_{};  // k-1时刻协方差阵
-    BaseMatrix tau_ksub1_{};  // k-1时刻系统噪声驱动阵
+    // 噪声参数, 均已转换为国际单位
+    double arw_{};  // 角度随机游走(rad/√s)
+    double vrw_{};  // 速度随机游走(m/s/√s)
+    double gyro_bias_std_{};  // 陀螺零偏标准差(rad/s)
+    double acc_bias_std_{};  // 加表零偏标准差(m/s²)
+    double gyro_scale_std_{};  // 陀螺比例因子标准差
+    double acc_scale_std_{};  // 加表比例因子标准差
+    double corr_time_ = 3600.0;  // 一阶高斯马尔科夫过程相关时间(s)
+    bool van_loan_{};  // 是否用Van Loan法离散化过程噪声
+    SinsProcessNoise<Layout> process_noise_{};  // Van Loan离散化的Qd缓存
     
-    BaseMatrix phi_k_ksub1_{};  // 离散形式状态转移矩阵
-    BaseMatrix x_k_ksub1_{};  // 一步预测状态
-    BaseMatrix p_k_ksub1_{};  // 一步预测协方差阵
+    // 协方差传播间隔
+    int cov_decimation_ = 1;  // 间隔的最大IMU历元数
+    double cov_max_angle_{};  // 间隔内允许的最大转角(rad), 0为不限制
+    int cov_epoch_num_{};  // 当前间隔已累积的历元数
+    double cov_angle_{};  // 当前间隔累积的转角(rad)
     
-    BaseMatrix h_k_{};  // 观测矩阵
-    BaseMatrix r_k_{};  // 量测噪声方差阵
-    BaseMatrix z_k_{};  // 观测向量
-    BaseMatrix K_k_{};  // 增益矩阵
+    BaseMatrixT<T> x_k_{};  // k时刻系统状态
+    BaseMatrixT<T> x_ksub1_{};  // k-1时刻系统状态
+    BaseMatrixT<T> q_k_{};  // 协因数阵, 传播间隔内累加
+    BaseMatrixT<T> p_k_{};  // 协方差阵
+    BaseMatrixT<T> q_ksub1_{};  // k-1时刻协因数阵
+    BaseMatrixT<T> p_ksub1_{};  // k-1时刻协方差阵
+    BaseMatrixT<T> tau_ksub1_{};  // k-1时刻系统噪声驱动阵
     
+    BaseMatrixT<T> phi_k_ksub1_{};  // 离散形式状态转移矩阵, 传播间隔内累乘
+    BaseMatrixT<T> x_k_ksub1_{};  // 一步预测状态
+    BaseMatrixT<T> p_k_ksub1_{};  // 一步预测协方差阵
+    
+    BaseMatrixT<T> h_k_{};  // 观测矩阵
+    BaseMatrixT<T> r_k_{};  // 量测噪声方差阵
+    BaseMatrixT<T> z_k_{};  // 观测向量
+    BaseMatrixT<T> K_k_{};  // 增益矩阵
+    
+    // 工作矩阵, 各历元重复使用, 容量在第一次运算时确定
+    BaseMatrixT<T> f_k_{};  // 当前历元的F阵, 仅单精度时用于类型转换
+    BaseMatrixT<T> f_phi_{};  // F·Φ, 累乘Φ时使用
+    BaseMatrixT<T> phi_p_{};  // Φ·P
+    BaseMatrixT<T> p_ht_{};  // P·Hᵀ
+    BaseMatrixT<T> s_k_{};  // 新息协方差阵H·P·Hᵀ + R
+    BaseMatrixT<T> i_kh_{};  // I - K·H
+    BaseMatrixT<T> i_kh_p_{};  // (I - K·H)·P
+    BaseMatrixT<T> k_r_{};  // K·R
 };
 
+using SinsLooseCoupled = SinsLooseCoupledT<double>;
+using SinsLooseCoupledMixed = SinsLooseCoupledT<float>;  // 协方差和姿态更新用单精度
+extern template class SinsLooseCoupledT<double, 15>;
+extern template class SinsLooseCoupledT<double, 18>;
+extern template class SinsLooseCoupledT<double, 21>;
+extern template class SinsLooseCoupledT<float, 15>;
+extern template class SinsLooseCoupledT<float, 18>;
+extern template class SinsLooseCoupledT<float, 21>;
+extern template class SinsLooseCoupledT<double, 15, NavFrame::kEcef>;
+extern template class SinsLooseCoupledT<double, 18, NavFrame::kEcef>;
+extern template class SinsLooseCoupledT<double, 21, NavFrame::kEcef>;
+extern template class SinsLooseCoupledT<float, 15, NavFrame::kEcef>;
+extern template class SinsLooseCoupledT<float, 18, NavFrame::kEcef>;
+extern template class SinsLooseCoupledT<float, 21, NavFrame::kEcef>;
+
 
 #endif //LOOSECOUPLED_SRC_SINSTK_SINS_LOOSE_COUPLED_H
@@ -10,6 +10,9 @@
  * <table>
  * <tr><th>Date         <th>Version  <th>Author     <th>Description
  * <tr><td>2022/5/31    <td>1.0      <td>Zing Fong  <td>Initialize
+ * <tr><td>2026/10/18   <td>1.1      <td>Zing Fong  <td>修正了首历元状态被清零、高程更新越界以及经度更新的错误
+ * <tr><td>2026/10/18   <td>1.2      <td>Zing Fong  <td>增加了机械编排各步骤的耗时统计
+ * <tr><td>2026/10/18   <td>1.3      <td>Zing Fong  <td>改为模板实现, 姿态更新可以用单精度
  * </table>
  **********************************************************************************
  */
@@ -21,15 +24,19 @@
 // 其他库的 .h 文件
 #include <vector>
 #include <cmath>
+#include <type_traits>
+#include <utility>
 
 // 本项目内 .h 文件
+#include "../basetk/base_profiler.h"
 
 /**@brief       状态初始化
  * @param[in]   initial_state          载体的初始状态量
  * @author      Zing Fong
  * @date        2022/6/10
  */
-void SinsMechanization::Init(const StateInfo &initial_state)
+template<typename AttT>
+void SinsMechanizationT<AttT>::Init(const StateInfo &initial_state)
 {
     cur_state_ = initial_state;  // 初始状态
     ksub1_state_ = initial_state;
@@ -45,7 +52,8 @@ void SinsMechanization::Init(const StateInfo &initial_state)
  * @author      Zing Fong
  * @date        2022/6/11
  */
-int SinsMechanization::PrepareUpdate(const ImuData &imu_data)
+template<typename AttT>
+int SinsMechanizationT<AttT>::PrepareUpdate(const ImuData &imu_data)
 {
     ++cur_epoch_;  // 历元数+1
     // 上一历元数据前移
@@ -67,19 +75,20 @@ int SinsMechanization::PrepareUpdate(const ImuData &imu_data)
     
     omega_en_n_ksub2_ = omega_en_n_ksub1_;
     omega_en_n_ksub1_ = omega_en_n_;
-    omega_en_n_ = {};
+    omega_en_n_ = std::vector<double>(3, 0.0);
     omega_ie_n_ksub2_ = omega_ie_n_ksub1_;
     omega_ie_n_ksub1_ = omega_ie_n_;
-    omega_ie_n_ = {};
+    omega_ie_n_ = std::vector<double>(3, 0.0);
     
     // 引用参数
     const double &a = BaseSdc::wgs84.kA;
     const double &e_2 = BaseSdc::wgs84.kESquare;
     const double &omega_e = BaseSdc::wgs84.kOmega;
-    const double &phi = cur_state_.blh[0];  // 纬度
-    const double &h = cur_state_.blh[2];  // 高程
-    const double &v_e = cur_state_.v_ned[1];  // 东向速度  2022/6/14更改为NED
-    const double &v_n = cur_state_.v_ned[0];  // 北向速度
+    // 当前历元状态尚未更新, 用上一历元的位置速度计算
+    const double &phi = ksub1_state_.blh[0];  // 纬度
+    const double &h = ksub1_state_.blh[2];  // 高程
+    const double &v_e = ksub1_state_.v_ned[1];  // 东向速度  2022/6/14更改为NED
+    const double &v_n = ksub1_state_.v_ned[0];  // 北向速度
     
     // 求子午圈半径和卯酉圈半径, 以及两个不知道啥名的omega, 一个可能是地球自转角速度
     r_m_ = a*(1 - e_2)/
@@ -94,7 +103,7 @@ int SinsMechanization::PrepareUpdate(const ImuData &imu_data)
     omega_en_n_[1] = -v_n/(r_m_ + h);
     omega_en_n_[2] = -v_e*tan(phi)/(r_n_ + h);
     
-    g_n_ = BaseMath::CalcGn(cur_state_.blh);  // 计算e系下的重力加速度
+    g_n_ = BaseMath::CalcGn(ksub1_state_.blh);  // 计算n系下的重力加速度
     
     // 时间
     cur_state_.time = t_ = imu_data.t;
@@ -102,7 +111,9 @@ int SinsMechanization::PrepareUpdate(const ImuData &imu_data)
     
     if(cur_epoch_ == 1)
     {
-        // 说明是第一个历元, 前两个历元数据与当前历元统一
+        // 说明是第一个历元, 当前历元即为初始状态, 前两个历元数据与当前历元统一
+        cur_state_ = ksub1_state_;
+        cur_state_.time = t_;
         ksub2_state_ = ksub1_state_ = cur_state_;
         ksub1_imu_data_ = cur_imu_data_;
         r_m_ksub1_ = r_m_;
@@ -120,21 +131,27 @@ int SinsMechanization::PrepareUpdate(const ImuData &imu_data)
 /**@brief       姿态更新
  * @details
  * - 已知: 上一历元姿态、上一历元和当前历元陀螺输出角增量\n
- * - 待求: 当前历元姿态
+ * - 待求: 当前历元姿态\n
+ * 陀螺增量、上一历元四元数和n系旋转矢量先转换为AttT, 四元数递推按AttT计算
  * @author      Zing Fong
  * @date        2022/6/11
  */
-void SinsMechanization::AttitudeUpdate()
+template<typename AttT>
+void SinsMechanizationT<AttT>::AttitudeUpdate()
 {
+    LC_PROFILE_SCOPE(kAttitudeUpdate);
+    using Vec = std::vector<AttT>;
     // 求b系变化的等效旋转矢量
-    auto delta_theta_k = cur_imu_data_.gyro;  // 当前历元陀螺输出
-    auto delta_theta_ksub1 = ksub1_imu_data_.gyro;  // 上一历元陀螺输出
-    auto cross_product = BaseMatrix::CrossProduct(
+    Vec delta_theta_k(cur_imu_data_.gyro.begin(),
+                      cur_imu_data_.gyro.end());  // 当前历元陀螺输出
+    Vec delta_theta_ksub1(ksub1_imu_data_.gyro.begin(),
+                          ksub1_imu_data_.gyro.end());  // 上一历元陀螺输出
+    auto cross_product = BaseMatrixT<AttT>::CrossProduct(
             delta_theta_ksub1, delta_theta_k);  // 陀螺读数的外积
     for(auto &a_product: cross_product)
         a_product *= 1.0/12;  // 乘系数
-    auto phi_k = BaseMatrix::VectorAdd(delta_theta_k,
-                                       cross_product);  // b系变化的等效旋转矢量
+    auto phi_k = BaseMatrixT<AttT>::VectorAdd(delta_theta_k,
+                                              cross_product);  // b系变化的等效旋转矢量
 //    double norm_phi_k = BaseMath::Norm(phi_k);  // φk的模
 //    double f1 = sin(0.5*norm_phi_k)/norm_phi_k;  // 系数
     
@@ -146,7 +163,7 @@ void SinsMechanization::AttitudeUpdate()
 //    q_bk_bksub1[2] = f1*phi_k[1];
 //    q_bk_bksub1[3] = f1*phi_k[2];
     
-    // 求n系变化对应的等效旋转矢量
+    // 求n系变化对应的等效旋转矢量, 角速度在双精度下乘时间间隔
     auto zeta_k = BaseMatrix::VectorAdd(omega_ie_n_, omega_en_n_);
     for(auto &a_zeta_k: zeta_k)
         a_zeta_k *= delta_t_;  // 乘时间间隔
@@ -154,7 +171,8 @@ void SinsMechanization::AttitudeUpdate()
 //    double f2 = -sin(0.5*norm_zeta_k)/norm_zeta_k;  // 系数
     
     //求n系姿态变化四元数
-    auto q_nksub1_nk = BaseMath::RotationVec2Quaternion(zeta_k);
+    auto q_nksub1_nk = BaseMath::RotationVec2Quaternion(Vec(zeta_k.begin(),
+                                                            zeta_k.end()));
     q_nksub1_nk[1] *= -1;  // 这里是负的, 也不知道为啥
     q_nksub1_nk[2] *= -1;
     q_nksub1_nk[3] *= -1;
@@ -166,10 +184,21 @@ void SinsMechanization::AttitudeUpdate()
     
     // 姿态更新的递推
     auto tmp = BaseMath::QuaternionMul(q_nksub1_nk,
-                                       ksub1_state_.q);
-    cur_state_.q = BaseMath::QuaternionMul(tmp, q_bk_bksub1);
-    cur_state_.c_b_n = BaseMath::Quaternion2RotationMat(
-            cur_state_.q);  // 方向余弦矩阵
+                                       Vec(ksub1_state_.q.begin(),
+                                           ksub1_state_.q.end()));
+    auto q_k = BaseMath::QuaternionMul(tmp, q_bk_bksub1);
+    // 结果存回双精度的状态
+    if constexpr(std::is_same_v<AttT, double>)
+    {
+        cur_state_.c_b_n = BaseMath::Quaternion2RotationMat(q_k);  // 方向余弦矩阵
+        cur_state_.q = std::move(q_k);
+    }
+    else
+    {
+        cur_state_.c_b_n = BaseMath::Quaternion2RotationMat(q_k)
+                .template Cast<double>();  // 方向余弦矩阵
+        cur_state_.q.assign(q_k.begin(), q_k.end());
+    }
 }
 
 /**@brief       速度更新
@@ -179,8 +208,10 @@ void SinsMechanization::AttitudeUpdate()
  * @author      Zing Fong
  * @date        2022/6/14
  */
-void SinsMechanization::VelocityUpdate()
+template<typename AttT>
+void SinsMechanizationT<AttT>::VelocityUpdate()
 {
+    LC_PROFILE_SCOPE(kVelocityUpdate);
     // 对omega_ie_n_和omega_en_e_作线性外推
     auto omega_ie_n_mid = LinearExtrapolation(omega_ie_n_ksub1_,
                                               omega_ie_n_ksub2_);
@@ -240,11 +271,13 @@ void SinsMechanization::VelocityUpdate()
  * @author      Zing Fong
  * @date        2022/6/14
  */
-void SinsMechanization::PositionUpdate()
+template<typename AttT>
+void SinsMechanizationT<AttT>::PositionUpdate()
 {
+    LC_PROFILE_SCOPE(kPositionUpdate);
     // 高程更新
     cur_state_.blh[2] = ksub1_state_.blh[2]
-                        - 0.5*(ksub1_state_.v_ned[3] + cur_state_.v_ned[3])*
+                        - 0.5*(ksub1_state_.v_ned[2] + cur_state_.v_ned[2])*
                           delta_t_;
     // 纬度更新
     double h_bar = 0.5*(cur_state_.blh[2] + ksub1_state_.blh[2]);  // 积分周期内平均高程
@@ -255,7 +288,7 @@ void SinsMechanization::PositionUpdate()
     double r_n_mid = 0.5*(r_n_ + r_n_ksub1_);  // 中间时刻Rn
     double phi_bar = 0.5*(cur_state_.blh[0] + ksub1_state_.blh[0]);  // 中间时刻纬度
     cur_state_.blh[1] = ksub1_state_.blh[1] +
-                        (cur_state_.v_ned[1] + cur_state_.v_ned[1])/
+                        (cur_state_.v_ned[1] + ksub1_state_.v_ned[1])/
                         (2*(r_n_mid + h_bar)*cos(phi_bar))*delta_t_;
     
     // 更新xyz
@@ -269,7 +302,8 @@ void SinsMechanization::PositionUpdate()
  * @author      Zing Fong
  * @date        2022/6/13
  */
-std::vector<double> SinsMechanization::LinearExtrapolation(
+template<typename AttT>
+std::vector<double> SinsMechanizationT<AttT>::LinearExtrapolation(
         std::vector<double> &ksub1, std::vector<double> &ksub2)
 {
     auto tmp = BaseMatrix::VectorSub(ksub1, ksub2);
@@ -286,8 +320,10 @@ std::vector<double> SinsMechanization::LinearExtrapolation(
  * @author      Zing Fong
  * @date        2022/6/14
  */
-int SinsMechanization::ImuMechanization(const ImuData &imu_data)
+template<typename AttT>
+int SinsMechanizationT<AttT>::ImuMechanization(const ImuData &imu_data)
 {
+    LC_PROFILE_SCOPE(kMechanization);
     if(PrepareUpdate(imu_data) != 0)
         return 0;  // 第一个历元, 不进行机械编排
     AttitudeUpdate();  // 姿态更新
@@ -297,47 +333,70 @@ int SinsMechanization::ImuMechanization(const ImuData &imu_data)
     return 0;
 }
 
-double SinsMechanization::get_t() const
+/**@brief       设置当前历元状态, 用于组合导航反馈校正
+ * @param[in]   state          校正后的状态
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename AttT>
+void SinsMechanizationT<AttT>::set_cur_state(const StateInfo &state)
+{
+    cur_state_ = state;
+}
+
+template<typename AttT>
+double SinsMechanizationT<AttT>::get_t() const
 {
     return t_;
 }
 
-double SinsMechanization::get_delta_t() const
+template<typename AttT>
+double SinsMechanizationT<AttT>::get_delta_t() const
 {
     return delta_t_;
 }
 
-StateInfo SinsMechanization::get_cur_state() const
+template<typename AttT>
+StateInfo SinsMechanizationT<AttT>::get_cur_state() const
 {
     return cur_state_;
 }
 
-double SinsMechanization::get_r_m() const
+template<typename AttT>
+double SinsMechanizationT<AttT>::get_r_m() const
 {
     return r_m_;
 }
 
-double SinsMechanization::get_r_n() const
+template<typename AttT>
+double SinsMechanizationT<AttT>::get_r_n() const
 {
     return r_n_;
 }
 
-std::vector<double> SinsMechanization::get_g_n() const
+template<typename AttT>
+std::vector<double> SinsMechanizationT<AttT>::get_g_n() const
 {
     return g_n_;
 }
 
-std::vector<double> SinsMechanization::get_omega_ie_n() const
+template<typename AttT>
+std::vector<double> SinsMechanizationT<AttT>::get_omega_ie_n() const
 {
     return omega_ie_n_;
 }
 
-std::vector<double> SinsMechanization::get_omega_en_n() const
+template<typename AttT>
+std::vector<double> SinsMechanizationT<AttT>::get_omega_en_n() const
 {
     return omega_en_n_;
 }
 
-std::vector<double> SinsMechanization::get_omega_in_n() const
+template<typename AttT>
+std::vector<double> SinsMechanizationT<AttT>::get_omega_in_n() const
 {
     return BaseMatrix::VectorAdd(omega_ie_n_, omega_en_n_);
 }
+
+template class SinsMechanizationT<double>;
+template class SinsMechanizationT<float>;
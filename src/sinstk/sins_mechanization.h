@@ -10,6 +10,8 @@
  * <table>
  * <tr><th>Date         <th>Version  <th>Author     <th>Description
  * <tr><td>2022/5/31    <td>1.0      <td>Zing Fong  <td>Initialize
+ * <tr><td>2026/10/18   <td>1.1      <td>Zing Fong  <td>改为姿态计算精度的模板SinsMechanizationT
+ * <tr><td>2026/10/18   <td>1.2      <td>Zing Fong  <td>增加了NavFrame
  * </table>
  **********************************************************************************
  */
@@ -28,6 +30,15 @@
 #include "../basetk/base_app.h"
 #include "sins_file_stream.h"
 
+/**@enum        NavFrame
+ * @brief       机械编排和误差状态所在的坐标系
+ */
+enum class NavFrame
+{
+    kNed,  // 当地水平坐标系(北东地), 位置按BLH积分, 见SinsMechanizationT
+    kEcef,  // 地心地固坐标系, 位置按XYZ积分, 见SinsMechanizationEcefT
+};
+
 /**@struct      StateInfo
  * @brief       载体位姿状态信息, 包括三轴位置、速度、姿态
  * @par 修改日志:
@@ -49,19 +60,23 @@ struct StateInfo
     std::vector<double> blh = std::vector<double>(3, 0.0);  // 大地坐标
 };
 
-/**@class   SinsMechanization
- * @brief   惯导机械编排类
+/**@class   SinsMechanizationT
+ * @brief   惯导机械编排类, AttT为姿态更新的计算精度
+ * @details 只有姿态更新按AttT计算, 速度、位置和StateInfo始终为双精度。
+ *          AttT为float时四元数递推用单精度, 结果存回StateInfo; 只实例化了double(SinsMechanization)和float两种
  * @par     修改日志:
  * <table>
  * <tr><th>Date         <th>Author      <th>Description
  * <tr><td>2022/5/31    <td>Zing Fong   <td>Initialize
  * <tr><td>2022/6/12    <td>Zing Fong   <td>修改了位姿更新函数的传入参数
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>姿态更新的计算精度改为模板参数
  * </table>
  */
-class SinsMechanization
+template<typename AttT>
+class SinsMechanizationT
 {
   public:
-    SinsMechanization() = default;  // 默认构造函数
+    SinsMechanizationT() = default;  // 默认构造函数
     
     void Init(const StateInfo &initial_state);  // 状态初始化
     int ImuMechanization(const ImuData &imu_data);  // 进行一次机械编排
@@ -76,6 +91,9 @@ class SinsMechanization
     std::vector<double> get_omega_ie_n() const;
     std::vector<double> get_omega_en_n() const;
     std::vector<double> get_omega_in_n() const;
+    
+    // set
+    void set_cur_state(const StateInfo &state);
   
   private:
     int PrepareUpdate(const ImuData &imu_data);  // 更新前准备, 将惯性传感器数据存储起来
@@ -119,5 +137,9 @@ class SinsMechanization
     ImuData ksub1_imu_data_{};  // k-1时刻传感器数据
 };
 
+using SinsMechanization = SinsMechanizationT<double>;
+extern template class SinsMechanizationT<double>;
+extern template class SinsMechanizationT<float>;
+
 
 #endif //LOOSECOUPLED_SRC_SINSTK_SINS_MECHANIZATION_H
@@ -0,0 +1,284 @@
+/**@file    sins_mechanization_ecef.cc
+ * @brief   ECEF系惯导机械编排
+ * @details 实现了e系下的姿态、速度、位置更新, 以及与n系描述的状态之间的转换
+ * @author  Zing Fong\n
+ *          zing.fong.whu\@outlook.com
+ * @date    2026/10/18
+ * @version V1.0
+ **********************************************************************************
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Version  <th>Author     <th>Description
+ * <tr><td>2026/10/18   <td>1.0      <td>Zing Fong  <td>Initialize
+ * </table>
+ **********************************************************************************
+ */
+
+// 本类对应的.h文件
+#include "sins_mechanization_ecef.h"
+// c/c++系统文件
+
+// 其他库的 .h 文件
+#include <cmath>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// 本项目内 .h 文件
+#include "../basetk/base_profiler.h"
+
+/**@brief       状态初始化
+ * @param[in]   initial_state   载体的初始状态量, 使用其中的BLH、NED速度和C_b^n
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename AttT>
+void SinsMechanizationEcefT<AttT>::Init(const StateInfo &initial_state)
+{
+    set_cur_state(initial_state);
+    t_ = initial_state.time;
+    cur_epoch_ = 0;
+    delta_t_ = 0;
+}
+
+/**@brief       机械编排准备
+ * @param[in]   imu_data        当前历元imu读数
+ * @return      返回结果\n
+ * -  0         说明不是第一个历元, 可以进行机械编排
+ * -  -114514   说明是第一个历元, 不进行机械编排
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename AttT>
+int SinsMechanizationEcefT<AttT>::PrepareUpdate(const ImuData &imu_data)
+{
+    ++cur_epoch_;
+    // 上一历元数据前移
+    v_ecef_ksub2_ = v_ecef_ksub1_;
+    v_ecef_ksub1_ = v_ecef_;
+    xyz_ksub1_ = xyz_;
+    q_b_e_ksub1_ = q_b_e_;
+    c_b_e_ksub1_ = c_b_e_;
+    ksub1_imu_data_ = cur_imu_data_;
+    cur_imu_data_ = imu_data;
+    
+    delta_t_ = imu_data.t - t_;
+    t_ = imu_data.t;
+    if(cur_epoch_ == 1)
+    {
+        // 第一个历元, 当前历元即为初始状态, 前两个历元数据与当前历元统一
+        v_ecef_ksub2_ = v_ecef_ksub1_;
+        ksub1_imu_data_ = cur_imu_data_;
+        delta_t_ = 0;
+        return -114514;
+    }
+    return 0;
+}
+
+/**@brief       姿态更新
+ * @details     q_b^e(k) = q_e(k-1)^e(k) ⊗ q_b^e(k-1) ⊗ q_b(k)^b(k-1), e系的转动只有地球自转,
+ *              转轴固定为z轴, 所以直接写出其四元数。陀螺增量和四元数递推按AttT计算
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename AttT>
+void SinsMechanizationEcefT<AttT>::AttitudeUpdate()
+{
+    LC_PROFILE_SCOPE(kAttitudeUpdate);
+    using Vec = std::vector<AttT>;
+    // b系变化的等效旋转矢量, 双子样圆锥补偿
+    Vec delta_theta_k(cur_imu_data_.gyro.begin(), cur_imu_data_.gyro.end());
+    Vec delta_theta_ksub1(ksub1_imu_data_.gyro.begin(), ksub1_imu_data_.gyro.end());
+    auto cross_product = BaseMatrixT<AttT>::CrossProduct(delta_theta_ksub1, delta_theta_k);
+    for(auto &a_product: cross_product)
+        a_product *= 1.0/12;
+    auto phi_k = BaseMatrixT<AttT>::VectorAdd(delta_theta_k, cross_product);
+    auto q_bk_bksub1 = BaseMath::RotationVec2Quaternion(phi_k);
+    
+    // e系在间隔内绕z轴转过ω_ie·Δt, 角度在双精度下计算
+    double half_zeta = 0.5*BaseSdc::wgs84.kOmega*delta_t_;
+    Vec q_eksub1_ek = {static_cast<AttT>(cos(half_zeta)), 0, 0, static_cast<AttT>(-sin(half_zeta))};
+    
+    auto tmp = BaseMath::QuaternionMul(q_eksub1_ek, Vec(q_b_e_ksub1_.begin(), q_b_e_ksub1_.end()));
+    auto q_k = BaseMath::QuaternionMul(tmp, q_bk_bksub1);
+    // 结果存回双精度的状态
+    if constexpr(std::is_same_v<AttT, double>)
+    {
+        c_b_e_ = BaseMath::Quaternion2RotationMat(q_k);
+        q_b_e_ = std::move(q_k);
+    }
+    else
+    {
+        c_b_e_ = BaseMath::Quaternion2RotationMat(q_k).template Cast<double>();
+        q_b_e_.assign(q_k.begin(), q_k.end());
+    }
+}
+
+/**@brief       速度更新
+ * @details     v(k) = v(k-1) + (I - ζ×/2)·C_b^e(k-1)·(Δv + Δθ×Δv/2) + (g - 2ω_ie×v)·Δt,
+ *              重力和哥氏项取中间时刻, 中间时刻速度由前两个历元线性外推, 位置由外推速度前推半个间隔
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename AttT>
+void SinsMechanizationEcefT<AttT>::VelocityUpdate()
+{
+    LC_PROFILE_SCOPE(kVelocityUpdate);
+    const double &omega_e = BaseSdc::wgs84.kOmega;
+    std::vector<double> v_mid(3, 0.0), xyz_mid(3, 0.0);
+    for(int i = 0; i < 3; ++i)
+    {
+        v_mid[i] = 1.5*v_ecef_ksub1_[i] - 0.5*v_ecef_ksub2_[i];
+        xyz_mid[i] = xyz_ksub1_[i] + 0.5*v_mid[i]*delta_t_;
+    }
+    g_e_ = BaseMath::CalcGeXyz(xyz_mid);
+    
+    // 单子样假设计算b(k-1)系下的比力增量, 转到e(k-1)系
+    const auto &gyro = cur_imu_data_.gyro;
+    const auto &acc = cur_imu_data_.acc;
+    auto cross_product_theta_v = BaseMatrix::CrossProduct(gyro, acc);
+    double delta_v_b[3], delta_v_e[3];
+    for(int i = 0; i < 3; ++i)
+        delta_v_b[i] = acc[i] + 0.5*cross_product_theta_v[i];
+    for(int i = 0; i < 3; ++i)
+        delta_v_e[i] = c_b_e_ksub1_.read(i, 0)*delta_v_b[0] + c_b_e_ksub1_.read(i, 1)*delta_v_b[1] +
+                       c_b_e_ksub1_.read(i, 2)*delta_v_b[2];
+    // e(k-1)系转到e(k-1/2)系, ζ = (0, 0, ω_ie·Δt)
+    double zeta = omega_e*delta_t_;
+    double delta_v_f[3] = {delta_v_e[0] + 0.5*zeta*delta_v_e[1],
+                           delta_v_e[1] - 0.5*zeta*delta_v_e[0],
+                           delta_v_e[2]};
+    // 哥氏项-2ω_ie×v
+    double coriolis[3] = {2*omega_e*v_mid[1], -2*omega_e*v_mid[0], 0.0};
+    for(int i = 0; i < 3; ++i)
+        v_ecef_[i] = v_ecef_ksub1_[i] + delta_v_f[i] + (g_e_[i] + coriolis[i])*delta_t_;
+}
+
+/**@brief       位置更新, XYZ按梯形积分
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename AttT>
+void SinsMechanizationEcefT<AttT>::PositionUpdate()
+{
+    LC_PROFILE_SCOPE(kPositionUpdate);
+    for(int i = 0; i < 3; ++i)
+        xyz_[i] = xyz_ksub1_[i] + 0.5*(v_ecef_ksub1_[i] + v_ecef_[i])*delta_t_;
+}
+
+/**@brief       一个历元的惯导机械编排
+ * @param[in]   imu_data        当前历元imu读数
+ * @return      0为正常
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename AttT>
+int SinsMechanizationEcefT<AttT>::ImuMechanization(const ImuData &imu_data)
+{
+    LC_PROFILE_SCOPE(kMechanization);
+    if(PrepareUpdate(imu_data) != 0)
+        return 0;  // 第一个历元, 不进行机械编排
+    AttitudeUpdate();
+    VelocityUpdate();
+    PositionUpdate();
+    return 0;
+}
+
+/**@brief       转换为n系描述的当前状态, 需要由XYZ求BLH, 只在输出和量测更新时调用
+ * @return      当前状态, BLH、NED/ENU速度、C_b^n和q_b^n由e系状态转换得到
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename AttT>
+StateInfo SinsMechanizationEcefT<AttT>::get_cur_state() const
+{
+    StateInfo state{};
+    state.time = t_;
+    state.xyz = xyz_;
+    state.v_ecef = v_ecef_;
+    state.blh = BaseMath::Xyz2Blh(xyz_);
+    auto c_e_n = BaseMath::CalcCne(state.blh).Trans();
+    state.v_ned = (c_e_n*BaseMatrix(v_ecef_, 3, 1)).get_mat();
+    state.v_enu = BaseMath::Ned2Enu(state.v_ned);
+    state.c_b_n = c_e_n*c_b_e_;
+    state.q = BaseMath::RotationMat2Quaternion(state.c_b_n);
+    return state;
+}
+
+/**@brief       由n系描述的状态设置e系状态
+ * @param[in]   state           使用其中的BLH、NED速度和C_b^n
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename AttT>
+void SinsMechanizationEcefT<AttT>::set_cur_state(const StateInfo &state)
+{
+    auto c_n_e = BaseMath::CalcCne(state.blh);
+    xyz_ = BaseMath::Blh2Xyz(state.blh);
+    v_ecef_ = (c_n_e*BaseMatrix(state.v_ned, 3, 1)).get_mat();
+    c_b_e_ = c_n_e*state.c_b_n;
+    q_b_e_ = BaseMath::RotationMat2Quaternion(c_b_e_);
+}
+
+/**@brief       设置e系状态, 用于组合导航反馈校正
+ * @param[in]   xyz             e系位置
+ * @param[in]   v_ecef          e系速度
+ * @param[in]   q_b_e           姿态四元数q_b^e
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename AttT>
+void SinsMechanizationEcefT<AttT>::set_ecef_state(const std::vector<double> &xyz,
+                                                  const std::vector<double> &v_ecef,
+                                                  const std::vector<double> &q_b_e)
+{
+    xyz_ = xyz;
+    v_ecef_ = v_ecef;
+    q_b_e_ = q_b_e;
+    c_b_e_ = BaseMath::Quaternion2RotationMat(q_b_e_);
+}
+
+template<typename AttT>
+double SinsMechanizationEcefT<AttT>::get_t() const
+{
+    return t_;
+}
+
+template<typename AttT>
+double SinsMechanizationEcefT<AttT>::get_delta_t() const
+{
+    return delta_t_;
+}
+
+template<typename AttT>
+const std::vector<double> &SinsMechanizationEcefT<AttT>::get_xyz() const
+{
+    return xyz_;
+}
+
+template<typename AttT>
+const std::vector<double> &SinsMechanizationEcefT<AttT>::get_v_ecef() const
+{
+    return v_ecef_;
+}
+
+template<typename AttT>
+const std::vector<double> &SinsMechanizationEcefT<AttT>::get_q_b_e() const
+{
+    return q_b_e_;
+}
+
+template<typename AttT>
+const BaseMatrix &SinsMechanizationEcefT<AttT>::get_c_b_e() const
+{
+    return c_b_e_;
+}
+
+template<typename AttT>
+const std::vector<double> &SinsMechanizationEcefT<AttT>::get_g_e() const
+{
+    return g_e_;
+}
+
+template class SinsMechanizationEcefT<double>;
+template class SinsMechanizationEcefT<float>;
@@ -0,0 +1,99 @@
+/**@file    sins_mechanization_ecef.h
+ * @brief   ECEF系惯导机械编排
+ * @details 在地心地固坐标系中进行机械编排, 位置直接按XYZ积分
+ * @author  Zing Fong\n
+ *          zing.fong.whu\@outlook.com
+ * @date    2026/10/18
+ * @version V1.0
+ **********************************************************************************
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Version  <th>Author     <th>Description
+ * <tr><td>2026/10/18   <td>1.0      <td>Zing Fong  <td>Initialize
+ * </table>
+ **********************************************************************************
+ */
+#ifndef LOOSECOUPLED_SRC_SINSTK_SINS_MECHANIZATION_ECEF_H
+#define LOOSECOUPLED_SRC_SINSTK_SINS_MECHANIZATION_ECEF_H
+
+// c/c++系统文件
+
+// 其他库的 .h 文件
+#include <vector>
+
+// 本项目内 .h 文件
+#include "../basetk/base_math.h"
+#include "sins_file_stream.h"
+#include "sins_mechanization.h"
+
+/**@class   SinsMechanizationEcefT
+ * @brief   ECEF系惯导机械编排类, AttT为姿态更新的计算精度
+ * @details 状态为e系位置、e系速度和姿态四元数q_b^e。与SinsMechanizationT的算法相同(双子样圆锥补偿、
+ *          速度中间时刻外推、位置梯形积分), 只是导航坐标系换为e系: n系转动只剩地球自转, 哥氏项只有2ω_ie,
+ *          重力由BaseMath::CalcGeXyz直接从XYZ计算。每个历元不需要子午圈、卯酉圈半径和tan(φ), 也不需要
+ *          BLH与XYZ的相互转换, 在两极附近没有奇异。\n
+ *          接口与SinsMechanizationT一致: get_cur_state和set_cur_state按n系描述(BLH、NED速度、C_b^n)转换,
+ *          只在输出和量测更新时调用; 逐历元的计算使用get_xyz、get_v_ecef、get_c_b_e等e系的量。
+ *          只实例化了double和float两种
+ * @par     修改日志:
+ * <table>
+ * <tr><th>Date         <th>Author      <th>Description
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>Initialize
+ * </table>
+ */
+template<typename AttT>
+class SinsMechanizationEcefT
+{
+  public:
+    SinsMechanizationEcefT() = default;  // 默认构造函数
+    
+    void Init(const StateInfo &initial_state);  // 状态初始化
+    int ImuMechanization(const ImuData &imu_data);  // 进行一次机械编排
+    
+    // get
+    double get_t() const;
+    double get_delta_t() const;
+    StateInfo get_cur_state() const;  // 转换为n系描述的当前状态
+    const std::vector<double> &get_xyz() const;
+    const std::vector<double> &get_v_ecef() const;
+    const std::vector<double> &get_q_b_e() const;
+    const BaseMatrix &get_c_b_e() const;
+    const std::vector<double> &get_g_e() const;
+    
+    // set
+    void set_cur_state(const StateInfo &state);  // 由n系描述的状态设置
+    void set_ecef_state(const std::vector<double> &xyz, const std::vector<double> &v_ecef,
+                        const std::vector<double> &q_b_e);  // 设置e系状态, 用于反馈校正
+    
+  private:
+    int PrepareUpdate(const ImuData &imu_data);  // 更新前准备, 将上一历元的数据前移
+    void AttitudeUpdate();  // 姿态更新
+    void VelocityUpdate();  // 速度更新
+    void PositionUpdate();  // 位置更新
+    
+    int cur_epoch_{};  // 累计经过了多少个历元
+    double t_{};  // 当前历元时间, GPS周秒
+    double delta_t_{};  // 当前历元和上一历元的时间间隔
+    
+    std::vector<double> xyz_ = std::vector<double>(3, 0.0);  // e系位置
+    std::vector<double> v_ecef_ = std::vector<double>(3, 0.0);  // e系速度
+    std::vector<double> q_b_e_ = {1.0, 0.0, 0.0, 0.0};  // 姿态四元数q_b^e
+    BaseMatrix c_b_e_ = BaseMatrix::eye(3);  // 姿态矩阵C_b^e
+    std::vector<double> g_e_ = std::vector<double>(3, 0.0);  // 中间时刻的e系重力
+    
+    std::vector<double> xyz_ksub1_ = std::vector<double>(3, 0.0);  // k-1时刻e系位置
+    std::vector<double> v_ecef_ksub1_ = std::vector<double>(3, 0.0);  // k-1时刻e系速度
+    std::vector<double> v_ecef_ksub2_ = std::vector<double>(3, 0.0);  // k-2时刻e系速度
+    std::vector<double> q_b_e_ksub1_ = {1.0, 0.0, 0.0, 0.0};  // k-1时刻姿态四元数
+    BaseMatrix c_b_e_ksub1_ = BaseMatrix::eye(3);  // k-1时刻姿态矩阵
+    
+    ImuData cur_imu_data_{};  // 当前时刻传感器数据
+    ImuData ksub1_imu_data_{};  // k-1时刻传感器数据
+};
+
+using SinsMechanizationEcef = SinsMechanizationEcefT<double>;
+extern template class SinsMechanizationEcefT<double>;
+extern template class SinsMechanizationEcefT<float>;
+
+
+#endif //LOOSECOUPLED_SRC_SINSTK_SINS_MECHANIZATION_ECEF_H
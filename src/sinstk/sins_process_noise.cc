@@ -0,0 +1,223 @@
+/**@file    sins_process_noise.cc
+ * @brief   松组合过程噪声的离散化
+ * @details 实现了Van Loan离散化和按名义IMU间隔的Qd缓存
+ * @author  Zing Fong\n
+ *          zing.fong.whu\@outlook.com
+ * @date    2026/10/18
+ * @version V1.0
+ **********************************************************************************
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Version  <th>Author     <th>Description
+ * <tr><td>2026/10/18   <td>1.0      <td>Zing Fong  <td>Initialize
+ * <tr><td>2026/10/18   <td>1.1      <td>Zing Fong  <td>缓存按相对容差匹配名义间隔, 不再因时标抖动重复计算
+ * </table>
+ **********************************************************************************
+ */
+
+// 本类对应的.h文件
+#include "sins_process_noise.h"
+// c/c++系统文件
+#include <cstdio>
+// 其他库的 .h 文件
+#include <cmath>
+
+// 本项目内 .h 文件
+#include "sins_loose_coupled.h"
+
+/**@brief       Van Loan法离散化: 由连续模型ẋ = F·x + G·w求间隔dt的Φ和Qd
+ * @details     令M = [-F, G·Q·Gᵀ; 0, Fᵀ]·dt, 则e^M = [*, Φ⁻¹·Qd; 0, Φᵀ], 于是Φ = (e^M右下块)ᵀ, Qd = Φ·(e^M右上块)。
+ *              Qd = ∫Φ(s)·G·Q·Gᵀ·Φ(s)ᵀds在[0, dt]上的积分是精确的, 只要求F和Q在间隔内不变。结果按上三角对称化
+ * @param[in]   f           连续系统矩阵F, n×n
+ * @param[in]   g_q_gt      连续噪声G·Q·Gᵀ, n×n
+ * @param[in]   dt          离散间隔(s)
+ * @param[out]  phi         状态转移矩阵Φ = e^(F·dt)
+ * @param[out]  qd          离散过程噪声Qd
+ * @return      0为正常, -1为维数不一致
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename Layout>
+int SinsProcessNoise<Layout>::VanLoan(const BaseMatrix &f, const BaseMatrix &g_q_gt, const double &dt,
+                                      BaseMatrix &phi, BaseMatrix &qd)
+{
+    const int n = f.get_row_num();
+    if(f.get_col_num() != n || g_q_gt.get_row_num() != n || g_q_gt.get_col_num() != n)
+    {
+        printf("Van Loan error! F size: %d×%d, GQGᵀ size: %d×%d\n", f.get_row_num(), f.get_col_num(),
+               g_q_gt.get_row_num(), g_q_gt.get_col_num());
+        return -1;
+    }
+    BaseMatrix m(2*n, 2*n);
+    for(int i = 0; i < n; ++i)
+        for(int j = 0; j < n; ++j)
+        {
+            m.write(i, j, -f.read(i, j)*dt);
+            m.write(i, n + j, g_q_gt.read(i, j)*dt);
+            m.write(n + i, n + j, f.read(j, i)*dt);
+        }
+    auto e = m.Exp();
+    phi = e.block(n, n, n, n).ToMatrix().Trans();
+    qd = phi*e.block(0, n, n, n).ToMatrix();
+    for(int i = 0; i < n; ++i)
+        for(int j = i + 1; j < n; ++j)
+        {
+            double q = 0.5*(qd.read(i, j) + qd.read(j, i));
+            qd.write(i, j, q);
+            qd.write(j, i, q);
+        }
+    return 0;
+}
+
+/**@brief       设置噪声参数, 参数改变后原有的缓存失效
+ * @param[in]   noise       噪声参数
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename Layout>
+void SinsProcessNoise<Layout>::SetNoise(const ImuNoise &noise)
+{
+    noise_ = noise;
+    cache_.clear();
+}
+
+/**@brief       b系下的连续模型, 只包含不随载体运动变化的项
+ * @param[out]  f           F_b, 位置←速度为I, 速度←加表零偏为I, 姿态←陀螺零偏为-I, 器件误差为-1/T·I
+ * @param[out]  g_q_gt      G·Q·Gᵀ, 速度为VRW², 姿态为ARW², 器件误差为2σ²/T
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename Layout>
+void SinsProcessNoise<Layout>::BuildModel(BaseMatrix &f, BaseMatrix &g_q_gt) const
+{
+    using L = Layout;
+    const double t = noise_.corr_time;
+    f = BaseMatrix(L::kDim, L::kDim);
+    g_q_gt = BaseMatrix(L::kDim, L::kDim);
+    auto markov = [&](const int &index, const double &std)
+    {
+        f.block<3, 3>(index, index).setIdentity();
+        f.block<3, 3>(index, index) *= -1.0/t;
+        g_q_gt.block<3, 3>(index, index).setIdentity();
+        g_q_gt.block<3, 3>(index, index) *= 2*std*std/t;
+    };
+    f.block<3, 3>(L::kPos, L::kVel).setIdentity();
+    f.block<3, 3>(L::kVel, L::kAccBias).setIdentity();
+    f.block<3, 3>(L::kAtt, L::kGyroBias).setIdentity();
+    f.block<3, 3>(L::kAtt, L::kGyroBias) *= -1.0;
+    g_q_gt.block<3, 3>(L::kVel, L::kVel).setIdentity();
+    g_q_gt.block<3, 3>(L::kVel, L::kVel) *= noise_.vrw*noise_.vrw;
+    g_q_gt.block<3, 3>(L::kAtt, L::kAtt).setIdentity();
+    g_q_gt.block<3, 3>(L::kAtt, L::kAtt) *= noise_.arw*noise_.arw;
+    markov(L::kGyroBias, noise_.gyro_bias_std);
+    markov(L::kAccBias, noise_.acc_bias_std);
+    if constexpr(L::kGyroScale >= 0)
+        markov(L::kGyroScale, noise_.gyro_scale_std);
+    if constexpr(L::kAccScale >= 0)
+        markov(L::kAccScale, noise_.acc_scale_std);
+}
+
+/**@brief       取名义间隔的Qd_b, 缓存中没有时计算
+ * @param[in]   dt          IMU间隔(s), 与名义间隔的相对差不超过kCacheTolerance时返回名义间隔的Qd_b
+ * @return      b系下名义间隔的Qd, 不按间隔缩放, 下一次调用前有效
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename Layout>
+const BaseMatrix &SinsProcessNoise<Layout>::GetBodyQd(const double &dt)
+{
+    return Lookup(dt).qd;
+}
+
+/**@brief       按名义间隔查找缓存, 没有时用Van Loan法计算并加入缓存
+ * @details     间隔与缓存项名义间隔的相对差不超过kCacheTolerance即命中, 新加入的缓存项以本次间隔为名义间隔。
+ *              IMU时标的抖动通常在微秒级, 远小于容差, 整个任务只需计算一次
+ * @param[in]   dt          IMU间隔(s)
+ * @return      缓存项, 下一次调用前有效
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename Layout>
+const typename SinsProcessNoise<Layout>::CacheEntry &SinsProcessNoise<Layout>::Lookup(const double &dt)
+{
+    for(const auto &entry: cache_)
+        if(fabs(dt - entry.dt) <= kCacheTolerance*entry.dt)
+            return entry;
+    
+    if(static_cast<int>(cache_.size()) >= kCacheCapacity)
+        cache_.erase(cache_.begin());
+    CacheEntry entry{};
+    entry.dt = dt;
+    BaseMatrix f, g_q_gt, phi;
+    BuildModel(f, g_q_gt);
+    VanLoan(f, g_q_gt, dt, phi, entry.qd);
+    for(int gi = 0; gi < Layout::kDim/3; ++gi)
+        for(int gj = 0; gj < Layout::kDim/3; ++gj)
+        {
+            bool zero = true;
+            for(int r = 0; r < 3 && zero; ++r)
+                for(int c = 0; c < 3 && zero; ++c)
+                    zero = entry.qd.read(3*gi + r, 3*gj + c) == 0.0;
+            if(!zero)
+                entry.blocks.emplace_back(gi, gj);
+        }
+    cache_.push_back(std::move(entry));
+    return cache_.back();
+}
+
+/**@brief       计算n系下的离散过程噪声Qd = R·Qd_b·Rᵀ
+ * @details     R = diag(C_b^n, C_b^n, C_b^n, I, ...), 对Qd_b的每个非零3×3块逐块旋转。
+ *              Qd_b取名义间隔的缓存, 按dt与名义间隔之比缩放, 补偿一阶项
+ * @param[in]   dt          IMU间隔(s)
+ * @param[in]   c_b_n       间隔内的姿态矩阵C_b^n
+ * @return      n系下的Qd, 下一次调用前有效
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+template<typename Layout>
+const BaseMatrix &SinsProcessNoise<Layout>::CalcQd(const double &dt, const BaseMatrix &c_b_n)
+{
+    const auto &entry = Lookup(dt);
+    const BaseMatrix &qd_b = entry.qd;
+    const double scale = entry.dt > 0 ? dt/entry.dt : 1.0;
+    
+    constexpr int kRotatedNum = Layout::kAtt/3 + 1;  // 位置、速度、姿态三组需要旋转
+    double c[3][3];
+    for(int r = 0; r < 3; ++r)
+        for(int k = 0; k < 3; ++k)
+            c[r][k] = c_b_n.read(r, k);
+    if(qd_.get_row_num() != Layout::kDim || qd_.get_col_num() != Layout::kDim)
+        qd_ = BaseMatrix(Layout::kDim, Layout::kDim);
+    qd_.setZero();
+    for(const auto &[gi, gj]: entry.blocks)
+    {
+        auto src = qd_b.block<3, 3>(3*gi, 3*gj);
+        auto dst = qd_.block<3, 3>(3*gi, 3*gj);
+        double left[3][3];  // R_i·Qd_ij
+        for(int r = 0; r < 3; ++r)
+            for(int k = 0; k < 3; ++k)
+                left[r][k] = scale*(gi < kRotatedNum ?
+                                    c[r][0]*src(0, k) + c[r][1]*src(1, k) + c[r][2]*src(2, k) : src(r, k));
+        for(int r = 0; r < 3; ++r)
+            for(int k = 0; k < 3; ++k)
+                dst(r, k) = gj < kRotatedNum ?
+                            left[r][0]*c[k][0] + left[r][1]*c[k][1] + left[r][2]*c[k][2] : left[r][k];
+    }
+    return qd_;
+}
+
+template<typename Layout>
+const ImuNoise &SinsProcessNoise<Layout>::get_noise() const
+{
+    return noise_;
+}
+
+template<typename Layout>
+int SinsProcessNoise<Layout>::get_cache_size() const
+{
+    return static_cast<int>(cache_.size());
+}
+
+template class SinsProcessNoise<StateLayout<15>>;
+template class SinsProcessNoise<StateLayout<18>>;
+template class SinsProcessNoise<StateLayout<21>>;
@@ -0,0 +1,102 @@
+/**@file    sins_process_noise.h
+ * @brief   松组合过程噪声的离散化
+ * @details 用Van Loan法精确计算给定间隔的离散过程噪声Qd, 按名义IMU间隔缓存
+ * @author  Zing Fong\n
+ *          zing.fong.whu\@outlook.com
+ * @date    2026/10/18
+ * @version V1.0
+ **********************************************************************************
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Version  <th>Author     <th>Description
+ * <tr><td>2026/10/18   <td>1.0      <td>Zing Fong  <td>Initialize
+ * <tr><td>2026/10/18   <td>1.1      <td>Zing Fong  <td>缓存按相对容差匹配名义间隔, 不再因时标抖动重复计算
+ * </table>
+ **********************************************************************************
+ */
+#ifndef LOOSECOUPLED_SRC_SINSTK_SINS_PROCESS_NOISE_H
+#define LOOSECOUPLED_SRC_SINSTK_SINS_PROCESS_NOISE_H
+
+// c/c++系统文件
+
+// 其他库的 .h 文件
+#include <utility>
+#include <vector>
+
+// 本项目内 .h 文件
+#include "../basetk/base_matrix.h"
+
+/**@struct      ImuNoise
+ * @brief       IMU噪声参数, 均为国际单位
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Author      <th>Description
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>Initialize
+ * </table>
+ */
+struct ImuNoise
+{
+    double arw{};  // 角度随机游走(rad/√s)
+    double vrw{};  // 速度随机游走(m/s/√s)
+    double gyro_bias_std{};  // 陀螺零偏标准差(rad/s)
+    double acc_bias_std{};  // 加表零偏标准差(m/s²)
+    double gyro_scale_std{};  // 陀螺比例因子标准差
+    double acc_scale_std{};  // 加表比例因子标准差
+    double corr_time = 3600.0;  // 一阶高斯马尔科夫过程相关时间(s)
+};
+
+/**@class   SinsProcessNoise
+ * @brief   松组合离散过程噪声, Layout为误差状态的排列(StateLayout)
+ * @details 连续模型取F阵中不随载体运动变化的部分: δṙ = δv, δv̇ = C_b^n·δb_a + w_v, φ̇ = -C_b^n·δb_g + w_φ,
+ *          器件误差为相关时间T的一阶高斯马尔科夫过程; 比例因子与比力、角速度的耦合以及Fvφ等随导航状态变化的项不计入。
+ *          设R = diag(C_b^n, C_b^n, C_b^n, I, ...), 间隔内C_b^n不变时该模型等于由b系模型R·F_b·Rᵀ得到,
+ *          所以Qd = R·Qd_b·Rᵀ, 其中Qd_b只取决于噪声参数和间隔长度。
+ *          Qd_b用Van Loan法由矩阵指数精确计算, 按名义间隔缓存: 间隔与某个缓存项的相对差不超过kCacheTolerance时
+ *          视为同一名义间隔, 取该项的Qd_b按间隔之比缩放(一阶精度), 所以时标的微秒级抖动不会产生新的缓存项。
+ *          每个历元对Qd_b的所有非零3×3块做旋转: 行或列属于位置、速度、姿态组的一侧乘C_b^n, 属于器件误差的一侧不变。
+ *          Layout实例化了StateLayout<15>、<18>、<21>
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Author      <th>Description
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>Initialize
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>缓存按相对容差匹配名义间隔
+ * </table>
+ */
+template<typename Layout>
+class SinsProcessNoise
+{
+  public:
+    static constexpr double kCacheTolerance = 0.01;  // 视为同一名义间隔的最大相对差
+    static constexpr int kCacheCapacity = 8;  // 最多缓存的间隔数, 超出时替换最早的
+    
+    static int VanLoan(const BaseMatrix &f, const BaseMatrix &g_q_gt, const double &dt,
+                       BaseMatrix &phi, BaseMatrix &qd);  // Van Loan法求Φ和Qd
+    
+    void SetNoise(const ImuNoise &noise);  // 设置噪声参数并清空缓存
+    const BaseMatrix &CalcQd(const double &dt, const BaseMatrix &c_b_n);  // 计算n系下的Qd
+    const BaseMatrix &GetBodyQd(const double &dt);  // 取名义间隔的Qd_b, 没有时计算
+    void BuildModel(BaseMatrix &f, BaseMatrix &g_q_gt) const;  // b系下的连续模型F_b和G·Q·Gᵀ
+    
+    // get
+    const ImuNoise &get_noise() const;
+    int get_cache_size() const;
+    
+  private:
+    /**@struct  CacheEntry
+     * @brief   一个名义间隔的Qd_b和其中的非零3×3块
+     */
+    struct CacheEntry
+    {
+        double dt{};  // 名义间隔(s), 为首次计算时的间隔
+        BaseMatrix qd{};  // b系下的Qd
+        std::vector<std::pair<int, int>> blocks{};  // 非零3×3块的行列组号
+    };
+    
+    const CacheEntry &Lookup(const double &dt);  // 查找缓存, 没有时计算并加入
+    
+    ImuNoise noise_{};  // 噪声参数
+    std::vector<CacheEntry> cache_{};  // 按加入顺序排列
+    BaseMatrix qd_{};  // n系下的Qd, 工作矩阵
+};
+
+#endif //LOOSECOUPLED_SRC_SINSTK_SINS_PROCESS_NOISE_H
@@ -0,0 +1,372 @@
+/**@file    sins_simulator.cc
+ * @brief   IMU/GNSS轨迹仿真.cc文件
+ * @details 实现了运动剖面解析、无误差增量计算、IMU和GNSS误差叠加以及各文件的输出
+ * @author  Zing Fong\n
+ *          zing.fong.whu\@outlook.com
+ * @date    2026/10/18
+ * @version V1.0
+ **********************************************************************************
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Version  <th>Author     <th>Description
+ * <tr><td>2026/10/18   <td>1.0      <td>Zing Fong  <td>Initialize
+ * </table>
+ **********************************************************************************
+ */
+
+// 本类对应的.h文件
+#include "sins_simulator.h"
+// c/c++系统文件
+#include <cstdlib>
+// 其他库的 .h 文件
+#include <cmath>
+#include <sstream>
+
+// 本项目内 .h 文件
+#include "sins_app.h"
+
+/**@brief       读取仿真参数、初始状态和输出文件路径
+ * @details     初始状态与纯惯导相同, 取自[SINS]。IMU文件和GNSS文件的路径、格式与读取时相同,
+ *              所以同一份配置文件可以先仿真再解算。\n
+ *              零偏和比例因子在初始化时按给定标准差随机抽取, 并打印出来作为参考真值。
+ * @param[in]   config          配置表
+ * @return      0为正常, -1为运动剖面格式错误
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int SinsSimulator::Init(const Config &config)
+{
+    const double &D2R = BaseSdc::kD2R;
+    engine_.seed(static_cast<uint64_t>(config.ReadInt("SIM", "seed", 1)));
+    duration_ = config.ReadFloat("SIM", "duration", 3600.0f);
+    imu_rate_ = config.ReadFloat("SIM", "imu_rate", 200.0f);
+    gnss_rate_ = config.ReadFloat("SIM", "gnss_rate", 1.0f);
+    truth_rate_ = config.ReadFloat("SIM", "truth_rate", 0.0f);
+    if(duration_ <= 0 || imu_rate_ <= 0 || gnss_rate_ <= 0 || truth_rate_ < 0)
+    {
+        printf("Simulation setting error! duration: %.3f, imu rate: %.3f, "
+               "gnss rate: %.3f, truth rate: %.3f\n", duration_, imu_rate_,
+               gnss_rate_, truth_rate_);
+        return -1;
+    }
+    // 默认剖面: 静止、加速、匀速、右转90°、匀速、减速
+    if(ParseProfile(config.ReadString("SIM", "profile",
+                                      "60,0,0;10,1,0;60,0,0;20,0,4.5;"
+                                      "60,0,0;10,-1,0")) != 0)
+        return -1;
+    init_state_ = SinsApp::ReadInitState(config);
+
+    // 配置文件中的单位与松组合相同: deg/h, mGal, ppm, deg/√h, m/s/√h, h
+    double gyro_bias_std = config.ReadFloat("SIM", "gyro_bias_std", 10.0f)*
+                           D2R/3600.0;
+    double acc_bias_std = config.ReadFloat("SIM", "acc_bias_std", 100.0f)*1e-5;
+    double gyro_scale_std = config.ReadFloat("SIM", "gyro_scale_std", 100.0f)*
+                            1e-6;
+    double acc_scale_std = config.ReadFloat("SIM", "acc_scale_std", 100.0f)*
+                           1e-6;
+    gyro_drift_std_ = config.ReadFloat("SIM", "gyro_drift_std", 1.0f)*D2R/
+                      3600.0;
+    acc_drift_std_ = config.ReadFloat("SIM", "acc_drift_std", 10.0f)*1e-5;
+    corr_time_ = config.ReadFloat("SIM", "corr_time", 1.0f)*3600.0;
+    arw_ = config.ReadFloat("SIM", "arw", 0.05f)*D2R/60.0;
+    vrw_ = config.ReadFloat("SIM", "vrw", 0.05f)/60.0;
+    gnss_pos_std_ = config.ReadFloat("SIM", "gnss_pos_std", 0.02f);
+    gnss_hgt_std_ = config.ReadFloat("SIM", "gnss_hgt_std", 0.04f);
+    gnss_vel_std_ = config.ReadFloat("SIM", "gnss_vel_std", 0.01f);
+    for(int i = 0; i < 3; ++i)
+    {
+        gyro_bias_[i] = gyro_bias_std*Gauss();
+        acc_bias_[i] = acc_bias_std*Gauss();
+        gyro_scale_[i] = gyro_scale_std*Gauss();
+        acc_scale_[i] = acc_scale_std*Gauss();
+        gyro_drift_[i] = gyro_drift_std_*Gauss();
+        acc_drift_[i] = acc_drift_std_*Gauss();
+    }
+
+    binary_ = config.ReadString("SINS", "imu_file_format", "text") == "binary";
+    imu_file_path_ = config.ReadString("SINS", "imu_file_path", "imu.txt");
+    gnss_file_path_ = config.ReadString("LC", "gnss_file_path", "gnss.pos");
+    truth_file_path_ = config.ReadString("SIM", "truth_file_path", "truth.txt");
+
+    const double &R2D = BaseSdc::kR2D;
+    printf("gyro bias(deg/h): %.4f %.4f %.4f, acc bias(mGal): %.2f %.2f %.2f\n",
+           gyro_bias_[0]*R2D*3600, gyro_bias_[1]*R2D*3600,
+           gyro_bias_[2]*R2D*3600, acc_bias_[0]*1e5, acc_bias_[1]*1e5,
+           acc_bias_[2]*1e5);
+    printf("gyro scale(ppm): %.2f %.2f %.2f, acc scale(ppm): %.2f %.2f %.2f\n",
+           gyro_scale_[0]*1e6, gyro_scale_[1]*1e6, gyro_scale_[2]*1e6,
+           acc_scale_[0]*1e6, acc_scale_[1]*1e6, acc_scale_[2]*1e6);
+    return 0;
+}
+
+/**@brief       解析运动剖面
+ * @details     格式为"时长(s),前向加速度(m/s²),航向角速度(°/s);...", 各段循环执行直到仿真结束
+ * @param[in]   profile         运动剖面字符串
+ * @return      0为正常, -1为格式错误
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int SinsSimulator::ParseProfile(const std::string &profile)
+{
+    profile_.clear();
+    std::stringstream profile_stream(profile);
+    std::string item;
+    while(std::getline(profile_stream, item, ';'))
+    {
+        MotionSegment segment{};
+        if(sscanf(item.c_str(), "%lf,%lf,%lf", &segment.duration, &segment.acc,
+                  &segment.yaw_rate) != 3 || segment.duration <= 0)
+        {
+            printf("Motion profile error: %s\n", item.c_str());
+            return -1;
+        }
+        segment.yaw_rate *= BaseSdc::kD2R;
+        profile_.push_back(segment);
+    }
+    if(profile_.empty())
+    {
+        printf("Motion profile is empty!\n");
+        return -1;
+    }
+    return 0;
+}
+
+/**@brief       标准正态分布随机数
+ * @details     std::normal_distribution的算法由标准库实现决定, 这里用Box-Muller保证跨平台可复现
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+double SinsSimulator::Gauss()
+{
+    const double kScale = 1.0/9007199254740992.0;  // 2^-53
+    double u1 = static_cast<double>((engine_() >> 11) + 1)*kScale;  // (0, 1]
+    double u2 = static_cast<double>(engine_() >> 11)*kScale;  // [0, 1)
+    return sqrt(-2.0*log(u1))*cos(2.0*BaseSdc::kPi*u2);
+}
+
+/**@brief       由当前真值和运动指令计算一个历元的无误差增量
+ * @details     ω_ib_b = C_n_b(ω_ie_n + ω_en_n) + [0 0 ψ']ᵀ\n
+ *              f_b = C_n_b((2ω_ie_n + ω_en_n)×v_n - g_n) + [a  v_fwd·ψ'  0]ᵀ
+ * @param[in]   state           上一历元真值
+ * @param[in]   segment         当前运动段
+ * @param[in]   dt              采样间隔
+ * @return      无误差的速度增量和角增量, 时间未设置
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+ImuData SinsSimulator::CalcCleanImu(const StateInfo &state,
+                                    const MotionSegment &segment,
+                                    const double &dt) const
+{
+    const double &a = BaseSdc::wgs84.kA;
+    const double &e_2 = BaseSdc::wgs84.kESquare;
+    const double &omega_e = BaseSdc::wgs84.kOmega;
+    const double &b = state.blh[0], &h = state.blh[2];
+    const auto &v_ned = state.v_ned;
+    double rm = a*(1 - e_2)/sqrt(pow(1 - e_2*sin(b)*sin(b), 3));
+    double rn = a/sqrt(1 - e_2*sin(b)*sin(b));
+
+    std::vector<double> omega_ie_n = {omega_e*cos(b), 0.0, -omega_e*sin(b)};
+    std::vector<double> omega_en_n = {v_ned[1]/(rn + h), -v_ned[0]/(rm + h),
+                                      -v_ned[1]*tan(b)/(rn + h)};
+    auto g_n = BaseMath::CalcGn(state.blh);
+    auto c_n_b = state.c_b_n.Trans();
+
+    // 角速度
+    auto omega_in_n = BaseMatrix::VectorAdd(omega_ie_n, omega_en_n);
+    auto omega_ib_b = (c_n_b*BaseMatrix(omega_in_n, 3, 1)).get_mat();
+    omega_ib_b[2] += segment.yaw_rate;
+
+    // 比力
+    auto double_omega_ie_n = omega_ie_n;
+    for(auto &a_omega: double_omega_ie_n)
+        a_omega *= 2.0;
+    auto coriolis = BaseMatrix::CrossProduct(
+            BaseMatrix::VectorAdd(double_omega_ie_n, omega_en_n), v_ned);
+    auto f_n = BaseMatrix::VectorSub(coriolis, g_n);
+    auto f_b = (c_n_b*BaseMatrix(f_n, 3, 1)).get_mat();
+    auto v_b = (c_n_b*BaseMatrix(v_ned, 3, 1)).get_mat();
+    f_b[0] += segment.acc;
+    f_b[1] += v_b[0]*segment.yaw_rate;  // 向心加速度
+
+    ImuData imu_data{};
+    for(int i = 0; i < 3; ++i)
+    {
+        imu_data.gyro[i] = omega_ib_b[i]*dt;
+        imu_data.acc[i] = f_b[i]*dt;
+    }
+    return imu_data;
+}
+
+/**@brief       叠加IMU误差
+ * @param[in]   clean           无误差增量
+ * @param[in]   dt              采样间隔
+ * @return      含误差的增量
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+ImuData SinsSimulator::AddImuError(const ImuData &clean, const double &dt)
+{
+    // 一阶高斯马尔科夫过程的离散形式, 保持稳态标准差不变
+    double beta = exp(-dt/corr_time_);
+    double drive = sqrt(1 - beta*beta);
+    double sqrt_dt = sqrt(dt);
+    ImuData imu_data = clean;
+    for(int i = 0; i < 3; ++i)
+    {
+        gyro_drift_[i] = beta*gyro_drift_[i] + gyro_drift_std_*drive*Gauss();
+        acc_drift_[i] = beta*acc_drift_[i] + acc_drift_std_*drive*Gauss();
+        imu_data.gyro[i] = (1 + gyro_scale_[i])*clean.gyro[i] +
+                           (gyro_bias_[i] + gyro_drift_[i])*dt +
+                           arw_*sqrt_dt*Gauss();
+        imu_data.acc[i] = (1 + acc_scale_[i])*clean.acc[i] +
+                          (acc_bias_[i] + acc_drift_[i])*dt +
+                          vrw_*sqrt_dt*Gauss();
+    }
+    return imu_data;
+}
+
+/**@brief       输出一个历元的IMU数据, 格式与SinsFileStream的读取一致
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void SinsSimulator::WriteImu(FILE *file_ptr, const ImuData &imu_data) const
+{
+    if(binary_)
+    {
+        double record[7] = {imu_data.t, imu_data.acc[0], imu_data.acc[1],
+                            imu_data.acc[2], imu_data.gyro[0],
+                            imu_data.gyro[1], imu_data.gyro[2]};
+        fwrite(record, sizeof(double), 7, file_ptr);
+        return;
+    }
+    fprintf(file_ptr, "%.6f %.15e %.15e %.15e %.15e %.15e %.15e\n", imu_data.t,
+            imu_data.acc[0], imu_data.acc[1], imu_data.acc[2],
+            imu_data.gyro[0], imu_data.gyro[1], imu_data.gyro[2]);
+}
+
+/**@brief       输出一个历元的GNSS位置速度, 格式与GnssPos的读取一致
+ * @details     噪声在NED方向上添加, 再转换为ECEF
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void SinsSimulator::WriteGnss(FILE *file_ptr, const StateInfo &state)
+{
+    const double &b = state.blh[0], &l = state.blh[1];
+    // NED向量转ECEF
+    auto ned2ecef = [&b, &l](const std::vector<double> &ned)
+    {
+        std::vector<double> ecef(3, 0.0);
+        ecef[0] = -sin(b)*cos(l)*ned[0] - sin(l)*ned[1] - cos(b)*cos(l)*ned[2];
+        ecef[1] = -sin(b)*sin(l)*ned[0] + cos(l)*ned[1] - cos(b)*sin(l)*ned[2];
+        ecef[2] = cos(b)*ned[0] - sin(b)*ned[2];
+        return ecef;
+    };
+    std::vector<double> pos_noise = {gnss_pos_std_*Gauss(),
+                                     gnss_pos_std_*Gauss(),
+                                     gnss_hgt_std_*Gauss()};
+    auto xyz = BaseMath::XyzAdd(state.xyz, ned2ecef(pos_noise));
+    auto v_ned = state.v_ned;
+    for(auto &a_v: v_ned)
+        a_v += gnss_vel_std_*Gauss();
+    auto v_ecef = ned2ecef(v_ned);
+    fprintf(file_ptr, "%.6f %.4f %.4f %.4f %.4f %.4f %.4f\n", state.time,
+            xyz[0], xyz[1], xyz[2], v_ecef[0], v_ecef[1], v_ecef[2]);
+}
+
+/**@brief       输出一个历元的真值, 格式与SinsApp的结果文件一致
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+void SinsSimulator::WriteTruth(FILE *file_ptr, const StateInfo &state)
+{
+    const double &R2D = BaseSdc::kR2D;
+    auto euler = BaseMath::Quaternion2Euler(state.q);
+    fprintf(file_ptr, "%.6f %.10f %.10f %.4f %.4f %.4f %.4f %.6f %.6f %.6f\n",
+            state.time, state.blh[0]*R2D, state.blh[1]*R2D, state.blh[2],
+            state.v_ned[0], state.v_ned[1], state.v_ned[2], euler[0]*R2D,
+            euler[1]*R2D, euler[2]*R2D);
+}
+
+/**@brief       生成数据
+ * @details     逐历元生成并立即写入文件, 内存占用与仿真时长无关。
+ *              历元时刻由init_time + k/imu_rate计算, 长时间仿真不会累积时间误差。
+ * @return      生成的IMU历元数, 出错返回-1
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+long SinsSimulator::Run()
+{
+    FILE *imu_file = fopen(imu_file_path_.c_str(), binary_ ? "wb" : "w");
+    FILE *gnss_file = fopen(gnss_file_path_.c_str(), "w");
+    FILE *truth_file = fopen(truth_file_path_.c_str(), "w");
+    if(imu_file == nullptr || gnss_file == nullptr || truth_file == nullptr)
+    {
+        printf("Cannot open simulation output files! imu: %s, gnss: %s, "
+               "truth: %s\n", imu_file_path_.c_str(), gnss_file_path_.c_str(),
+               truth_file_path_.c_str());
+        for(auto a_file: {imu_file, gnss_file, truth_file})
+            if(a_file != nullptr)
+                fclose(a_file);
+        return -1;
+    }
+
+    const double dt = 1.0/imu_rate_;
+    const long epoch_num = lround(duration_*imu_rate_) + 1;
+    const long gnss_step = lround(imu_rate_/gnss_rate_) > 1 ?
+                           lround(imu_rate_/gnss_rate_) : 1;
+    const long truth_step = truth_rate_ > 0 && lround(imu_rate_/truth_rate_) > 1 ?
+                            lround(imu_rate_/truth_rate_) : 1;
+    double profile_length = 0.0;
+    for(const auto &a_segment: profile_)
+        profile_length += a_segment.duration;
+
+    SinsMechanization mechanization{};
+    mechanization.Init(init_state_);
+    for(long k = 0; k < epoch_num; ++k)
+    {
+        // 采样间隔中点所在的运动段, 剖面段数很少, 直接顺序查找
+        double elapsed = fmod(fmax(0.0, (k - 0.5)*dt), profile_length);
+        int segment_index = 0;
+        for(double segment_end = profile_[0].duration;
+            elapsed >= segment_end &&
+            segment_index + 1 < static_cast<int>(profile_.size());)
+            segment_end += profile_[++segment_index].duration;
+
+        auto clean = CalcCleanImu(mechanization.get_cur_state(),
+                                  profile_[segment_index], dt);
+        clean.t = init_state_.time + k*dt;
+        mechanization.ImuMechanization(clean);
+        auto truth = mechanization.get_cur_state();
+
+        WriteImu(imu_file, AddImuError(clean, dt));
+        if(k%truth_step == 0)
+            WriteTruth(truth_file, truth);
+        if(k%gnss_step == 0)
+            WriteGnss(gnss_file, truth);
+    }
+    fclose(imu_file);
+    fclose(gnss_file);
+    fclose(truth_file);
+    return epoch_num;
+}
+
+std::vector<double> SinsSimulator::get_gyro_bias() const
+{
+    return gyro_bias_;
+}
+
+std::vector<double> SinsSimulator::get_acc_bias() const
+{
+    return acc_bias_;
+}
+
+std::vector<double> SinsSimulator::get_gyro_scale() const
+{
+    return gyro_scale_;
+}
+
+std::vector<double> SinsSimulator::get_acc_scale() const
+{
+    return acc_scale_;
+}
@@ -0,0 +1,121 @@
+/**@file    sins_simulator.h
+ * @brief   IMU/GNSS轨迹仿真.h文件
+ * @details 按运动剖面生成可复现的IMU增量输出、GNSS位置速度和真值, 用于负载测试和精度评估
+ * @author  Zing Fong\n
+ *          zing.fong.whu\@outlook.com
+ * @date    2026/10/18
+ * @version V1.0
+ **********************************************************************************
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Version  <th>Author     <th>Description
+ * <tr><td>2026/10/18   <td>1.0      <td>Zing Fong  <td>Initialize
+ * </table>
+ **********************************************************************************
+ */
+
+#ifndef LOOSECOUPLED_SRC_SINSTK_SINS_SIMULATOR_H
+#define LOOSECOUPLED_SRC_SINSTK_SINS_SIMULATOR_H
+
+// c/c++系统文件
+#include <cstdio>
+
+// 其他库的 .h 文件
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+// 本项目内 .h 文件
+#include "../basetk/base_math.h"
+#include "../basetk/base_app.h"
+#include "sins_file_stream.h"
+#include "sins_mechanization.h"
+
+/**@struct      MotionSegment
+ * @brief       运动剖面中的一段, 载体系下的前向加速度和航向角速度在段内保持不变
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Author      <th>Description
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>Initialize
+ * </table>
+ */
+struct MotionSegment
+{
+    double duration{};  // 持续时间(s)
+    double acc{};  // 前向加速度(m/s²)
+    double yaw_rate{};  // 航向角速度(rad/s), 右转为正
+};
+
+/**@class   SinsSimulator
+ * @brief   IMU/GNSS轨迹仿真器
+ * @details 真值由本项目的机械编排(NED, 增量输出)对无误差增量递推得到, 所以纯惯导在无误差数据上
+ *          能精确复现真值。每个历元根据当前真值计算抵消重力、地球自转、牵连角速度和哥氏加速度所需的
+ *          增量, 再叠加运动剖面给出的机动。转弯时补偿向心加速度, 使速度方向与航向一致。\n
+ *          IMU误差模型: 输出 = (1 + 比例因子)·真实增量 + (常值零偏 + 一阶高斯马尔科夫零偏)·Δt + 白噪声。\n
+ *          随机数使用mt19937_64并自行实现Box-Muller变换, 同一种子在任何平台上生成相同的数据。
+ * @par 修改日志:
+ * <table>
+ * <tr><th>Date         <th>Author      <th>Description
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>Initialize
+ * </table>
+ */
+class SinsSimulator
+{
+  public:
+    int Init(const Config &config);  // 读取仿真参数、初始状态和输出文件路径
+    long Run();  // 生成数据, 返回生成的IMU历元数, 出错返回-1
+
+    // get
+    std::vector<double> get_gyro_bias() const;
+    std::vector<double> get_acc_bias() const;
+    std::vector<double> get_gyro_scale() const;
+    std::vector<double> get_acc_scale() const;
+
+  private:
+    ImuData CalcCleanImu(const StateInfo &state, const MotionSegment &segment,
+                         const double &dt) const;  // 由当前真值和运动指令计算无误差增量
+    ImuData AddImuError(const ImuData &clean, const double &dt);  // 叠加IMU误差
+    double Gauss();  // 标准正态分布随机数
+    int ParseProfile(const std::string &profile);  // 解析运动剖面字符串
+    void WriteImu(FILE *file_ptr, const ImuData &imu_data) const;  // 输出一个历元的IMU数据
+    void WriteGnss(FILE *file_ptr, const StateInfo &state);  // 输出一个历元的GNSS位置速度
+    static void WriteTruth(FILE *file_ptr, const StateInfo &state);  // 输出一个历元的真值
+
+    std::mt19937_64 engine_{};  // 随机数引擎
+
+    // 仿真设置
+    double duration_ = 3600.0;  // 仿真时长(s)
+    double imu_rate_ = 200.0;  // IMU采样率(Hz)
+    double gnss_rate_ = 1.0;  // GNSS输出频率(Hz)
+    double truth_rate_ = 0.0;  // 真值输出频率(Hz), 0为每个IMU历元都输出
+    std::vector<MotionSegment> profile_{};  // 运动剖面, 循环执行
+    StateInfo init_state_{};  // 初始状态
+
+    // IMU误差, 均为国际单位
+    std::vector<double> gyro_bias_ = std::vector<double>(3, 0.0);  // 陀螺常值零偏(rad/s)
+    std::vector<double> acc_bias_ = std::vector<double>(3, 0.0);  // 加表常值零偏(m/s²)
+    std::vector<double> gyro_scale_ = std::vector<double>(3, 0.0);  // 陀螺比例因子
+    std::vector<double> acc_scale_ = std::vector<double>(3, 0.0);  // 加表比例因子
+    std::vector<double> gyro_drift_ = std::vector<double>(3, 0.0);  // 陀螺零偏的马尔科夫部分(rad/s)
+    std::vector<double> acc_drift_ = std::vector<double>(3, 0.0);  // 加表零偏的马尔科夫部分(m/s²)
+    double gyro_drift_std_{};  // 陀螺零偏马尔科夫过程标准差(rad/s)
+    double acc_drift_std_{};  // 加表零偏马尔科夫过程标准差(m/s²)
+    double corr_time_ = 3600.0;  // 马尔科夫过程相关时间(s)
+    double arw_{};  // 角度随机游走(rad/√s)
+    double vrw_{};  // 速度随机游走(m/s/√s)
+
+    // GNSS误差
+    double gnss_pos_std_{};  // 水平位置噪声(m)
+    double gnss_hgt_std_{};  // 高程噪声(m)
+    double gnss_vel_std_{};  // 速度噪声(m/s)
+
+    // 输出
+    bool binary_{};  // IMU文件是否为二进制格式
+    std::string imu_file_path_{};  // IMU文件路径
+    std::string gnss_file_path_{};  // GNSS结果文件路径
+    std::string truth_file_path_{};  // 真值文件路径
+};
+
+
+#endif //LOOSECOUPLED_SRC_SINSTK_SINS_SIMULATOR_H
@@ -10,6 +10,25 @@
  * <table>
  * <tr><th>Date         <th>Version  <th>Author     <th>Description
  * <tr><td>2022/6/10    <td>1.0      <td>Zing Fong  <td>Initialize
+ * <tr><td>2026/10/18   <td>1.1      <td>Zing Fong  <td>增加了ProfilerTester
+ * <tr><td>2026/10/18   <td>1.2      <td>Zing Fong  <td>增加了ConfigTester
+ * <tr><td>2026/10/18   <td>1.3      <td>Zing Fong  <td>增加了GnssTester
+ * <tr><td>2026/10/18   <td>1.4      <td>Zing Fong  <td>增加了BaseMatrixTester
+ * <tr><td>2026/10/18   <td>1.5      <td>Zing Fong  <td>增加了BaseMatrixTester::BlasTester
+ * <tr><td>2026/10/18   <td>1.6      <td>Zing Fong  <td>增加了BaseMatrixTester::BlockTester
+ * <tr><td>2026/10/18   <td>1.7      <td>Zing Fong  <td>增加了BaseMatrixTester::ArenaTester
+ * <tr><td>2026/10/18   <td>1.8      <td>Zing Fong  <td>增加了BaseMatrixTester::BackendTester
+ * <tr><td>2026/10/18   <td>1.9      <td>Zing Fong  <td>增加了BaseMatrixTester::PrecisionTester
+ * <tr><td>2026/10/18   <td>1.10     <td>Zing Fong  <td>增加了BaseMatrixTester::ExpTester和SinsTester
+ * <tr><td>2026/10/18   <td>1.11     <td>Zing Fong  <td>增加了SinsTester::FrameTester
+ * <tr><td>2026/10/18   <td>1.12     <td>Zing Fong  <td>ArenaTester按相对误差比较, 兼容BLAS后端
+ * <tr><td>2026/10/18   <td>1.13     <td>Zing Fong  <td>ProcessNoiseTester增加了时标抖动和CalcF一致性的检查
+ * <tr><td>2026/10/18   <td>1.14     <td>Zing Fong  <td>增加了GnssTester::PartialLambdaTester
+ * <tr><td>2026/10/18   <td>1.15     <td>Zing Fong  <td>增加了GnssTester::PipelineTester
+ * <tr><td>2026/10/18   <td>1.16     <td>Zing Fong  <td>增加了GnssTester::LambdaTester
+ * <tr><td>2026/10/18   <td>1.17     <td>Zing Fong  <td>增加了SinsTester::WindowTester
+ * <tr><td>2026/10/18   <td>1.18     <td>Zing Fong  <td>矩阵测试器共用随机矩阵和逐元素最大差的辅助函数
+ * <tr><td>2026/10/18   <td>1.19     <td>Zing Fong  <td>LambdaTester检查默认构造的LambdaSolver按需扩大工作区
  * </table>
  **********************************************************************************
  */
@@ -19,10 +38,27 @@
 // c/c++系统文件
 #include <iostream>
 // 其他库的 .h 文件
+#include <algorithm>
+#include <chrono>
+#include <thread>
 #include <vector>
 #include <cmath>
+#include <utility>
 
 // 本项目内 .h 文件
+#include "basetk/base_app.h"
+#include "basetk/base_arena.h"
+#include "basetk/base_profiler.h"
+#include "basetk/base_matrix.h"
+#include "basetk/base_pipeline.h"
+#include "basetk/base_time_slicer.h"
+#include "gnsstk/gnss_rtk_pipeline.h"
+#include "gnsstk/gnss_spp.h"
+#include "gnsstk/lambda.h"
+#include "sinstk/sins_app.h"
+#include "sinstk/sins_loose_coupled.h"
+#include "sinstk/sins_process_noise.h"
+#include "sinstk/sins_simulator.h"
 
 /**@brief       最大最小值测试器
  * @author      Zing Fong
@@ -120,3 +156,1488 @@ void BaseMathTester::AttitudeTransformationTester()
            (euler[1] - euler_result[1])*BaseSdc::kR2D,
            (euler[2] - euler_result[2])*BaseSdc::kR2D);
 }
+
+/**@brief       内存申请统计测试器
+ * @details     将lambda阶段标记为无内存申请并立即进入稳态, 检查:\n
+ * - 该阶段内不申请内存时没有违例\n
+ * - 该阶段内申请内存时记为违例\n
+ * - 嵌套的内层阶段申请内存时也记为违例\n
+ * 测试结束后取消标记。未以LOOSECOUPLED_ALLOC_TRACK编译时跳过。
+ * @return      0为通过, -1为失败
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int ProfilerTester::AllocTrackerTester()
+{
+#ifdef LC_ALLOC_TRACK
+    static void *volatile ptr = nullptr;  // volatile防止申请和释放被编译器优化掉
+    Profiler::SetAllocFree("lambda");
+    Profiler::SetAllocWarmup(0);
+    long base_num = Profiler::GetAllocViolationNum();
+    int ret = 0;
+    {
+        ProfileScope scope(ProfileStage::kLambda);
+    }
+    if(Profiler::GetAllocViolationNum() != base_num)
+    {
+        printf("alloc tracker: violation without allocation\n");
+        ret = -1;
+    }
+    {
+        ProfileScope scope(ProfileStage::kLambda);
+        ptr = ::operator new(64);
+        ::operator delete(ptr);
+    }
+    if(Profiler::GetAllocViolationNum() != base_num + 1)
+    {
+        printf("alloc tracker: allocation in allocation-free stage not detected\n");
+        ret = -1;
+    }
+    {
+        ProfileScope scope(ProfileStage::kLambda);
+        ProfileScope inner_scope(ProfileStage::kOutput);
+        ptr = ::operator new(64);
+        ::operator delete(ptr);
+    }
+    if(Profiler::GetAllocViolationNum() != base_num + 2)
+    {
+        printf("alloc tracker: allocation in nested stage not detected\n");
+        ret = -1;
+    }
+    {
+        ProfileScope scope(ProfileStage::kOutput);
+        ptr = ::operator new(64);
+        ::operator delete(ptr);
+    }
+    if(Profiler::GetAllocViolationNum() != base_num + 2)
+    {
+        printf("alloc tracker: violation outside allocation-free stage\n");
+        ret = -1;
+    }
+    Profiler::SetAllocFree("lambda", false);
+    printf("alloc tracker test %s\n", ret == 0 ? "passed" : "FAILED");
+    return ret;
+#else
+    printf("alloc tracker test skipped, build with LOOSECOUPLED_ALLOC_TRACK=ON\n");
+    return 0;
+#endif
+}
+
+/**@brief       配置文件读取测试器
+ * @details     写一个临时配置文件, 检查同一块分多处出现、重复参数、行内注释、;注释行、CRLF换行、
+ *              各类型的解析以及参数结构体的绑定读取
+ * @return      0为通过, -1为失败
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int ConfigTester::ReadConfigTester()
+{
+    const char *file_path = "config_tester.ini";
+    FILE *file_ptr = fopen(file_path, "w");
+    if(file_ptr == nullptr)
+        return -1;
+    fprintf(file_ptr, "[A]\r\nx=1\r\n; comment\r\n[B]\n  y = 2.5  # comment\n"
+                      "flag=Yes\n[A]\nz=abc def\nx=3\n");
+    fclose(file_ptr);
+    Config config{};
+    config.ReadConfig(file_path);
+    remove(file_path);
+
+    struct Params
+    {
+        int x = 0;
+        double y = 0.0;
+        bool flag = false;
+        std::string z{};
+        double w = 7.0;
+    } params{};
+    config.Resolve(params, ConfigBinding<Params, int>("A", "x", &Params::x),
+                   ConfigBinding<Params, double>("B", "y", &Params::y),
+                   ConfigBinding<Params, bool>("B", "flag", &Params::flag),
+                   ConfigBinding<Params, std::string>("A", "z", &Params::z),
+                   ConfigBinding<Params, double>("B", "w", &Params::w));
+
+    int ret = 0;
+    auto check = [&ret](const bool &ok, const char *name)
+    {
+        if(!ok)
+        {
+            printf("config test failed: %s\n", name);
+            ret = -1;
+        }
+    };
+    check(config.ReadInt("A", "x", 0) == 3, "repeated item");
+    check(config.ReadDouble("B", "y", 0.0) == 2.5, "inline comment");
+    check(config.ReadString("A", "z", "") == "abc def", "repeated section");
+    check(config.ReadString("A", "comment", "none") == "none", "comment line");
+    check(config.Find("C", "x") == nullptr, "missing section");
+    check(params.x == 3 && params.y == 2.5 && params.flag && params.z == "abc def",
+          "binding");
+    check(params.w == 7.0, "binding default");
+    printf("config test %s\n", ret == 0 ? "passed" : "FAILED");
+    return ret;
+}
+
+/**@brief       组合观测值与粗差探测测试器
+ * @details     按几何距离、电离层延迟和整周模糊度构造GPS和BDS的双频观测值, 检查:\n
+ *              1. IF组合消去电离层、GF组合等于模糊度之差加电离层项\n
+ *              2. 连续观测时MW平滑历元数递增, 第4历元给一颗卫星加1周周跳后该卫星不可用并重新平滑\n
+ *              3. 中断一个历元的卫星重新开始平滑, GLONASS卫星不可用
+ * @return      0为通过, -1为未通过
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int GnssTester::OutlierDetectorTester()
+{
+    struct SatInfo
+    {
+        Gnss sys;
+        int prn;
+        double lambda1, lambda2;
+        double f1, f2;
+    };
+    const SatInfo sats[] = {
+            {Gnss::kGps, 3, BaseSdc::kWavelengthL1, BaseSdc::kWavelengthL2,
+             BaseSdc::kFreqL1, BaseSdc::kFreqL2},
+            {Gnss::kGps, 17, BaseSdc::kWavelengthL1, BaseSdc::kWavelengthL2,
+             BaseSdc::kFreqL1, BaseSdc::kFreqL2},
+            {Gnss::kBds, 9, BaseSdc::kWavelengthB1, BaseSdc::kWavelengthB3,
+             BaseSdc::kFreqB1, BaseSdc::kFreqB3},
+            {Gnss::kBds, 33, BaseSdc::kWavelengthB1, BaseSdc::kWavelengthB3,
+             BaseSdc::kFreqB1, BaseSdc::kFreqB3},
+            {Gnss::kGlonass, 5, BaseSdc::kWavelengthL1, BaseSdc::kWavelengthL2,
+             BaseSdc::kFreqL1, BaseSdc::kFreqL2}};
+    const int sat_num = sizeof(sats)/sizeof(sats[0]);
+
+    int ret = 0;
+    auto check = [&ret](const bool &ok, const char *name, const int &epoch)
+    {
+        if(!ok)
+        {
+            printf("outlier detector test failed: %s, epoch %d\n", name, epoch);
+            ret = -1;
+        }
+    };
+
+    OutlierDetector detector{};
+    RawData raw_data{};
+    for(int epoch = 1; epoch <= 6; ++epoch)
+    {
+        EpochObs &obs = raw_data.epoch_obs;
+        obs.Clear();
+        for(int j = 0; j < sat_num; ++j)
+        {
+            if(j == 1 && epoch == 3)
+                continue;  // 中断一个历元
+            const SatInfo &sat = sats[j];
+            double rho = 2.2e7 + 1e4*j + 700.0*epoch;  // 几何距离(m)
+            double ion1 = 3.0 + 0.2*j + 0.01*epoch;  // 第一频点的电离层延迟(m)
+            double ion2 = ion1*sat.f1*sat.f1/(sat.f2*sat.f2);
+            double n1 = 1000.0 + j, n2 = 800.0 - j;  // 整周模糊度
+            if(j == 2 && epoch >= 4)
+                n1 += 1.0;  // 周跳
+            SatObs sat_obs{};
+            sat_obs.sys = sat.sys;
+            sat_obs.prn = sat.prn;
+            sat_obs.P[0] = rho + ion1;
+            sat_obs.P[1] = rho + ion2;
+            sat_obs.L[0] = (rho - ion1)/sat.lambda1 + n1;
+            sat_obs.L[1] = (rho - ion2)/sat.lambda2 + n2;
+            sat_obs.valid = true;
+            obs.AddSatObs(sat_obs);
+        }
+        detector.DetectOutlier(raw_data);
+        const EpochGfmw &gfmw = detector.get_cur_epoch();
+        check(gfmw.get_sat_num() == obs.get_sat_num(), "satellite number", epoch);
+
+        for(int j = 0; j < sat_num; ++j)
+        {
+            int index = gfmw.FindGfmwIndex(sats[j].prn, sats[j].sys);
+            if(j == 1 && epoch == 3)
+            {
+                check(index < 0, "missing satellite", epoch);
+                continue;
+            }
+            Gfmw sat_gfmw = gfmw.GetGfmw(index);
+            if(sats[j].sys == Gnss::kGlonass)
+            {
+                check(!sat_gfmw.valid && sat_gfmw.n == 0, "unsupported system", epoch);
+                continue;
+            }
+            double rho = 2.2e7 + 1e4*j + 700.0*epoch;
+            check(std::fabs(sat_gfmw.p_if - rho) < 1e-6, "pseudorange IF", epoch);
+            int expected_n = epoch;
+            if(j == 1)
+                expected_n = epoch < 3 ? epoch : epoch - 3;
+            if(j == 2)
+                expected_n = epoch < 4 ? epoch : epoch - 3;
+            check(sat_gfmw.n == expected_n, "smoothing count", epoch);
+            check(sat_gfmw.valid == !(j == 2 && epoch == 4), "outlier flag", epoch);
+        }
+    }
+    printf("outlier detector test %s\n", ret == 0 ? "passed" : "FAILED");
+    return ret;
+}
+
+/**@brief       法方程累加器测试器
+ * @details     随机生成GPS和BDS卫星的误差方程(没有GLONASS和Galileo), 与用BaseMatrix直接计算的
+ *              (BᵀPB)⁻¹BᵀPl、协因数阵和vᵀPv比较; 再检查观测值少于参数个数时求解失败
+ * @return      0为通过, -1为未通过
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int GnssTester::NormalEquationTester()
+{
+    std::mt19937 engine(20261018);
+    std::uniform_real_distribution<double> u(-1.0, 1.0);
+    const int obs_num = 12;
+    const int col_num = NormalEquation::kGeoParamNum + 2;  // GPS和BDS的钟差
+
+    NormalEquation normal_equation{};
+    normal_equation.Reset();
+    BaseMatrix B(obs_num, col_num), P(obs_num, obs_num), l(obs_num, 1);
+    for(int i = 0; i < obs_num; ++i)
+    {
+        double b[3] = {u(engine), u(engine), u(engine)};
+        Gnss sys = i%3 == 0 ? Gnss::kBds : Gnss::kGps;
+        double obs = 10.0*u(engine), weight = 1.5 + u(engine);
+        normal_equation.AddObs(b, sys, obs, weight);
+        for(int j = 0; j < 3; ++j)
+            B.write(i, j, b[j]);
+        B.write(i, sys == Gnss::kGps ? 3 : 4, 1.0);
+        P.write(i, i, weight);
+        l.write(i, 0, obs);
+    }
+    double x[NormalEquation::kMaxParamNum], q[NormalEquation::kMaxParamNum*NormalEquation::kMaxParamNum];
+    int ret = 0;
+    if(normal_equation.Solve(x) != 0 || normal_equation.Inverse(q) != 0)
+        ret = -1;
+
+    BaseMatrix Q = (B.Trans()*P*B).Inverse();
+    BaseMatrix X = Q*B.Trans()*P*l;
+    BaseMatrix V = B*X - l;
+    double vtpv = (V.Trans()*P*V).read(0, 0);
+    const int column[col_num] = {0, 1, 2, 3, 4};  // GPS钟差在第3列, BDS钟差在第4列
+    double max_diff = 0.0;
+    for(int i = 0; i < col_num; ++i)
+    {
+        max_diff = std::max(max_diff, std::fabs(x[column[i]] - X.read(i, 0)));
+        for(int j = 0; j < col_num; ++j)
+            max_diff = std::max(max_diff, std::fabs(
+                    q[column[i]*NormalEquation::kMaxParamNum + column[j]] - Q.read(i, j)));
+    }
+    if(max_diff > 1e-9 || std::fabs(normal_equation.get_vtpv() - vtpv) > 1e-9*vtpv ||
+       normal_equation.get_param_num() != col_num || x[5] != 0.0 || x[6] != 0.0)
+        ret = -1;
+
+    // 参数比观测值多
+    normal_equation.Reset();
+    double b[3] = {1.0, 0.0, 0.0};
+    for(int i = 0; i < 3; ++i)
+        normal_equation.AddObs(b, static_cast<Gnss>(i), 1.0, 1.0);
+    if(normal_equation.Solve(x) != -1 || normal_equation.Inverse(q) != -1)
+        ret = -1;
+
+    printf("normal equation test %s, max diff %.3e\n", ret == 0 ? "passed" : "FAILED",
+           max_diff);
+    return ret;
+}
+
+/**@brief       LAMBDA回归测试器
+ * @details     按固定公式生成4组浮点模糊度和协因数阵(维数4、8、12、6, 最后一组接近整数、ratio较大),
+ *              lambda()、复用同一工作区的LambdaSolver::Solve以及默认构造、按维数扩大工作区的LambdaSolver
+ *              都应与改为LambdaSolver之前的lambda()结果一致。
+ *              期望的最优、次优整数解和残差平方和由旧实现算出后写在这里
+ * @return      0为通过, -1为未通过
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int GnssTester::LambdaTester()
+{
+    /**@struct  LambdaCase
+     * @brief   一组输入参数和旧实现的结果
+     */
+    struct LambdaCase
+    {
+        int n;  // 模糊度维数
+        double scale;  // 协因数阵相关部分的比例
+        double frac;  // 浮点解偏离整数的幅度
+        std::vector<double> fixed;  // 最优、次优整数解, 各n个
+        double s[2];  // 最优、次优解的残差平方和
+    };
+    const LambdaCase cases[] = {
+            {4, 0.05, 0.37, {4, 9, 0, -9, 4, 10, 1, -8}, {6.2106514179642645, 10.267854860444585}},
+            {8, 0.05, 0.37, {5, 10, 1, -9, -7, 5, 9, -1, 4, 10, 1, -8, -6, 6, 9, -2},
+             {19.99287392785746, 24.186451092707728}},
+            {12, 0.05, 0.37, {4, 9, 0, -9, -6, 6, 10, -1, -10, -4, 6, 7, 5, 10, 1, -9, -7, 5, 9, -1, -10, -3, 7, 8},
+             {37.480624202454436, 39.380309093832693}},
+            {6, 0.002, 0.05, {4, 10, 1, -9, -6, 6, 4, 10, 1, -8, -6, 6}, {0.70495444272209662, 65.004068730151403}}};
+    const int max_n = 12;
+    LambdaSolver solver(max_n, 2);
+    LambdaSolver growing{};  // 依次遇到4、8、12、6维, 只在前三组扩大工作区
+    double a[max_n], Q[max_n*max_n], F[2*max_n], s[2];
+    int ret = 0;
+    for(const auto &a_case: cases)
+    {
+        const int n = a_case.n;
+        // Q = A·Aᵀ·scale + 0.01·I, 浮点解为整数加上偏离
+        for(int i = 0; i < n; ++i)
+        {
+            a[i] = std::round(10.0*sin(1.3*i + 0.4)) + a_case.frac*cos(2.1*i);
+            for(int j = 0; j < n; ++j)
+            {
+                double q = 0.0;
+                for(int k = 0; k < n; ++k)
+                    q += sin(0.7*i + 1.1*k + 0.2)*sin(0.7*j + 1.1*k + 0.2);
+                Q[i + j*n] = a_case.scale*q + (i == j ? 0.01 : 0.0);
+            }
+        }
+        for(int method = 0; method < 3; ++method)
+        {
+            int info = method == 0 ? lambda(n, 2, a, Q, F, s) :
+                       method == 1 ? solver.Solve(n, 2, a, Q, F, s) : growing.Solve(n, 2, a, Q, F, s);
+            double max_diff = 0.0;
+            for(int i = 0; i < 2*n; ++i)
+                max_diff = std::max(max_diff, std::fabs(F[i] - a_case.fixed[i]));
+            for(int i = 0; i < 2; ++i)
+                max_diff = std::max(max_diff, std::fabs(s[i] - a_case.s[i])/a_case.s[i]);
+            if(info != 0 || max_diff > 1e-9)
+            {
+                const char *name[] = {"lambda()", "Solve", "growing Solve"};
+                printf("lambda case n=%d %s: info %d, max diff %.3e\n", n, name[method], info, max_diff);
+                ret = -1;
+            }
+        }
+    }
+    if(growing.get_max_n() != max_n || growing.get_max_m() != 2 || solver.get_max_n() != max_n)
+        ret = -1;
+    
+    printf("lambda regression test %s\n", ret == 0 ? "passed" : "FAILED");
+    return ret;
+}
+
+/**@brief       部分模糊度固定测试器
+ * @details     6个模糊度, 其中一个方差大且浮点解偏离整数0.5周, 其余方差小、接近真值。检查:\n
+ *              1. 全部固定时最优与次优解只差在有偏的模糊度上, ratio检验不通过;\n
+ *              2. 部分固定剔除有偏的模糊度, 固定其余5个, ratio检验通过且固定为真值;\n
+ *              3. 未固定的模糊度等于以固定部分为条件的估值a_b - Q_bF·Q_FF⁻¹·(a_F - N_F)
+ * @return      0为通过, -1为未通过
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int GnssTester::PartialLambdaTester()
+{
+    const int n = 6, biased = 2;
+    const double ratio_threshold = 3.0;
+    const double truth[n] = {3.0, -2.0, 5.0, 1.0, 0.0, 7.0};
+    const double error[n] = {0.03, -0.02, 0.5, 0.01, -0.03, 0.02};
+    double Q[n*n], a[n], F[2*n], s[2];
+    for(int i = 0; i < n; ++i)
+    {
+        a[i] = truth[i] + error[i];
+        for(int j = 0; j < n; ++j)
+        {
+            double rho = pow(0.6, std::abs(i - j));
+            if(i == biased && j == biased)
+                Q[i + j*n] = 0.3;
+            else
+                Q[i + j*n] = (i == biased || j == biased ? 0.003 : 0.002)*rho;
+        }
+    }
+    
+    int ret = 0;
+    LambdaSolver solver(n, 2);
+    // 1. 全部固定
+    double full_ratio = solver.Solve(n, 2, a, Q, F, s) == 0 ? s[1]/s[0] : 0.0;
+    if(full_ratio >= ratio_threshold)
+        ret = -1;
+    
+    // 2. 部分固定
+    int fixed_num = solver.PartialSolve(n, a, Q, ratio_threshold, 2, F, s);
+    if(fixed_num != n - 1 || solver.get_fixed_num() != n - 1 || solver.get_ratio() < ratio_threshold)
+        ret = -1;
+    for(int i = 0; i < n; ++i)
+        if(i != biased && F[i] != truth[i])
+            ret = -1;
+    
+    // 3. 条件估值
+    BaseMatrix Q_ff(n - 1, n - 1), Q_bf(1, n - 1), d_f(n - 1, 1);
+    int index[n - 1];
+    for(int i = 0, k = 0; i < n; ++i)
+        if(i != biased)
+            index[k++] = i;
+    for(int i = 0; i < n - 1; ++i)
+    {
+        d_f.write(i, 0, a[index[i]] - truth[index[i]]);
+        Q_bf.write(0, i, Q[biased + index[i]*n]);
+        for(int j = 0; j < n - 1; ++j)
+            Q_ff.write(i, j, Q[index[i] + index[j]*n]);
+    }
+    double conditional = a[biased] - (Q_bf*Q_ff.Inverse()*d_f).read(0, 0);
+    double conditional_diff = std::fabs(F[biased] - conditional);
+    if(conditional_diff > 1e-9)
+        ret = -1;
+    
+    printf("partial lambda test %s, full ratio %.3f, partial ratio %.3f with %d fixed, "
+           "conditional diff %.3e\n", ret == 0 ? "passed" : "FAILED", full_ratio, solver.get_ratio(),
+           fixed_num, conditional_diff);
+    return ret;
+}
+
+/**@brief       RTK流水线测试器
+ * @details     1. BoundedQueue: 生产者经容量为2的队列按顺序送出, 关闭后Push失败、取空后Pop失败,
+ *                 阻塞在满队列上的Push在关闭时返回;\n
+ *              2. 回调给出合成的流动站和基站历元(1Hz), 基站缺少110~119s且125s状态异常, 流动站5s状态异常。
+ *                 检查输出按序号严格递增, 每个历元配对的基站与串行规则(不晚于流动站的最新基站, 状态正常且
+ *                 龄期不超过max_base_age)一致;\n
+ *              3. 流动站或基站的预处理中途返回-1时流水线正常结束, 输出的历元数正确
+ * @return      0为通过, -1为未通过
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int GnssTester::PipelineTester()
+{
+    int ret = 0;
+    // 1. 队列
+    {
+        BoundedQueue<int> queue(2);
+        std::thread producer([&queue]()
+                             {
+                                 for(int i = 0; i < 100; ++i)
+                                     queue.Push(i);
+                                 queue.Close();
+                             });
+        int item = 0, expect = 0;
+        while(queue.Pop(item))
+            if(item != expect++)
+                ret = -1;
+        producer.join();
+        if(expect != 100 || queue.Push(0))
+            ret = -1;
+        
+        BoundedQueue<int> full_queue(1);
+        full_queue.Push(0);
+        bool blocked_push = true;
+        std::thread blocked([&full_queue, &blocked_push]() { blocked_push = full_queue.Push(1); });
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        full_queue.Close();
+        blocked.join();
+        if(blocked_push || !full_queue.Pop(item) || item != 0 || full_queue.Pop(item))
+            ret = -1;
+    }
+    
+    // 2. 流水线, 基站时刻为-1表示没有配对的基站
+    const double t0 = 100.0, max_base_age = 3.0;
+    auto base_exists = [](const long &seq) { return seq < 10 || seq >= 20; };
+    auto run_case = [&](const long &rover_num, const long &base_num)
+    {
+        Config config{};
+        config.Set("RTK", "pipeline_queue_size", "2");
+        config.Set("RTK", "max_base_age", "3");
+        GnssRtkPipeline pipeline{};
+        pipeline.Init(config);
+        auto make_epoch = [t0](RecvEpoch &recv_epoch, const long &index, const int &status)
+        {
+            recv_epoch.t.week_ = 2000;
+            recv_epoch.t.sec_of_week_ = t0 + static_cast<double>(index);
+            recv_epoch.status = status;
+        };
+        auto rover_prepare = [&](RecvEpoch &recv_epoch, EpochArena &)
+        {
+            if(recv_epoch.seq >= rover_num)
+                return -1;
+            if(recv_epoch.seq%7 == 3)
+                std::this_thread::sleep_for(std::chrono::microseconds(200));  // 打乱各线程的节奏
+            make_epoch(recv_epoch, recv_epoch.seq, recv_epoch.seq == 5 ? 1 : 0);
+            return 0;
+        };
+        long base_index = 0;  // 基站历元对应的秒数, 跳过缺失的时段
+        auto base_prepare = [&](RecvEpoch &recv_epoch, EpochArena &)
+        {
+            while(!base_exists(base_index))
+                ++base_index;
+            if(base_index >= base_num)
+                return -1;
+            make_epoch(recv_epoch, base_index, base_index == 25 ? 1 : 0);
+            ++base_index;
+            return 0;
+        };
+        auto solve = [](RecvEpoch &rover, RecvEpoch *base, RtkResult &result, EpochArena &)
+        {
+            result.valid = base != nullptr;
+            result.pos[0] = base != nullptr ? base->t.sec_of_week_ : -1.0;
+            result.ratio = rover.t.sec_of_week_;
+            return 0;
+        };
+        std::vector<RtkResult> results;
+        long epoch_num = pipeline.Run(rover_prepare, base_prepare, solve,
+                                      [&results](const RtkResult &result) { results.push_back(result); });
+        
+        // 串行规则下的配对结果
+        int case_ret = epoch_num == rover_num && static_cast<long>(results.size()) == rover_num ? 0 : -1;
+        for(long k = 0; k < static_cast<long>(results.size()); ++k)
+        {
+            const auto &result = results[k];
+            double expect = -1.0;
+            long latest = -1;
+            for(long i = 0; i <= k && i < base_num; ++i)
+                if(base_exists(i))
+                    latest = i;
+            if(k != 5 && latest >= 0 && latest != 25 && static_cast<double>(k - latest) <= max_base_age)
+                expect = t0 + static_cast<double>(latest);
+            if(k == 5)
+                expect = 0.0;  // 流动站状态异常, 不进行解算
+            if(result.seq != k || result.t.sec_of_week_ != t0 + static_cast<double>(k) || result.pos[0] != expect)
+            {
+                printf("pipeline epoch %ld: seq %ld, base %.0f, expect %.0f\n", k, result.seq,
+                       result.pos[0], expect);
+                case_ret = -1;
+            }
+        }
+        if(case_ret != 0)
+            printf("pipeline case rover %ld, base %ld: %ld epochs\n", rover_num, base_num, epoch_num);
+        return case_ret;
+    };
+    if(run_case(40, 40) != 0)
+        ret = -1;
+    // 3. 中途结束: 流动站先结束时基站线程阻塞在满队列上, 需要由解算线程关闭队列唤醒
+    if(run_case(15, 40) != 0 || run_case(40, 5) != 0)
+        ret = -1;
+    
+    printf("pipeline test %s\n", ret == 0 ? "passed" : "FAILED");
+    return ret;
+}
+
+namespace
+{
+/**@brief       逐项累加泰勒级数求矩阵指数, 不缩放, 只用于范数较小的矩阵, 作为测试的参考值
+ * @param[in]   a           方阵
+ * @return      e^A
+ */
+BaseMatrix ExpBySeries(const BaseMatrix &a)
+{
+    const int n = a.get_row_num();
+    BaseMatrix result = BaseMatrix::eye(n), term = BaseMatrix::eye(n);
+    for(int k = 1; k < 200; ++k)
+    {
+        term = term*a*(1.0/k);
+        result += term;
+        double term_max = 0.0;
+        for(double a_term: term.get_mat())
+            term_max = std::max(term_max, std::fabs(a_term));
+        if(term_max < 1e-20)
+            break;
+    }
+    return result;
+}
+
+/**@brief       两矩阵逐元素的最大相对差, 分母为参考矩阵中绝对值最大的元素
+ * @param[in]   a           待比较的矩阵
+ * @param[in]   ref         参考矩阵
+ * @return      最大相对差, 行列数不一致时返回1
+ */
+double MaxRelativeDiff(const BaseMatrix &a, const BaseMatrix &ref)
+{
+    if(a.get_row_num() != ref.get_row_num() || a.get_col_num() != ref.get_col_num())
+        return 1.0;
+    double ref_max = 0.0, diff_max = 0.0;
+    for(int i = 0; i < ref.get_row_num(); ++i)
+        for(int j = 0; j < ref.get_col_num(); ++j)
+        {
+            ref_max = std::max(ref_max, std::fabs(ref.read(i, j)));
+            diff_max = std::max(diff_max, std::fabs(a.read(i, j) - ref.read(i, j)));
+        }
+    return ref_max > 0 ? diff_max/ref_max : diff_max;
+}
+
+/**@brief       随机矩阵, 元素在[-1, 1]内均匀分布, 预留了多余容量以检查按行跨度访问
+ * @param[in]   engine      随机数引擎
+ * @param[in]   row_num     行数
+ * @param[in]   col_num     列数
+ * @param[in]   with_zero   是否约有1/4的元素取零
+ * @return      随机矩阵
+ */
+BaseMatrix RandomMatrix(std::mt19937 &engine, const int &row_num, const int &col_num,
+                        const bool &with_zero = false)
+{
+    std::uniform_real_distribution<double> u(-1.0, 1.0);
+    BaseMatrix mat(1, 1);
+    mat.Reserve(row_num + 2, col_num + 3);
+    mat.set_row(row_num);
+    mat.set_col(col_num);
+    for(int i = 0; i < row_num; ++i)
+        for(int j = 0; j < col_num; ++j)
+            mat.write(i, j, (with_zero && engine()%4 == 0) ? 0.0 : u(engine));
+    return mat;
+}
+
+/**@brief       两矩阵逐元素的最大绝对差, 两者的精度可以不同
+ * @param[in]   a           待比较的矩阵
+ * @param[in]   b           参考矩阵
+ * @return      最大绝对差, 行列数不一致时返回1e10
+ */
+template<typename T, typename U>
+double MaxAbsDiff(const BaseMatrixT<T> &a, const BaseMatrixT<U> &b)
+{
+    if(a.get_row_num() != b.get_row_num() || a.get_col_num() != b.get_col_num())
+        return 1e10;
+    double max_diff = 0.0;
+    for(int i = 0; i < a.get_row_num(); ++i)
+        for(int j = 0; j < a.get_col_num(); ++j)
+            max_diff = std::max(max_diff, std::fabs(static_cast<double>(a.read(i, j)) -
+                                                    static_cast<double>(b.read(i, j))));
+    return max_diff;
+}
+}
+
+/**@brief       增删行列测试器
+ * @details     对同一个矩阵随机插入、删除行列, 与用二维数组维护的参考结果逐元素比较;
+ *              再检查带空余容量的矩阵参与加减乘、转置、求逆、赋值的结果与紧凑存储的矩阵一致
+ * @return      0为通过, -1为未通过
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int BaseMatrixTester::InsertEraseTester()
+{
+    std::mt19937 engine(20261018);
+    std::uniform_real_distribution<double> u(-1.0, 1.0);
+    std::vector<std::vector<double>> ref(4, std::vector<double>(3, 0.0));
+    BaseMatrix mat(4, 3);
+    for(int i = 0; i < 4; ++i)
+        for(int j = 0; j < 3; ++j)
+            mat.write(i, j, ref[i][j] = u(engine));
+
+    int ret = 0;
+    auto same = [&mat, &ref]()
+    {
+        if(mat.get_row_num() != static_cast<int>(ref.size()) ||
+           mat.get_col_num() != static_cast<int>(ref[0].size()))
+            return false;
+        for(int i = 0; i < mat.get_row_num(); ++i)
+            for(int j = 0; j < mat.get_col_num(); ++j)
+                if(mat.read(i, j) != ref[i][j])
+                    return false;
+        return true;
+    };
+    for(int step = 0; step < 400 && ret == 0; ++step)
+    {
+        const int row_num = static_cast<int>(ref.size());
+        const int col_num = static_cast<int>(ref[0].size());
+        const int op = static_cast<int>(engine()%4);
+        if(op == 0 && row_num < 40)
+        {
+            int aim = static_cast<int>(engine()%(row_num + 1));
+            std::vector<double> row(col_num, 0.0);
+            for(auto &a_row: row)
+                a_row = u(engine);
+            mat.InsertRow(row, aim);
+            ref.insert(ref.begin() + aim, row);
+        }
+        else if(op == 1 && col_num < 40)
+        {
+            int aim = static_cast<int>(engine()%(col_num + 1));
+            std::vector<double> col(row_num, 0.0);
+            for(int i = 0; i < row_num; ++i)
+            {
+                col[i] = u(engine);
+                ref[i].insert(ref[i].begin() + aim, col[i]);
+            }
+            mat.InsertCol(col, aim);
+        }
+        else if(op == 2 && row_num > 1)
+        {
+            int aim = static_cast<int>(engine()%row_num);
+            mat.EraseRow(aim);
+            ref.erase(ref.begin() + aim);
+        }
+        else if(op == 3 && col_num > 1)
+        {
+            int aim = static_cast<int>(engine()%col_num);
+            mat.EraseCol(aim);
+            for(auto &a_ref: ref)
+                a_ref.erase(a_ref.begin() + aim);
+        }
+        if(!same())
+        {
+            printf("matrix insert/erase test failed at step %d\n", step);
+            ret = -1;
+        }
+    }
+
+    // 带空余容量的矩阵参与运算
+    const int n = mat.get_row_num() < mat.get_col_num() ? mat.get_row_num() : mat.get_col_num();
+    while(mat.get_col_num() > n)
+        mat.EraseCol(mat.get_col_num() - 1);
+    while(mat.get_row_num() > n)
+        mat.EraseRow(mat.get_row_num() - 1);
+    for(int i = 0; i < n; ++i)
+        mat.write(i, i, mat.read(i, i) + n);  // 对角占优, 保证可逆
+    BaseMatrix compact(mat.get_mat(), n, n);
+    double max_diff = MaxAbsDiff(mat*mat + mat - mat*2.0,
+                                 compact*compact + compact - compact*2.0);
+    max_diff = std::max(max_diff, MaxAbsDiff(mat.Trans()*mat.Inverse(),
+                                             compact.Trans()*compact.Inverse()));
+    BaseMatrix assigned(1, 1);
+    assigned.Reserve(n + 5, n + 5);
+    assigned = mat;
+    assigned += compact;
+    assigned -= mat;
+    max_diff = std::max(max_diff, MaxAbsDiff(assigned, compact));
+    if(max_diff != 0.0 || mat.get_col_capacity() < mat.get_col_num() ||
+       assigned.get_col_capacity() != n + 5)
+        ret = -1;
+
+    printf("matrix insert/erase test %s\n", ret == 0 ? "passed" : "FAILED");
+    return ret;
+}
+
+/**@brief       Gemm、Syrk、Symm、Axpy、Scale与运算符结果对比, 并检查移动语义
+ * @details     参与运算的矩阵预留了多余容量, 同时检查按行跨度访问
+ * @return      0为通过, -1为不通过
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int BaseMatrixTester::BlasTester()
+{
+    std::mt19937 engine(20261018);
+    double max_diff = 0.0;
+
+    int ret = 0;
+    const int m = 5, n = 7, p = 4;
+    // 含零元素
+    auto a = RandomMatrix(engine, m, n, true), at = RandomMatrix(engine, n, m, true);
+    auto b = RandomMatrix(engine, n, p, true), bt = RandomMatrix(engine, p, n, true);
+    auto c0 = RandomMatrix(engine, m, p, true);
+    BaseMatrix c(1, 1);
+    for(int trans_a = 0; trans_a < 2; ++trans_a)
+        for(int trans_b = 0; trans_b < 2; ++trans_b)
+        {
+            const auto &op_a = trans_a ? at : a;
+            const auto &op_b = trans_b ? bt : b;
+            auto ref = (trans_a ? op_a.Trans() : op_a)*(trans_b ? op_b.Trans() : op_b)*0.5 +
+                       c0*2.0;
+            c = c0;
+            ret |= BaseMatrix::Gemm(0.5, op_a, trans_a, op_b, trans_b, 2.0, c);
+            max_diff = std::max(max_diff, MaxAbsDiff(c, ref));
+        }
+    BaseMatrix::Gemm(1.0, a, false, b, false, 0.0, c);  // β为0时重设行列数
+    max_diff = std::max(max_diff, MaxAbsDiff(c, a*b));
+
+    // Syrk结果严格对称
+    BaseMatrix s(1, 1);
+    BaseMatrix::Syrk(1.0, a, false, 0.0, s);
+    max_diff = std::max(max_diff, MaxAbsDiff(s, a*a.Trans()));
+    BaseMatrix::Syrk(1.0, a, true, 0.0, s);
+    max_diff = std::max(max_diff, MaxAbsDiff(s, a.Trans()*a));
+    for(int i = 0; i < n; ++i)
+        for(int j = 0; j < i; ++j)
+            if(s.read(i, j) != s.read(j, i))
+                ret = -1;
+
+    // Symm只读取A的下三角
+    auto sym = RandomMatrix(engine, n, n, true);
+    sym = sym + sym.Trans();
+    auto lower = sym;
+    for(int i = 0; i < n; ++i)
+        for(int j = i + 1; j < n; ++j)
+            lower.write(i, j, 1e3);
+    ret |= BaseMatrix::Symm(true, 1.0, lower, b, 0.0, c);
+    max_diff = std::max(max_diff, MaxAbsDiff(c, sym*b));
+    ret |= BaseMatrix::Symm(false, 1.0, lower, a, 0.0, c);
+    max_diff = std::max(max_diff, MaxAbsDiff(c, a*sym));
+
+    // Axpy、Scale
+    auto y = c0;
+    ret |= BaseMatrix::Axpy(-3.0, c0, y);
+    BaseMatrix::Scale(-0.5, y);
+    max_diff = std::max(max_diff, MaxAbsDiff(y, c0));
+
+    // 维数不匹配或结果与输入为同一对象时返回-1
+    if(BaseMatrix::Gemm(1.0, a, false, a, false, 0.0, c) != -1 ||
+       BaseMatrix::Gemm(1.0, a, false, b, false, 0.0, a) != -1 ||
+       BaseMatrix::Axpy(1.0, a, b) != -1)
+        ret = -1;
+
+    // 移动构造后源矩阵为空矩阵, 移动赋值后可以正常使用
+    auto src = a;
+    BaseMatrix moved(std::move(src));
+    max_diff = std::max(max_diff, MaxAbsDiff(moved, a));
+    if(src.get_row_num() != 0 || src.get_col_num() != 0)
+        ret = -1;
+    src = std::move(moved);
+    max_diff = std::max(max_diff, MaxAbsDiff(src, a));
+    src = b;
+    max_diff = std::max(max_diff, MaxAbsDiff(src, b));
+
+    if(max_diff > 1e-12)
+    {
+        printf("matrix BLAS max difference: %g\n", max_diff);
+        ret = -1;
+    }
+    printf("matrix BLAS test %s\n", ret == 0 ? "passed" : "FAILED");
+    return ret;
+}
+
+/**@brief       子矩阵视图的读写与逐元素read/write的结果对比
+ * @details     父矩阵预留了多余容量, 子矩阵按父矩阵的行跨度访问
+ * @return      0为通过, -1为不通过
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int BaseMatrixTester::BlockTester()
+{
+    std::mt19937 engine(20261018);
+    std::uniform_real_distribution<double> u(-1.0, 1.0);
+    const int n = 9;
+    BaseMatrix mat(n, n), ref(n, n), sub(3, 3);
+    mat.Reserve(n + 3, n + 5);
+    for(int i = 0; i < 3; ++i)
+        for(int j = 0; j < 3; ++j)
+            sub.write(i, j, u(engine));
+
+    int ret = 0;
+    // 固定大小: 赋值、+=、-=、数乘、单位阵
+    mat.block<3, 3>(0, 3) = sub;
+    mat.block<3, 3>(3, 3) += sub;
+    mat.block<3, 3>(3, 3) += sub;
+    mat.block<3, 3>(6, 0) -= sub;
+    mat.block<3, 3>(6, 0) *= 2.0;
+    mat.block<3, 3>(6, 6).setIdentity();
+    mat.block<3, 3>(0, 0) = mat.block<3, 3>(3, 3);  // 子矩阵之间复制
+    for(int i = 0; i < 3; ++i)
+        for(int j = 0; j < 3; ++j)
+        {
+            ref.write(i, 3 + j, sub.read(i, j));
+            ref.write(3 + i, 3 + j, sub.read(i, j) + sub.read(i, j));
+            ref.write(i, j, ref.read(3 + i, 3 + j));
+            ref.write(6 + i, j, -sub.read(i, j)*2.0);
+            ref.write(6 + i, 6 + j, i == j ? 1.0 : 0.0);
+        }
+    // 运行时大小: 与固定大小混用, 只读视图
+    const BaseMatrix &const_mat = mat;
+    BaseBlock<const double> row = const_mat.block(6, 0, 1, n);
+    mat.block(8, 0, 1, n) = row;
+    for(int j = 0; j < n; ++j)
+        ref.write(8, j, ref.read(6, j));
+    mat.block(0, 0, 2, 2) -= mat.block<2, 2>(7, 7);
+    for(int i = 0; i < 2; ++i)
+        for(int j = 0; j < 2; ++j)
+            ref.write(i, j, ref.read(i, j) - ref.read(7 + i, 7 + j));
+
+    for(int i = 0; i < n; ++i)
+        for(int j = 0; j < n; ++j)
+            if(mat.read(i, j) != ref.read(i, j) ||
+               mat.block<3, 3>(i/3*3, j/3*3)(i%3, j%3) != ref.read(i, j))
+                ret = -1;
+    auto copy = mat.block<3, 3>(0, 3).ToMatrix();
+    if(copy.get_row_num() != 3 || copy.get_col_num() != 3 || copy.read(2, 2) != sub.read(2, 2))
+        ret = -1;
+
+    // 行列数不一致时不修改
+    mat.block(0, 0, 3, 2) = sub;
+    if(mat.read(2, 1) != ref.read(2, 1))
+        ret = -1;
+#ifdef LC_BOUNDS_CHECK
+    mat.block<3, 3>(7, 7) = sub;  // 超出范围, 不修改
+    mat.block<3, 3>(0, 0)(3, 0) = 1.0;  // 下标越界, 不修改
+    if(mat.read(8, 8) != ref.read(8, 8) || mat.read(3, 0) != ref.read(3, 0))
+        ret = -1;
+#endif
+
+    printf("matrix block test %s\n", ret == 0 ? "passed" : "FAILED");
+    return ret;
+}
+
+/**@brief       临时区中的矩阵运算与全局堆结果对比, 并检查维数稳定后不再溢出
+ * @details     模拟单点定位: 每个历元卫星数在4~20之间变化, 用临时区计算最小二乘, 结果赋给长期保存的矩阵
+ * @return      0为通过, -1为不通过
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int BaseMatrixTester::ArenaTester()
+{
+    std::mt19937 engine(20261018);
+    std::uniform_real_distribution<double> u(-1.0, 1.0);
+    EpochArena arena(1024);  // 初始缓冲区故意取小, 检查扩大过程
+    BaseMatrix x_keep(5, 1);  // 长期保存的结果, 使用全局堆
+    int ret = 0;
+    long overflow_num = 0;
+    for(int epoch = 0; epoch < 34; ++epoch)
+    {
+        if(epoch == 17)
+            overflow_num = arena.get_overflow_num();  // 第一轮结束, 缓冲区已足够最大的历元
+        const int n = 4 + epoch%17;
+        BaseMatrix B(n, 5, &arena), P(n, n, &arena), L(n, 1, &arena);
+        BaseMatrix B_heap(n, 5), P_heap(n, n), L_heap(n, 1);
+        for(int i = 0; i < n; ++i)
+        {
+            for(int j = 0; j < 3; ++j)
+            {
+                double val = u(engine);
+                B.write(i, j, val);
+                B_heap.write(i, j, val);
+            }
+            B.write(i, 3 + i%2, 1.0);
+            B_heap.write(i, 3 + i%2, 1.0);
+            double l = 10.0*u(engine), p = 1.5 + u(engine);
+            L.write(i, 0, l);
+            L_heap.write(i, 0, l);
+            P.write(i, i, p);
+            P_heap.write(i, i, p);
+        }
+        BaseMatrix BTP = B.Trans()*P;
+        BaseMatrix X = (BTP*B).Inverse()*BTP*L;
+        BaseMatrix BTP_heap = B_heap.Trans()*P_heap;
+        BaseMatrix X_heap = (BTP_heap*B_heap).Inverse()*BTP_heap*L_heap;
+        if(BTP.get_resource() != &arena || X.get_resource() != &arena)
+            ret = -1;
+        x_keep = std::move(X);  // 内存资源不同, 复制元素
+        if(x_keep.get_resource() != std::pmr::get_default_resource())
+            ret = -1;
+        arena.Reset();
+        // 开启BLAS后端时两边缓冲区的对齐不同, 内核的累加次序可能不同, 按相对误差比较
+        for(int i = 0; i < 5; ++i)
+        {
+            double ref = X_heap.read(i, 0);
+            if(std::fabs(x_keep.read(i, 0) - ref) > 1e-12*std::max(1.0, std::fabs(ref)))
+                ret = -1;
+        }
+    }
+    if(arena.get_overflow_num() != overflow_num || arena.get_used() != 0 ||
+       arena.get_capacity() < arena.get_peak())
+    {
+        printf("arena overflow: %ld -> %ld, capacity: %zu, peak: %zu\n", overflow_num,
+               arena.get_overflow_num(), arena.get_capacity(), arena.get_peak());
+        ret = -1;
+    }
+
+    printf("matrix arena test %s\n", ret == 0 ? "passed" : "FAILED");
+    return ret;
+}
+
+/**@brief       内置实现与BLAS/LAPACK后端的结果对比
+ * @details     阈值取很大时全部使用内置实现, 取1时(定义LC_USE_BLAS)全部交给BLAS/LAPACK,
+ *              两种情况都与运算符写法的参考结果比较。矩阵预留了多余容量, 检查行跨度的传递
+ * @return      0为通过, -1为不通过
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int BaseMatrixTester::BackendTester()
+{
+    std::mt19937 engine(20261018);
+    double max_diff = 0.0;
+    
+    int ret = 0;
+    const int threshold = BaseMatrix::get_blas_threshold();
+    const int m = 37, n = 41, p = 29;
+    auto a = RandomMatrix(engine, m, n), at = RandomMatrix(engine, n, m);
+    auto b = RandomMatrix(engine, n, p), bt = RandomMatrix(engine, p, n);
+    auto c0 = RandomMatrix(engine, m, p);
+    auto half = RandomMatrix(engine, n, n);
+    auto spd = half*half.Trans() + BaseMatrix::eye(n)*static_cast<double>(n);
+    auto rhs = RandomMatrix(engine, n, 3);
+    for(int setting: {1 << 20, 1})
+    {
+        BaseMatrix::set_blas_threshold(setting);
+        BaseMatrix c(1, 1);
+        for(int trans_a = 0; trans_a < 2; ++trans_a)
+            for(int trans_b = 0; trans_b < 2; ++trans_b)
+            {
+                const auto &op_a = trans_a ? at : a;
+                const auto &op_b = trans_b ? bt : b;
+                BaseMatrix::set_blas_threshold(1 << 20);
+                auto ref = (trans_a ? op_a.Trans() : op_a)*(trans_b ? op_b.Trans() : op_b)*0.5 +
+                           c0*2.0;
+                BaseMatrix::set_blas_threshold(setting);
+                c = c0;
+                ret |= BaseMatrix::Gemm(0.5, op_a, trans_a, op_b, trans_b, 2.0, c);
+                max_diff = std::max(max_diff, MaxAbsDiff(c, ref));
+            }
+        BaseMatrix::Gemm(1.0, a, false, b, false, 0.0, c);  // 运算符乘法与β为0的Gemm
+        max_diff = std::max(max_diff, MaxAbsDiff(a*b, c));
+        
+        // Syrk、Symm只读取下三角
+        BaseMatrix s(1, 1);
+        ret |= BaseMatrix::Syrk(1.0, a, true, 0.0, s);
+        max_diff = std::max(max_diff, MaxAbsDiff(s, a.Trans()*a));
+        for(int i = 0; i < n; ++i)
+            for(int j = 0; j < i; ++j)
+                if(s.read(i, j) != s.read(j, i))
+                    ret = -1;
+        auto lower = spd;
+        for(int i = 0; i < n; ++i)
+            for(int j = i + 1; j < n; ++j)
+                lower.write(i, j, 1e3);
+        ret |= BaseMatrix::Symm(true, 1.0, lower, b, 0.0, c);
+        max_diff = std::max(max_diff, MaxAbsDiff(c, spd*b));
+        ret |= BaseMatrix::Symm(false, 1.0, lower, a, 0.0, c);
+        max_diff = std::max(max_diff, MaxAbsDiff(c, a*spd));
+        
+        // 求逆、解方程、Cholesky分解
+        max_diff = std::max(max_diff, MaxAbsDiff(spd*spd.Inverse(), BaseMatrix::eye(n)));
+        auto x = spd.Solve(rhs);
+        max_diff = std::max(max_diff, MaxAbsDiff(spd*x, rhs));
+        max_diff = std::max(max_diff, MaxAbsDiff(x, spd.Inverse()*rhs));
+        auto l = RandomMatrix(engine, 2, 2);
+        ret |= spd.Cholesky(l);
+        max_diff = std::max(max_diff, MaxAbsDiff(l*l.Trans(), spd));
+        for(int i = 0; i < n; ++i)
+            for(int j = i + 1; j < n; ++j)
+                if(l.read(i, j) != 0.0)
+                    ret = -1;
+        if((BaseMatrix::eye(n)*-1.0).Cholesky(l) != -1)  // 不正定
+            ret = -1;
+    }
+    BaseMatrix::set_blas_threshold(threshold);
+    
+    if(max_diff > 1e-9)
+    {
+        printf("matrix backend max difference: %g\n", max_diff);
+        ret = -1;
+    }
+    printf("matrix backend test %s\n", ret == 0 ? "passed" : "FAILED");
+    return ret;
+}
+
+/**@brief       单精度矩阵和姿态运算测试器
+ * @details     float的运算结果与double比较, 两种后端(内置实现与BLAS/LAPACK)各测一遍。
+ *              矩阵元素在[-1, 1]内, 相对误差应在单精度舍入误差的量级
+ * @return      0为通过, -1为不通过
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int BaseMatrixTester::PrecisionTester()
+{
+    std::mt19937 engine(20261018);
+    std::uniform_real_distribution<double> u(-1.0, 1.0);
+    double max_diff = 0.0;
+    
+    int ret = 0;
+    const int threshold = BaseMatrix::get_blas_threshold();
+    const int n = 21;
+    auto a = RandomMatrix(engine, n, n), b = RandomMatrix(engine, n, n);
+    auto spd = a*a.Trans() + BaseMatrix::eye(n)*static_cast<double>(n);
+    auto rhs = RandomMatrix(engine, n, 3);
+    auto a_f = a.Cast<float>(), b_f = b.Cast<float>(), spd_f = spd.Cast<float>(),
+            rhs_f = rhs.Cast<float>();
+    max_diff = std::max(max_diff, MaxAbsDiff(a_f, a));
+    for(int setting: {1 << 20, 1})
+    {
+        BaseMatrix::set_blas_threshold(setting);
+        BaseMatrixF c_f(1, 1);
+        ret |= BaseMatrixF::Gemm(1.0f, a_f, false, b_f, true, 0.0f, c_f);
+        max_diff = std::max(max_diff, MaxAbsDiff(c_f, a*b.Trans()));
+        ret |= BaseMatrixF::Symm(false, 1.0f, spd_f, a_f, 0.0f, c_f);
+        max_diff = std::max(max_diff, MaxAbsDiff(c_f, a*spd));
+        max_diff = std::max(max_diff, MaxAbsDiff(spd_f.Inverse()*float(n), spd.Inverse()*double(n)));
+        max_diff = std::max(max_diff, MaxAbsDiff(spd_f.Solve(rhs_f), spd.Solve(rhs)));
+        BaseMatrixF l_f(1, 1);
+        BaseMatrix l(1, 1);
+        ret |= spd_f.Cholesky(l_f);
+        ret |= spd.Cholesky(l);
+        max_diff = std::max(max_diff, MaxAbsDiff(l_f, l));
+    }
+    BaseMatrix::set_blas_threshold(threshold);
+    
+    // 四元数递推: 每步转动约1e-3rad, 单精度与双精度的姿态差应远小于1e-4rad
+    std::vector<double> q = BaseMath::Euler2Quaternion({0.1, -0.2, 1.0});
+    std::vector<float> q_f(q.begin(), q.end());
+    for(int i = 0; i < 1000; ++i)
+    {
+        std::vector<double> phi = {1e-3*u(engine), 1e-3*u(engine), 1e-3*u(engine)};
+        std::vector<float> phi_f(phi.begin(), phi.end());
+        q = BaseMath::QuaternionMul(q, BaseMath::RotationVec2Quaternion(phi));
+        q_f = BaseMath::QuaternionMul(q_f, BaseMath::RotationVec2Quaternion(phi_f));
+    }
+    max_diff = std::max(max_diff, MaxAbsDiff(BaseMath::Quaternion2RotationMat(q_f),
+                                             BaseMath::Quaternion2RotationMat(q)));
+    
+    if(max_diff > 1e-4)
+    {
+        printf("single precision max difference: %g\n", max_diff);
+        ret = -1;
+    }
+    printf("single precision test %s, max difference %g\n",
+           ret == 0 ? "passed" : "FAILED", max_diff);
+    return ret;
+}
+
+/**@brief       矩阵指数测试器, 与不缩放的泰勒级数比较, 并检查e^A·e^(-A) = I
+ * @return      0为通过, -1为不通过
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int BaseMatrixTester::ExpTester()
+{
+    std::mt19937 engine(20261018);
+    std::uniform_real_distribution<double> u(-1.0, 1.0);
+    int ret = 0;
+    for(double scale: {1e-3, 0.1, 1.0})
+    {
+        const int n = 12;
+        BaseMatrix a(n, n);
+        for(int i = 0; i < n; ++i)
+            for(int j = 0; j < n; ++j)
+                a.write(i, j, scale*u(engine));
+        auto exp_a = a.Exp();
+        double series_diff = MaxRelativeDiff(exp_a, ExpBySeries(a));
+        double inverse_diff = MaxRelativeDiff(exp_a*(a*-1.0).Exp(), BaseMatrix::eye(n));
+        if(series_diff > 1e-12 || inverse_diff > 1e-12)
+            ret = -1;
+        printf("scale %g: difference from series %g, e^A·e^(-A) - I %g\n",
+               scale, series_diff, inverse_diff);
+    }
+    BaseMatrix zero(4, 4);
+    if(MaxRelativeDiff(zero.Exp(), BaseMatrix::eye(4)) != 0.0)
+        ret = -1;
+    printf("matrix exponential test %s\n", ret == 0 ? "passed" : "FAILED");
+    return ret;
+}
+
+/**@brief       Van Loan离散化与Qd缓存测试器
+ * @details     1. Φ与泰勒级数求得的e^(F·Δt)比较, Qd与Simpson积分∫e^(F·s)·G·Q·Gᵀ·e^(Fᵀ·s)ds比较,
+ *                 被积函数中的指数同样用泰勒级数计算;\n
+ *              2. 缓存的Qd_b旋转到n系后, 与直接对n系模型R·F_b·Rᵀ、R·G·Q·Gᵀ·Rᵀ做Van Loan的结果比较;\n
+ *              3. 间隔有微秒级抖动时不增加缓存项, 按间隔缩放后与该间隔的精确解比较;
+ *                 间隔不同时增加缓存项, 更新噪声参数后缓存清空;\n
+ *              4. 相关时间不为3600s时, 滤波的CalcF与过程噪声模型R·F_b·Rᵀ的非零元素一致, 由两者求得的Φ一致
+ * @return      0为通过, -1为不通过
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int SinsTester::ProcessNoiseTester()
+{
+    using Noise = SinsProcessNoise<StateLayout<21>>;
+    const int n = 21;
+    const double &D2R = BaseSdc::kD2R;
+    ImuNoise noise{0.1*D2R/60.0, 0.1/60.0, 50.0*D2R/3600.0, 250.0*1e-5, 1000e-6, 1000e-6, 3600.0};
+    int ret = 0;
+    
+    // 1. 与级数和数值积分比较, 间隔取到1s使二阶以上的项足够大
+    Noise process_noise{};
+    process_noise.SetNoise(noise);
+    BaseMatrix f, g_q_gt, phi, qd;
+    process_noise.BuildModel(f, g_q_gt);
+    for(double dt: {0.005, 1.0})
+    {
+        Noise::VanLoan(f, g_q_gt, dt, phi, qd);
+        const int step_num = 200;  // Simpson积分的区间数, 须为偶数
+        const double h = dt/step_num;
+        BaseMatrix integral(n, n);
+        for(int k = 0; k <= step_num; ++k)
+        {
+            auto phi_s = ExpBySeries(f*(k*h));
+            double weight = (k == 0 || k == step_num) ? 1.0 : (k % 2 == 1 ? 4.0 : 2.0);
+            integral += phi_s*g_q_gt*phi_s.Trans()*(weight*h/3.0);
+        }
+        double phi_diff = MaxRelativeDiff(phi, ExpBySeries(f*dt));
+        double qd_diff = MaxRelativeDiff(qd, integral);
+        if(phi_diff > 1e-12 || qd_diff > 1e-9)
+            ret = -1;
+        printf("dt %g: Φ difference %g, Qd difference %g\n", dt, phi_diff, qd_diff);
+    }
+    
+    // 2. 旋转后的缓存与n系模型直接离散化比较
+    const double dt = 0.005;
+    auto c_b_n = BaseMath::Quaternion2RotationMat(BaseMath::Euler2Quaternion({0.3, -0.5, 2.0}));
+    BaseMatrix rotation = BaseMatrix::eye(n);
+    for(int k = 0; k < 3; ++k)
+        rotation.block<3, 3>(3*k, 3*k) = c_b_n;
+    Noise::VanLoan(rotation*f*rotation.Trans(), rotation*g_q_gt*rotation.Trans(), dt, phi, qd);
+    double rotation_diff = MaxRelativeDiff(process_noise.CalcQd(dt, c_b_n), qd);
+    if(rotation_diff > 1e-12)
+        ret = -1;
+    printf("rotated cache difference %g\n", rotation_diff);
+    
+    // 3. 缓存, 抖动取±2μs
+    std::mt19937 engine(20261018);
+    std::uniform_real_distribution<double> jitter(-2e-6, 2e-6);
+    double jitter_diff = 0.0;
+    for(int k = 0; k < 1000; ++k)
+    {
+        const double dt_k = dt + jitter(engine);
+        const BaseMatrix &qd_k = process_noise.CalcQd(dt_k, c_b_n);
+        if(k%100 != 0)
+            continue;
+        Noise::VanLoan(rotation*f*rotation.Trans(), rotation*g_q_gt*rotation.Trans(), dt_k, phi, qd);
+        jitter_diff = std::max(jitter_diff, MaxRelativeDiff(qd_k, qd));
+    }
+    int size_same = process_noise.get_cache_size();
+    process_noise.CalcQd(0.01, c_b_n);
+    int size_new = process_noise.get_cache_size();
+    process_noise.SetNoise(noise);
+    // 按间隔缩放只补偿一阶项, 位置与速度的互相关为二阶项, 残差约为抖动比例(4e-4)乘其与最大元素之比
+    if(jitter_diff > 1e-5 || size_same != 1 || size_new != 2 || process_noise.get_cache_size() != 0)
+        ret = -1;
+    printf("jittered interval difference %g, cache size %d, %d, %d after reset\n", jitter_diff, size_same,
+           size_new, process_noise.get_cache_size());
+    
+    // 4. 滤波的F阵与过程噪声模型, 相关时间取0.25h
+    Config config{};
+    config.Set("LC", "corr_time", "0.25");
+    config.Set("LC", "qd_model", "van_loan");
+    StateInfo init_state{};
+    init_state.time = 1000.0;
+    init_state.blh = {30.5*D2R, 114.3*D2R, 20.0};
+    init_state.v_ned = {3.0, -2.0, 0.1};
+    init_state.q = BaseMath::Euler2Quaternion(std::vector<double>{0.3, -0.5, 2.0});
+    init_state.c_b_n = BaseMath::Quaternion2RotationMat(init_state.q);
+    init_state.xyz = BaseMath::Blh2Xyz(init_state.blh);
+    SinsLooseCoupledT<double, 21> lc{};
+    lc.Init(config, init_state);
+    ImuData imu_data{};
+    imu_data.t = init_state.time + dt;
+    imu_data.gyro = {0.01*dt, -0.02*dt, 0.05*dt};
+    imu_data.acc = {0.5*dt, 0.2*dt, -9.8*dt};
+    auto f_lc = lc.CalcF(imu_data);
+    lc.process_noise_.BuildModel(f, g_q_gt);
+    rotation = BaseMatrix::eye(n);
+    for(int k = 0; k < 3; ++k)
+        rotation.block<3, 3>(3*k, 3*k) = lc.GetCbNav();
+    auto f_n = rotation*f*rotation.Trans();
+    BaseMatrix f_masked(n, n);  // 只保留模型中的非零元素, 其余为随导航状态变化的项
+    for(int i = 0; i < n; ++i)
+        for(int j = 0; j < n; ++j)
+            if(f_n.read(i, j) != 0.0)
+                f_masked.write(i, j, f_lc.read(i, j));
+    double f_diff = MaxRelativeDiff(f_masked, f_n);
+    Noise::VanLoan(f_n, rotation*g_q_gt*rotation.Trans(), 1.0, phi, qd);
+    double phi_diff = MaxRelativeDiff(phi, ExpBySeries(f_masked));
+    if(lc.process_noise_.get_noise().corr_time != 900.0 || f_diff > 1e-12 || phi_diff > 1e-12)
+        ret = -1;
+    printf("corr time %g s: CalcF difference %g, Φ difference %g\n", lc.process_noise_.get_noise().corr_time,
+           f_diff, phi_diff);
+    
+    printf("process noise test %s\n", ret == 0 ? "passed" : "FAILED");
+    return ret;
+}
+
+/**@brief       NED与ECEF两种坐标系的机械编排和松组合交叉检验
+ * @details     1. 同一组IMU增量(静止、加速、转弯、横滚摇摆)分别送入两种机械编排, 每秒比较位置、速度和姿态;
+ *                 两者只有重力模型(CalcGn与CalcGeXyz)和离散化的差别, 差异应远小于惯导本身的误差;\n
+ *              2. 无误差增量经NED机械编排得到真值, 叠加零偏后送入两种松组合滤波, 每秒用真值位置做量测更新,
+ *                 比较两者的位置、速度和姿态, 并检查ECEF滤波相对真值的误差
+ * @return      0为通过, -1为不通过
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int SinsTester::FrameTester()
+{
+    const double &D2R = BaseSdc::kD2R;
+    const double dt = 0.005;
+    const int epoch_num = 24000;  // 120s
+    int ret = 0;
+    
+    StateInfo init_state{};
+    init_state.time = 1000.0;
+    init_state.blh = {30.5*D2R, 114.3*D2R, 20.0};
+    init_state.q = BaseMath::Euler2Quaternion(std::vector<double>{0.0, 0.0, 30.0*D2R});
+    init_state.c_b_n = BaseMath::Quaternion2RotationMat(init_state.q);
+    init_state.xyz = BaseMath::Blh2Xyz(init_state.blh);
+    
+    // 静止时的比力和角速度, 之后按时段叠加机动
+    auto c_n_b = init_state.c_b_n.Trans();
+    auto g_n = BaseMath::CalcGn(init_state.blh);
+    const double &omega_e = BaseSdc::wgs84.kOmega;
+    auto f_static = (c_n_b*BaseMatrix({-g_n[0], -g_n[1], -g_n[2]}, 3, 1)).get_mat();
+    auto omega_static = (c_n_b*BaseMatrix({omega_e*cos(init_state.blh[0]), 0.0,
+                                           -omega_e*sin(init_state.blh[0])}, 3, 1)).get_mat();
+    auto make_imu = [&](const int &k)
+    {
+        double t = k*dt;
+        ImuData imu_data{};
+        imu_data.t = init_state.time + t;
+        auto f_b = f_static, omega_b = omega_static;
+        if(t >= 20 && t < 40)
+            f_b[0] += 1.0;
+        if(t >= 40 && t < 70)
+        {
+            omega_b[2] += 0.05;
+            f_b[1] += 1.0;
+        }
+        if(t >= 70 && t < 90)
+        {
+            f_b[0] -= 0.5;
+            omega_b[0] += 0.1*sin(t);
+        }
+        for(int i = 0; i < 3; ++i)
+        {
+            imu_data.gyro[i] = omega_b[i]*dt;
+            imu_data.acc[i] = f_b[i]*dt;
+        }
+        return imu_data;
+    };
+    // 两个状态的位置(m)、速度(m/s)、姿态(rad)差
+    auto state_diff = [](const StateInfo &a, const StateInfo &b)
+    {
+        std::vector<double> diff(3, 0.0);
+        diff[0] = BaseMath::Norm(BaseMatrix::VectorSub(a.xyz, b.xyz));
+        diff[1] = BaseMath::Norm(BaseMatrix::VectorSub(a.v_ned, b.v_ned));
+        // 小角度时取反对称部分, 避免acos在1附近的截断
+        auto c = a.c_b_n*b.c_b_n.Trans();
+        diff[2] = 0.5*BaseMath::Norm(std::vector<double>{c.read(2, 1) - c.read(1, 2), c.read(0, 2) - c.read(2, 0),
+                                                          c.read(1, 0) - c.read(0, 1)});
+        return diff;
+    };
+    
+    // 1. 机械编排
+    SinsMechanization ned{};
+    SinsMechanizationEcef ecef{};
+    ned.Init(init_state);
+    ecef.Init(init_state);
+    std::vector<double> mech_max(3, 0.0);
+    for(int k = 0; k <= epoch_num; ++k)
+    {
+        auto imu_data = make_imu(k);
+        ned.ImuMechanization(imu_data);
+        ecef.ImuMechanization(imu_data);
+        if(k%200 != 0)
+            continue;
+        auto diff = state_diff(ned.get_cur_state(), ecef.get_cur_state());
+        for(int i = 0; i < 3; ++i)
+            mech_max[i] = std::max(mech_max[i], diff[i]);
+    }
+    auto travel = BaseMath::Norm(BaseMatrix::VectorSub(ned.get_cur_state().xyz, init_state.xyz));
+    if(mech_max[0] > 0.03 || mech_max[1] > 5e-4 || mech_max[2] > 6e-8)
+        ret = -1;
+    printf("mechanization over %.0f m: max difference pos %.3g m, vel %.3g m/s, att %.3g rad\n",
+           travel, mech_max[0], mech_max[1], mech_max[2]);
+    
+    // 2. 松组合
+    const std::vector<double> gyro_bias = {10.0*D2R/3600, -8.0*D2R/3600, 5.0*D2R/3600};
+    const std::vector<double> acc_bias = {0.02, -0.01, 0.015};
+    Config config{};
+    SinsMechanization truth{};
+    SinsLooseCoupledT<double, 15> lc_ned{};
+    SinsLooseCoupledT<double, 15, NavFrame::kEcef> lc_ecef{};
+    truth.Init(init_state);
+    lc_ned.Init(config, init_state);
+    lc_ecef.Init(config, init_state);
+    std::vector<double> pos_std = {0.05, 0.05, 0.1};
+    std::vector<double> lc_max(3, 0.0);
+    for(int k = 0; k <= epoch_num; ++k)
+    {
+        auto imu_data = make_imu(k);
+        truth.ImuMechanization(imu_data);
+        for(int i = 0; i < 3; ++i)
+        {
+            imu_data.gyro[i] += gyro_bias[i]*dt;
+            imu_data.acc[i] += acc_bias[i]*dt;
+        }
+        lc_ned.Predict(imu_data);
+        lc_ecef.Predict(imu_data);
+        if(k%200 != 0 || k == 0)
+            continue;
+        auto gnss_state = truth.get_cur_state();
+        lc_ned.Update(gnss_state, pos_std);
+        lc_ecef.Update(gnss_state, pos_std);
+        auto diff = state_diff(lc_ned.get_state(), lc_ecef.get_state());
+        for(int i = 0; i < 3; ++i)
+            lc_max[i] = std::max(lc_max[i], diff[i]);
+    }
+    auto ned_error = state_diff(lc_ned.get_state(), truth.get_cur_state());
+    auto ecef_error = state_diff(lc_ecef.get_state(), truth.get_cur_state());
+    if(lc_max[0] > 4e-5 || lc_max[1] > 2e-5 || lc_max[2] > 3e-7 ||
+       ecef_error[0] > 0.05 || ecef_error[1] > 0.01)
+        ret = -1;
+    printf("loose coupled: max difference pos %.3g m, vel %.3g m/s, att %.3g rad\n",
+           lc_max[0], lc_max[1], lc_max[2]);
+    printf("final error NED pos %.3g m, vel %.3g m/s; ECEF pos %.3g m, vel %.3g m/s\n",
+           ned_error[0], ned_error[1], ecef_error[0], ecef_error[1]);
+    
+    printf("frame test %s\n", ret == 0 ? "passed" : "FAILED");
+    return ret;
+}
+
+/**@brief       分时段解算与顺序解算的比较
+ * @details     仿真500s数据, 剖面每130s一个循环, 循环中掉头180°后静止30s。
+ *              窗口长200s、重叠70s, 第二个窗口的预热段从130s开始, 此时载体静止且航向与配置的初始航向相差180°,
+ *              需要在重叠段内运动中对准。检查各拼接处一致性没有超过阈值,
+ *              以及拼接结果与从头顺序解算的位置差和航向差
+ * @return      0为通过, -1为不通过
+ * @author      Zing Fong
+ * @date        2026/10/18
+ */
+int SinsTester::WindowTester()
+{
+    const double &R2D = BaseSdc::kR2D;
+    const char *imu_file_path = "window_tester_imu.bin";
+    const char *gnss_file_path = "window_tester_gnss.pos";
+    const char *truth_file_path = "window_tester_truth.txt";
+    Config config{};
+    config.Set("SINS", "imu_file_path", imu_file_path);
+    config.Set("SINS", "imu_file_format", "binary");
+    config.Set("SINS", "init_time", "1000");
+    config.Set("SINS", "init_lat", "30.5");
+    config.Set("SINS", "init_lon", "114.3");
+    config.Set("SINS", "init_h", "20");
+    config.Set("LC", "gnss_file_path", gnss_file_path);
+    config.Set("SIM", "truth_file_path", truth_file_path);
+    config.Set("SIM", "duration", "500");
+    config.Set("SIM", "imu_rate", "100");
+    config.Set("SIM", "profile", "30,0,0;10,1,0;30,0,0;20,0,9;30,0,0;10,-1,0");
+    config.Set("BASE", "window_length", "200");
+    config.Set("BASE", "window_overlap", "70");
+    SinsSimulator simulator{};
+    if(simulator.Init(config) != 0 || simulator.Run() < 0)
+    {
+        printf("window test FAILED: cannot simulate data\n");
+        return -1;
+    }
+    
+    SinsApp sins_app{};
+    sins_app.Init(config, true);
+    TimeSlicer time_slicer{};
+    time_slicer.Init(config);
+    double t_begin{}, t_end{};
+    std::vector<SliceEpoch> sliced;
+    int ret = sins_app.GetTimeSpan(t_begin, t_end);
+    if(ret == 0)
+    {
+        time_slicer.Run(t_begin, t_end,
+                        [&sins_app](const TimeWindow &window)
+                        {
+                            return sins_app.RunWindow(window);
+                        },
+                        [&sliced](const SliceEpoch &epoch)
+                        {
+                            sliced.push_back(epoch);
+                        });
+    }
+    TimeWindow whole{};
+    whole.warm_begin = whole.begin = t_begin;
+    whole.end = t_end;
+    auto sequential = sins_app.RunWindow(whole);
+    remove(imu_file_path);
+    remove(gnss_file_path);
+    remove(truth_file_path);
+    
+    int bad_seam = time_slicer.PrintReport();
+    double max_pos_diff = 0.0, max_yaw_diff = 0.0;
+    if(ret != 0 || sliced.size() != sequential.size())
+        ret = -1;
+    else
+    {
+        for(size_t i = 0; i < sliced.size(); ++i)
+        {
+            if(fabs(sliced[i].t - sequential[i].t) > 1e-6)
+            {
+                ret = -1;
+                break;
+            }
+            double dx = sliced[i].xyz[0] - sequential[i].xyz[0];
+            double dy = sliced[i].xyz[1] - sequential[i].xyz[1];
+            double dz = sliced[i].xyz[2] - sequential[i].xyz[2];
+            max_pos_diff = std::max(max_pos_diff, sqrt(dx*dx + dy*dy + dz*dz));
+            double yaw_diff = remainder(sliced[i].att[2] - sequential[i].att[2], 2*BaseSdc::kPi);
+            max_yaw_diff = std::max(max_yaw_diff, fabs(yaw_diff));
+        }
+    }
+    if(bad_seam != 0 || max_pos_diff > 0.1 || max_yaw_diff*R2D > 1.0)
+        ret = -1;
+    printf("%zu sliced epochs, %zu sequential epochs: max difference pos %.3g m, yaw %.3g deg\n",
+           sliced.size(), sequential.size(), max_pos_diff, max_yaw_diff*R2D);
+    
+    printf("window test %s\n", ret == 0 ? "passed" : "FAILED");
+    return ret;
+}
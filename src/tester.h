@@ -10,6 +10,14 @@
  * <table>
  * <tr><th>Date         <th>Version  <th>Author     <th>Description
  * <tr><td>2022/6/10    <td>1.0      <td>Zing Fong  <td>Initialize
+ * <tr><td>2026/10/18   <td>1.1      <td>Zing Fong  <td>增加了ProfilerTester
+ * <tr><td>2026/10/18   <td>1.2      <td>Zing Fong  <td>增加了ConfigTester
+ * <tr><td>2026/10/18   <td>1.3      <td>Zing Fong  <td>增加了BaseMatrixTester::PrecisionTester
+ * <tr><td>2026/10/18   <td>1.4      <td>Zing Fong  <td>增加了BaseMatrixTester::ExpTester和SinsTester
+ * <tr><td>2026/10/18   <td>1.5      <td>Zing Fong  <td>增加了GnssTester::PartialLambdaTester
+ * <tr><td>2026/10/18   <td>1.6      <td>Zing Fong  <td>增加了GnssTester::PipelineTester
+ * <tr><td>2026/10/18   <td>1.7      <td>Zing Fong  <td>增加了GnssTester::LambdaTester
+ * <tr><td>2026/10/18   <td>1.8      <td>Zing Fong  <td>增加了SinsTester::WindowTester
  * </table>
  **********************************************************************************
  */
@@ -45,6 +53,98 @@ class BaseMathTester
   
 };
 
+/**@class   BaseMatrixTester
+ * @brief   BaseMatrix类的测试类
+ * @par     修改日志:
+ * <table>
+ * <tr><th>Date         <th>Author      <th>Description
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>Initialize
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>增加了BlasTester
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>增加了BlockTester
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>增加了ArenaTester
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>增加了BackendTester
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>增加了PrecisionTester
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>增加了ExpTester
+ * </table>
+ */
+class BaseMatrixTester
+{
+  public:
+    static int InsertEraseTester();  // 增删行列测试器
+    static int BlasTester();  // 原地运算与移动语义测试器
+    static int BlockTester();  // 子矩阵视图测试器
+    static int ArenaTester();  // 单历元临时区测试器
+    static int BackendTester();  // BLAS/LAPACK后端测试器
+    static int PrecisionTester();  // 单精度矩阵和姿态运算测试器
+    static int ExpTester();  // 矩阵指数测试器
+};
+
+/**@class   ProfilerTester
+ * @brief   Profiler类的测试类
+ * @par     修改日志:
+ * <table>
+ * <tr><th>Date         <th>Author      <th>Description
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>Initialize
+ * </table>
+ */
+class ProfilerTester
+{
+  public:
+    static int AllocTrackerTester();  // 内存申请统计测试器
+};
+
+/**@class   ConfigTester
+ * @brief   Config类的测试类
+ * @par     修改日志:
+ * <table>
+ * <tr><th>Date         <th>Author      <th>Description
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>Initialize
+ * </table>
+ */
+class ConfigTester
+{
+  public:
+    static int ReadConfigTester();  // 配置文件读取测试器
+};
+
+/**@class   GnssTester
+ * @brief   GNSS预处理与解算的测试类
+ * @par     修改日志:
+ * <table>
+ * <tr><th>Date         <th>Author      <th>Description
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>Initialize
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>增加了PartialLambdaTester
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>增加了PipelineTester
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>增加了LambdaTester
+ * </table>
+ */
+class GnssTester
+{
+  public:
+    static int OutlierDetectorTester();  // 组合观测值与粗差探测测试器
+    static int NormalEquationTester();  // 法方程累加器测试器
+    static int LambdaTester();  // LAMBDA回归测试器
+    static int PartialLambdaTester();  // 部分模糊度固定测试器
+    static int PipelineTester();  // RTK流水线测试器
+};
+
+/**@class   SinsTester
+ * @brief   惯导与松组合的测试类
+ * @par     修改日志:
+ * <table>
+ * <tr><th>Date         <th>Author      <th>Description
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>Initialize
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>增加了FrameTester
+ * <tr><td>2026/10/18   <td>Zing Fong   <td>增加了WindowTester
+ * </table>
+ */
+class SinsTester
+{
+  public:
+    static int ProcessNoiseTester();  // Van Loan离散化与Qd缓存测试器
+    static int FrameTester();  // NED与ECEF机械编排、松组合的交叉检验
+    static int WindowTester();  // 分时段解算与顺序解算的比较, 含静止起点的窗口
+};
 
 
 class Tester